@@ -121,6 +121,18 @@ GLOBALS_m13		*globals_m13 = NULL;
 // used by adaptive jobs_per_core: utilization measurements are only trusted when a distribution runs alone
 static _Atomic si4	distribute_calls_m13 = 0;
 
+// persistent job pool (see PROC_pool_get_m13()): process-wide & never torn down - idle workers hold no library
+// state, so (like stacks_epoch_m13 below) the pool outlives G_free_globals_m13() & serves a re-initialized library
+static PROC_POOL_m13				proc_pool_m13;  // zeroed static: initialized on first use
+static thread_local_m13 PROC_POOL_WORKER_m13	*proc_pool_self_m13 = NULL;  // this thread's worker slot (NULL: not a pool worker)
+
+// isem contentions, process-wide (see isem_contentions_m13())
+static _Atomic ui8	isem_total_contentions_m13 = 0;
+
+// PAR completion descriptor (see PAR_event_fd_m13()): created on first request, never closed (-1: not created)
+// Linux: one eventfd (both ends the same descriptor); MacOS: pipe read & write ends
+static _Atomic si4	par_event_rd_fd_m13 = -1, par_event_wr_fd_m13 = -1;
+
 // type 2 recovery anchor configuration (process-wide, write-once at startup via G_set_anchor_public_key_m13():
 // no reset machinery to trip re-initialization; public keys are not secret, so no erasure obligations either)
 static ui1	G_anchor_public_key_m13[XEC_KEY_BYTES_m13];
@@ -148,20 +160,39 @@ static FT_SNAPSHOT_m13	FT_error_snapshot_m13;  // zeroed static (debug builds on
 
 // GENERAL MED FUNCTIONS  (G)
 static tern chan_name_file_update_m13(const si1 *dir, const si1 *fs_name, const si1 *uh_name, const si1 *sufx, const si1 *ext);
+static si8 DM_gather_records_m13(FPS_m13 *ri_fps, si4 *record_filters, si8 start_time, si8 end_time, EPOCH_SORT_m13 **recs, si8 *n_recs, si8 *max_recs);
+static tern DM_overview_ranges_m13(CHAN_m13 *chan, si8 n_raw_samps, si8 n_out, sf8 *out_buf, sf8 *out_mins, sf8 *out_maxs);
 static tern G_apply_medlibrc_m13(si1 *buffer, tern sequential, tern *missing_fields);
 static tern G_behavior_stack_grow_m13(BEHAVIOR_STACK_m13 *stack);
+static si8 G_block_encryption_bytes_m13(CMP_FIXED_BH_m13 *bh);
 static void G_build_kdf_salt_m13(UH_m13 *uh, ui1 *salt);
+static ui1 *G_convert_samples_m13(si4 *src, si8 n, ui1 *dest, ui8 dest_type, si8 dest_stride, sf8 scale);
 static void G_copy_password_data_m13(UH_m13 *dst, const UH_m13 *src);
 static ui4 G_default_behavior_code_m13(void);
+static si4 G_epoch_compare_m13(const void *a, const void *b);
 static tern G_escrow_derive_master_m13(const si1 *password_bytes, ui1 level, UH_m13 *uh, ui1 *master);
 static tern G_escrow_validate_master_m13(const ui1 *cand_master, ui1 level, UH_m13 *uh);
+static si4 G_file_list_append_m13(const si1 *path, si1 **paths, si4 *n_paths, si4 *max_paths);
+static si4 G_file_list_expand_m13(const si1 *pattern, si1 **paths, si4 *n_paths, si4 *max_paths);
+static si4 G_file_list_match_m13(si1 *path, si4 path_len, const si1 *pattern, si1 **paths, si4 *n_paths, si4 *max_paths);
 static si1 *G_password_class_list_m13(ui1 classes, si1 *buf);
+static void G_release_lazy_segments_m13(CHAN_m13 *chan);
 static tern G_restore_pre_sort_m13(const si1 *path, const si1 *tmp_path);
 static tern G_schema1_apply_L1_m13(UH_m13 *uh, PASSWORD_DATA_m13 *pwd, const ui1 *master, const si1 *pw_bytes);
 static tern G_schema1_apply_L2_m13(UH_m13 *uh, PASSWORD_DATA_m13 *pwd, const ui1 *master, const si1 *pw_bytes);
 static tern G_schema1_master_is_L1_m13(UH_m13 *uh, const ui1 *master);
 static tern G_schema1_master_is_L2_m13(UH_m13 *uh, const ui1 *master);
+static tern G_segment_sidecar_jobs_m13(void *level_header, pthread_fn_m13 thread_f, const si1 *thread_name);
+static si4 G_session_manifest_compare_m13(const void *a, const void *b);
+static tern G_stream_fill_m13(STREAM_m13 *stream, STREAM_CHUNK_m13 *chunk);
+static pthread_rval_m13 G_stream_thread_m13(void *ptr);
+static tern G_time_series_data_CRCs_parallel_m13(CRC_SPAN_m13 *data);
+static void G_time_series_data_CRCs_span_m13(CRC_SPAN_m13 *span);
+static pthread_rval_m13 G_time_series_data_CRCs_thread_m13(void *ptr);
 static si4 G_utf8_seq_len_m13(si4 lead);
+static ZMAP_BLOCK_m13 *G_zone_map_add_block_m13(ZMAP_m13 **zmap_ptr);
+static void G_zone_map_block_stats_m13(si4 *samps, si8 n_samps, ZMAP_BLOCK_m13 *blk);
+static tern G_zone_map_write_m13(ZMAP_m13 *zmap, const si1 *data_path, ui8 segment_UID);
 static si4 PW_char_pool_m13(const si1 *password, si4 len);
 static sf8 PW_dictionary_cost_m13(const si1 *lower, const si1 *unleet, const si1 *orig, si4 start, si4 len);
 static tern PW_keyboard_adjacent_m13(si1 a, si1 b);
@@ -195,43 +226,102 @@ static tern AES_hw_ready_m13(void);
 #endif
 #ifdef HW_CRYPTO_m13
 #if defined __x86_64__ || defined __i386__
+static void AES_cipher_blocks_hw_m13(ui1 *data, si8 n_blocks, ui1 *round_key, si4 nr);
 static void AES_cipher_hw_m13(ui1 *in, ui1 *out, ui1 *round_key, si4 nr);
+static void AES_ctr_blocks_hw_m13(ui1 *data, si8 n_blocks, ui1 *ctr_block, ui1 *round_key, si4 nr);
+static void AES_inv_cipher_blocks_hw_m13(ui1 *data, si8 n_blocks, ui1 *round_key, si4 nr);
 static void AES_inv_cipher_hw_m13(ui1 *in, ui1 *out, ui1 *round_key, si4 nr);
 #endif
 #endif
 #ifdef HW_CRYPTO_m13
 #ifdef __aarch64__
+static void AES_cipher_blocks_hw_m13(ui1 *data, si8 n_blocks, ui1 *round_key, si4 nr);
 static void AES_cipher_hw_m13(ui1 *in, ui1 *out, ui1 *round_key, si4 nr);
+static void AES_ctr_blocks_hw_m13(ui1 *data, si8 n_blocks, ui1 *ctr_block, ui1 *round_key, si4 nr);
+static void AES_inv_cipher_blocks_hw_m13(ui1 *data, si8 n_blocks, ui1 *round_key, si4 nr);
 static void AES_inv_cipher_hw_m13(ui1 *in, ui1 *out, ui1 *round_key, si4 nr);
 #endif
 #endif
 
 // COMPRESSION & COMPUTATION FUNCTIONS  (CMP)
+static void CMP_block_cache_evict_m13(CMP_BLOCK_CACHE_SHARD_m13 *shard, si8 shard_budget);
+static ui8 CMP_block_cache_hash_m13(ui8 file_UID, si8 block_number);
+static tern CMP_block_cache_insert_m13(ui8 file_UID, si8 block_number, si4 *samples, ui4 n_samples);
+static CMP_BLOCK_CACHE_SHARD_m13 *CMP_block_cache_shard_m13(ui8 file_UID, si8 block_number, si4 *bucket);
 static ui1 CMP_overflow_bytes_for_extrema_m13(si8 min_val, si8 max_val, tern pos_derivs);
+static CMP_SHM_CACHE_m13 *CMP_shm_cache_attach_m13(void);
+static tern CMP_shm_cache_lock_m13(CMP_SHM_CACHE_SET_m13 *set);
+static void CMP_shm_cache_name_m13(si1 *name);
+#ifdef HW_SIMD_m13
+static si8 CMP_si4_to_type_hw_m13(si4 *si4_arr, void *out_arr, si8 len, ui1 out_type, sf8 scale);
+#endif
 static int CMP_VDS_cand_cmp_m13(const void *a, const void *b);
 static sf8 CMP_VDS_delta_at_m13(si8 *in_x, sf8 *in_y, si8 in_len, si8 k);
 static void CMP_VDS_eval_seg_m13(si8 *in_x, sf8 *in_y, si8 in_len, si8 j, si8 block_samps, sf8 *template, sf8 *out_y, sf8 *resids, tern *packing);
 static int CMP_VDS_si8_cmp_m13(const void *a, const void *b);
 static sf8 CMP_VDS_slope_at_m13(si8 *in_x, sf8 *in_y, si8 in_len, si8 i, tern *packing);
 
+// CYCLICALLY REDUNDANT CHECKSUM FUNCTIONS  (CRC)
+#ifdef HW_CRYPTO_m13
+static crc4 CRC_fold_hw_m13(const ui1 *buf, si8 len, crc4 c);
+#endif
+static pthread_rval_m13 CRC_span_thread_m13(void *ptr);
+
 // CANONICAL FILE DIGESTS  (DGST)
 static void DGST_absorb_m13(DGST_STREAM_m13 *dg, const ui1 *ptr, si8 n_bytes);
+static pthread_rval_m13 DGST_batch_thread_m13(void *ptr);
+static void DGST_batch_worker_m13(DGST_BATCH_m13 *batch);
 static void DGST_deserialize_state_m13(SHA_CTX_m13 *ctx, const ui1 *resume);
+static tern DGST_finish_m13(SHA_CTX_m13 *ctx, FILE_m13 *fp, si8 uh_offset, ui1 *buffer, DGST_RESULT_m13 *result);
+static void DGST_lane_close_m13(DGST_BATCH_m13 *batch, DGST_LANE_m13 *lane, tern ok);
+static tern DGST_lane_fill_m13(DGST_LANE_m13 *lane);
+static tern DGST_lane_open_m13(DGST_LANE_m13 *lane, const si1 *path);
+static void DGST_regions_m13(FILE_m13 *fp, const si1 *path, si8 *uh_offset, si8 *data_start, si8 *data_len);
 static void DGST_serialize_state_m13(const SHA_CTX_m13 *ctx, ui1 *resume);
 
 // FILTER FUNCTIONS  (FILT)
 static si8 FILT_filtfilt_feed_m13(FILTFILT_DATA_m13 *fd, sf8 new_val, sf8 *qx);
 
 // FILE PROCESSING FUNCTIONS  (FPS)
+static void FPS_free_raw_data_m13(FPS_PARAMS_m13 *params);
 static tern FPS_mmap_alloc_m13(FPS_m13 *fps);
+static tern FPS_mmap_os_m13(FPS_m13 *fps, si8 offset);
+static tern FPS_munmap_os_m13(FPS_m13 *fps);
+
+// PARALLEL FUNCTIONS  (PAR)
+static void PAR_event_signal_m13(void);
+static si8 PAR_usecs_m13(const si1 *time_str, si8 empty_usecs);
 
 // PROCESS FUNCTIONS  (PROC)
 static pthread_rval_m13 G_thread_trampoline_m13(void *arg);
+static si4 PROC_os_priority_m13(si4 priority);
+static PROC_POOL_WORKER_m13 *PROC_pool_enter_m13(PROC_POOL_m13 *pool);
+static PROC_POOL_m13 *PROC_pool_get_m13(void);
+static tern PROC_pool_help_m13(PROC_POOL_m13 *pool, PROC_POOL_WORKER_m13 *self);
+static void PROC_pool_leave_m13(PROC_POOL_m13 *pool, PROC_POOL_WORKER_m13 *slot);
+static void PROC_pool_limit_m13(PROC_POOL_m13 *pool, si4 limit, si4 delta);
+static void PROC_pool_notify_m13(void);
+static PROC_JOB_m13 *PROC_pool_pop_m13(PROC_POOL_WORKER_m13 *deque, tern steal);
+static void PROC_pool_priority_m13(PROC_POOL_WORKER_m13 *self, si4 priority);
+static tern PROC_pool_push_m13(PROC_POOL_WORKER_m13 *deque, PROC_JOB_m13 *job);
+static void PROC_pool_retire_m13(PROC_POOL_m13 *pool, PROC_POOL_WORKER_m13 *self);
+static tern PROC_pool_runner_m13(PROC_POOL_m13 *pool);
+static PROC_POOL_WORKER_m13 *PROC_pool_slot_m13(PROC_POOL_m13 *pool);
+static tern PROC_pool_spawn_m13(PROC_POOL_m13 *pool);
+static tern PROC_pool_submit_m13(PROC_JOB_m13 *job);
+static PROC_JOB_m13 *PROC_pool_take_m13(PROC_POOL_m13 *pool, PROC_POOL_WORKER_m13 *self);
+static void PROC_pool_wait_m13(ui8 seq, si8 wake_uutc);
+static pthread_rval_m13 PROC_pool_worker_m13(void *arg);
 
 // HASH FUNCTIONS  (SHA)
+static void SHA_hmac_pads_m13(const ui1 *key, si4 key_bytes, ui4 *i_state, ui4 *o_state);
 #ifdef HW_CRYPTO_m13
 static tern SHA_hw_ready_m13(void);
 #endif
+static void SHA_pbkdf2_group_m13(SHA_PBKDF2_LANE_m13 *lanes, si4 n_lanes);
+static pthread_rval_m13 SHA_pbkdf2_group_thread_m13(void *ptr);
+static void SHA_pbkdf2_iterate_m13(si4 n_lanes, ui4 (*i_state)[8], ui4 (*o_state)[8], ui4 (*u)[8], ui4 (*dk)[8], const ui4 *n_iter);
+static void SHA_transform_lanes_m13(ui4 (*state)[SHA_LANES_m13], ui4 (*w)[SHA_LANES_m13]);
 #ifdef HW_CRYPTO_m13
 #if defined __x86_64__ || defined __i386__
 static void SHA_transform_hw_m13(SHA_CTX_m13 *ctx, const ui1 *data);
@@ -268,9 +358,12 @@ static VID_WALK_m13 *VID_walk_avi_m13(FILE_m13 *fp, si8 flen);
 static VID_WALK_m13 *VID_walk_bmff_m13(FILE_m13 *fp, si8 flen);
 
 // STANDARD LIBRARY FUNCTIONS  (no prefix)
+static FLOCK_ENTRY_m13 *FLOCK_entry_get_m13(FLOCK_LIST_m13 *list);
+static void FLOCK_entry_put_m13(FLOCK_LIST_m13 *list, FLOCK_ENTRY_m13 *lock);
 static FLOCK_HELD_READS_m13 *FLOCK_held_slot_m13(FLOCK_ENTRY_m13 *lock, tern claim);
 static si4 FLOCK_os_lock_m13(FLOCK_ENTRY_m13 *lock, si1 new_state, tern blocking, si4 file_fd);
 static void isem_lazy_init_m13(isem_t_m13 *isem, const si1 *caller);
+static void isem_sleep_m13(isem_t_m13 *isem, si8 *warn_uutc);
 static tern rm_path_m13(const si1 *path, tern recursive);
 #if defined MACOS_m13 || defined LINUX_m13
 static si4 cp_recursive_m13(const si1 *src, const si1 *dst);
@@ -1423,6 +1516,29 @@ si1	*G_behavior_string_m13(ui4 behavior_code, si1 *behavior_string)
 }
 
 
+static si8	G_block_encryption_bytes_m13(CMP_FIXED_BH_m13 *bh)
+{
+	si8	encryption_bytes, encryptable_bytes;
+	
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// bytes of a CMP block encrypted from CMP_BLOCK_ENCRYPTION_START_OFFSET_m13
+	
+	encryptable_bytes = bh->total_block_bytes - CMP_BLOCK_ENCRYPTION_START_OFFSET_m13;
+	if (bh->block_flags & CMP_BF_MBE_ENCODING_m13) {  // MBE readable without other info (e.g. RED/PRED statistics) => encrypt full payload
+		encryption_bytes = encryptable_bytes;  // full 16 byte AES blocks after encryption start point; AES_encrypt/decrypt_m13() handle trailing partial block internally (AES_partial_encrypt/decrypt_m13())
+	} else {
+		encryption_bytes = (bh->total_header_bytes - CMP_BLOCK_ENCRYPTION_START_OFFSET_m13) + ENCRYPTION_BLOCK_BYTES_m13;
+		if (encryption_bytes > encryptable_bytes)
+			encryption_bytes = encryptable_bytes;
+	}
+
+	return_m13(encryption_bytes);
+}
+
+
 si8	G_build_contigua_m13(void *level_header)
 {
 	tern				force_discont, null_sample_numbers;
@@ -1751,6 +1867,365 @@ static void	G_build_kdf_salt_m13(UH_m13 *uh, ui1 *salt)
 }
 
 
+tern	G_build_overview_m13(SEG_m13 *seg)
+{
+	tern				update_parity, written;
+	si1				data_path[PATH_BYTES_m13], ovw_path[PATH_BYTES_m13], tmp_path[PATH_BYTES_m13];
+	si4				i, n_levels, *samps, *mins, *maxs, *lo_mins, *lo_maxs, s_min, s_max;
+	si8				j, k, n_samps, n_read, n_bins, bin_start, bin_end, lo_bins, lo_bin_samps, c0, c1, body_len, offset;
+	ui8				saved_flags;
+	sf4				*means, *lo_means;
+	sf8				sum;
+	ui1				*body;
+	FILE_m13			*fp;
+	FILE_TIMES_m13			ft;
+	struct_stat_m13			sb;
+	SLICE_m13			slice;
+	OVW_HDR_m13			hdr;
+	OVW_LEVEL_m13			levels[OVW_MAX_LEVELS_m13];
+	CPS_m13				*cps;
+	TS_METADATA_SECTION_2_m13	*tmd2;
+	
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// (re)builds the segment's overview file from its decoded samples, read in OVW_BUILD_CHUNK_SAMPLES_m13 slices
+	// the segment is left holding the last chunk read: its slice describes those data (not the slice it had on entry)
+	// failure (e.g. a read-only segment directory) leaves DM reading the segment data as usual
+
+	if (seg == NULL) {
+		G_set_error_m13(E_GEN_m13, "segment is null");
+		return_m13(FALSE_m13);
+	}
+	if (seg->type_code != TS_SEG_TYPE_CODE_m13 || seg->metadata_fps == NULL) {
+		G_set_error_m13(E_GEN_m13, "not an open time series segment");
+		return_m13(FALSE_m13);
+	}
+	if (seg->metadata_fps->uh->time_series_data_encryption != NO_ENCRYPTION_m13) {
+		G_set_error_m13(E_GEN_m13, "time series data are encrypted");
+		return_m13(FALSE_m13);
+	}
+	tmd2 = &seg->metadata_fps->metadata->time_series_section_2;
+	if ((n_samps = tmd2->number_of_samples) <= 0)
+		return_m13(FALSE_m13);
+	sprintf_m13(data_path, "%s/%s.%s", seg->path, seg->name, TS_DATA_TYPE_STR_m13);
+	sprintf_m13(ovw_path, "%s/%s.%s", seg->path, seg->name, OVW_TYPE_STR_m13);
+	
+	// data file state before the reads: a write racing the build leaves the overview stale, never wrong
+	if (stat_m13(data_path, &sb)) {
+		G_set_error_m13(E_GEN_m13, "no time series data file");
+		return_m13(FALSE_m13);
+	}
+	G_file_times_m13(NULL, data_path, &ft, FALSE_m13);
+	
+	// level geometry
+	n_bins = (n_samps + (OVW_BASE_BIN_SAMPLES_m13 - 1)) / OVW_BASE_BIN_SAMPLES_m13;
+	offset = (si8) sizeof(OVW_HDR_m13);
+	for (n_levels = 0; n_levels < OVW_MAX_LEVELS_m13; ++n_levels) {
+		if (n_levels && n_bins < OVW_MIN_TOP_BINS_m13)
+			break;
+		levels[n_levels].bin_samples = OVW_BASE_BIN_SAMPLES_m13 << n_levels;
+		levels[n_levels].n_bins = n_bins;
+		n_bins = (n_bins + 1) >> 1;
+	}
+	offset += (si8) n_levels * (si8) sizeof(OVW_LEVEL_m13);
+	for (body_len = i = 0; i < n_levels; ++i) {
+		levels[i].offset = offset + body_len;
+		body_len += levels[i].n_bins * (si8) (sizeof(si4) + sizeof(si4) + sizeof(sf4));
+	}
+	body = (ui1 *) malloc_m13(body_len);
+	
+	// level 0 from the samples (chunks are whole bins)
+	saved_flags = seg->flags;
+	seg->flags = (seg->flags | LH_READ_SLICE_SEG_DATA_m13) & ~(LH_DEFER_TS_DECODE_m13 | LH_GENERATE_EPHEMERAL_DATA_m13);
+	mins = (si4 *) body;
+	maxs = mins + levels[0].n_bins;
+	means = (sf4 *) (maxs + levels[0].n_bins);
+	for (k = 0; k < n_samps; k += n_read) {
+		G_init_slice_m13(&slice);
+		slice.start_samp_num = tmd2->session_start_sample_number + k;
+		slice.end_samp_num = slice.start_samp_num + OVW_BUILD_CHUNK_SAMPLES_m13 - 1;
+		if (slice.end_samp_num >= tmd2->session_start_sample_number + n_samps)
+			slice.end_samp_num = (tmd2->session_start_sample_number + n_samps) - 1;
+		n_read = 0;
+		if (G_read_segment_m13(seg, &slice) == NULL || seg->ts_data_fps == NULL)
+			break;
+		if ((cps = seg->ts_data_fps->params.cps) == NULL)
+			break;
+		n_read = SLICE_IDX_COUNT_S_m13(seg->slice);
+		if (seg->slice.start_samp_num != slice.start_samp_num || n_read != SLICE_IDX_COUNT_S_m13(slice)) {
+			n_read = 0;
+			break;
+		}
+		samps = cps->decompressed_data;
+		for (j = 0; j < n_read; j += OVW_BASE_BIN_SAMPLES_m13) {
+			bin_end = j + OVW_BASE_BIN_SAMPLES_m13;
+			if (bin_end > n_read)
+				bin_end = n_read;
+			s_min = s_max = samps[j];
+			sum = (sf8) 0.0;
+			for (bin_start = j; bin_start < bin_end; ++bin_start) {
+				if (samps[bin_start] < s_min)
+					s_min = samps[bin_start];
+				else if (samps[bin_start] > s_max)
+					s_max = samps[bin_start];
+				sum += (sf8) samps[bin_start];
+			}
+			bin_start = (k + j) / OVW_BASE_BIN_SAMPLES_m13;
+			mins[bin_start] = s_min;
+			maxs[bin_start] = s_max;
+			means[bin_start] = (sf4) (sum / (sf8) (bin_end - j));
+		}
+	}
+	seg->flags = saved_flags;
+	if (n_read == 0) {
+		free_m13((void *) body);
+		G_set_error_m13(E_GEN_m13, "segment data read failed");
+		return_m13(FALSE_m13);
+	}
+	
+	// levels above: merge bin pairs (means weighted by sample counts; only a level's last bin can be partial)
+	for (i = 1; i < n_levels; ++i) {
+		lo_mins = (si4 *) (body + (levels[i - 1].offset - levels[0].offset));
+		lo_maxs = lo_mins + levels[i - 1].n_bins;
+		lo_means = (sf4 *) (lo_maxs + levels[i - 1].n_bins);
+		lo_bins = levels[i - 1].n_bins;
+		lo_bin_samps = levels[i - 1].bin_samples;
+		mins = (si4 *) (body + (levels[i].offset - levels[0].offset));
+		maxs = mins + levels[i].n_bins;
+		means = (sf4 *) (maxs + levels[i].n_bins);
+		for (j = 0, k = 0; j < levels[i].n_bins; ++j, k += 2) {
+			if (k + 1 == lo_bins) {  // odd bin out
+				mins[j] = lo_mins[k];
+				maxs[j] = lo_maxs[k];
+				means[j] = lo_means[k];
+				continue;
+			}
+			mins[j] = (lo_mins[k] < lo_mins[k + 1]) ? lo_mins[k] : lo_mins[k + 1];
+			maxs[j] = (lo_maxs[k] > lo_maxs[k + 1]) ? lo_maxs[k] : lo_maxs[k + 1];
+			c0 = lo_bin_samps;
+			c1 = (k + 2 == lo_bins) ? n_samps - ((k + 1) * lo_bin_samps) : lo_bin_samps;
+			means[j] = (sf4) ((((sf8) lo_means[k] * (sf8) c0) + ((sf8) lo_means[k + 1] * (sf8) c1)) / (sf8) (c0 + c1));
+		}
+	}
+
+	// header
+	memset((void *) &hdr, 0, sizeof(OVW_HDR_m13));
+	hdr.tag = OVW_TAG_m13;
+	hdr.version_major = OVW_VER_MAJOR_m13;
+	hdr.version_minor = OVW_VER_MINOR_m13;
+	hdr.n_levels = n_levels;
+	hdr.number_of_samples = n_samps;
+	hdr.data_len = (si8) sb.st_size;
+	hdr.data_mod_time = ft.modification;
+	hdr.segment_UID = seg->metadata_fps->uh->segment_UID;
+	hdr.build_time = G_current_uutc_m13();
+	hdr.body_CRC = CRC_update_m13((ui1 *) levels, (si8) n_levels * (si8) sizeof(OVW_LEVEL_m13), CRC_START_VALUE_m13);
+	hdr.body_CRC = CRC_update_m13(body, body_len, hdr.body_CRC);
+	hdr.header_CRC = CRC_calculate_m13((ui1 *) &hdr + OVW_HDR_CRC_START_OFFSET_m13, (si8) sizeof(OVW_HDR_m13) - OVW_HDR_CRC_START_OFFSET_m13);
+
+	// write to a temporary file & rename it over the overview: readers see the old overview or the new one, never a partial one
+	update_parity = globals_m13->miscellaneous.update_parity;
+	globals_m13->miscellaneous.update_parity = FALSE_m13;  // not a MED file: no parity data
+	G_add_behavior_m13(RETURN_ON_FAIL_m13 | SUPPRESS_OUTPUT_m13);
+	sprintf_m13(tmp_path, "%s.%d.tmp", ovw_path, (si4) getpid_m13());  // per process: concurrent builders do not share it
+	written = FALSE_m13;
+	fp = fopen_m13(tmp_path, "w");
+	if (fp) {
+		written = TRUE_m13;
+		if (fwrite_m13((void *) &hdr, sizeof(ui1), sizeof(OVW_HDR_m13), fp) != sizeof(OVW_HDR_m13))
+			written = FALSE_m13;
+		else if (fwrite_m13((void *) levels, sizeof(OVW_LEVEL_m13), (size_t) n_levels, fp) != (size_t) n_levels)
+			written = FALSE_m13;
+		else if (fwrite_m13((void *) body, sizeof(ui1), (size_t) body_len, fp) != (size_t) body_len)
+			written = FALSE_m13;
+		if (fclose_m13(fp))
+			written = FALSE_m13;
+		if (written == TRUE_m13) {
+		#ifdef WINDOWS_m13
+			if (MoveFileExA(tmp_path, ovw_path, MOVEFILE_REPLACE_EXISTING) == 0)
+				written = FALSE_m13;
+		#else
+			if (rename(tmp_path, ovw_path))
+				written = FALSE_m13;
+		#endif
+		}
+		if (written == FALSE_m13)
+			remove(tmp_path);
+	}
+	G_pop_behavior_m13();
+	globals_m13->miscellaneous.update_parity = update_parity;
+	free_m13((void *) body);
+	
+	// next G_read_overview_m13() reads the new file
+	if (seg->overview) {
+		G_free_overview_m13(seg->overview);
+		seg->overview = NULL;
+	}
+	seg->overview_read = UNKNOWN_m13;
+
+	return_m13(written);
+}
+
+
+pthread_rval_m13	G_build_overview_thread_m13(void *ptr)
+{
+	PROC_JOB_m13	*job;
+
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// form required by PROC_jobs_distribute_m13(): job->function_arg is the SEG_m13 *
+	
+	job = (PROC_JOB_m13 *) ptr;
+	job->status = PROC_THREAD_RUNNING_m13;
+	
+	if (G_build_overview_m13((SEG_m13 *) job->function_arg) == TRUE_m13)
+		job->status = PROC_THREAD_SUCCEEDED_m13;
+	else
+		job->status = PROC_THREAD_FAILED_m13;
+	
+	return_m13(PROC_JOB_STATUS_SET_m13);
+}
+
+
+tern	G_build_overviews_m13(void *level_header)
+{
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// builds overviews for every open, unencrypted time series segment of a session or channel (one low priority job per segment)
+	// returns TRUE_m13 if all were built; encrypted segments are skipped & do not count as failures
+
+	return_m13(G_segment_sidecar_jobs_m13(level_header, G_build_overview_thread_m13, "G_build_overview_thread_m13"));
+}
+
+
+tern	G_build_zone_map_m13(SEG_m13 *seg)
+{
+	si1				data_path[PATH_BYTES_m13];
+	si4				n_blocks;
+	si8				b, e, k, n_read;
+	ui8				saved_flags;
+	tern				r_val;
+	SLICE_m13			slice;
+	ZMAP_m13			*zmap;
+	ZMAP_BLOCK_m13			*blk;
+	TS_IDX_m13			*tsi;
+	TS_METADATA_SECTION_2_m13	*tmd2;
+	
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// (re)builds the segment's zone map from its decoded samples, read in whole-block slices of about ZMAP_BUILD_CHUNK_SAMPLES_m13
+	// the segment is left holding the last chunk read: its slice describes those data (not the slice it had on entry)
+
+	if (seg == NULL) {
+		G_set_error_m13(E_GEN_m13, "segment is null");
+		return_m13(FALSE_m13);
+	}
+	if (seg->type_code != TS_SEG_TYPE_CODE_m13 || seg->metadata_fps == NULL || seg->ts_inds_fps == NULL) {
+		G_set_error_m13(E_GEN_m13, "not an open time series segment");
+		return_m13(FALSE_m13);
+	}
+	if (seg->metadata_fps->uh->time_series_data_encryption != NO_ENCRYPTION_m13) {
+		G_set_error_m13(E_GEN_m13, "time series data are encrypted");
+		return_m13(FALSE_m13);
+	}
+	tmd2 = &seg->metadata_fps->metadata->time_series_section_2;
+	tsi = seg->ts_inds_fps->ts_inds;
+	n_blocks = (si4) seg->ts_inds_fps->uh->n_entries - 1;  // terminal index bounds the last block
+	if (n_blocks < 1)
+		return_m13(FALSE_m13);
+	sprintf_m13(data_path, "%s/%s.%s", seg->path, seg->name, TS_DATA_TYPE_STR_m13);
+
+	zmap = NULL;
+	saved_flags = seg->flags;
+	seg->flags = (seg->flags | LH_READ_SLICE_SEG_DATA_m13) & ~(LH_DEFER_TS_DECODE_m13 | LH_GENERATE_EPHEMERAL_DATA_m13);
+	n_read = 0;
+	for (b = 0; b < n_blocks; b = e) {
+		for (e = b + 1; e < n_blocks; ++e)  // whole blocks, at least one
+			if (tsi[e + 1].start_samp_num - tsi[b].start_samp_num > ZMAP_BUILD_CHUNK_SAMPLES_m13)
+				break;
+		G_init_slice_m13(&slice);
+		slice.start_samp_num = tmd2->session_start_sample_number + tsi[b].start_samp_num;
+		slice.end_samp_num = (tmd2->session_start_sample_number + tsi[e].start_samp_num) - 1;
+		n_read = 0;
+		if (G_read_segment_m13(seg, &slice) == NULL || seg->ts_data_fps == NULL || seg->ts_data_fps->params.cps == NULL)
+			break;
+		n_read = SLICE_IDX_COUNT_S_m13(seg->slice);
+		if (seg->slice.start_samp_num != slice.start_samp_num || n_read != SLICE_IDX_COUNT_S_m13(slice)) {
+			n_read = 0;
+			break;
+		}
+		for (k = b; k < e; ++k) {
+			blk = G_zone_map_add_block_m13(&zmap);
+			G_zone_map_block_stats_m13(seg->ts_data_fps->params.cps->decompressed_data + (tsi[k].start_samp_num - tsi[b].start_samp_num), tsi[k + 1].start_samp_num - tsi[k].start_samp_num, blk);
+			blk->start_time = tsi[k].start_time;
+			blk->start_samp_num = tsi[k].start_samp_num;
+			if (tsi[k].file_offset < 0)
+				blk->flags |= ZMAP_BF_DISCONTINUITY_m13;
+		}
+	}
+	seg->flags = saved_flags;
+	
+	r_val = FALSE_m13;
+	if (n_read == 0)
+		G_set_error_m13(E_GEN_m13, "segment data read failed");
+	else
+		r_val = G_zone_map_write_m13(zmap, data_path, seg->metadata_fps->uh->segment_UID);
+	G_free_zone_map_m13(zmap);
+
+	// next G_read_zone_map_m13() reads the new file
+	if (seg->zone_map) {
+		G_free_zone_map_m13(seg->zone_map);
+		seg->zone_map = NULL;
+	}
+	seg->zone_map_read = UNKNOWN_m13;
+
+	return_m13(r_val);
+}
+
+
+pthread_rval_m13	G_build_zone_map_thread_m13(void *ptr)
+{
+	PROC_JOB_m13	*job;
+
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// form required by PROC_jobs_distribute_m13(): job->function_arg is the SEG_m13 *
+	
+	job = (PROC_JOB_m13 *) ptr;
+	job->status = PROC_THREAD_RUNNING_m13;
+	
+	if (G_build_zone_map_m13((SEG_m13 *) job->function_arg) == TRUE_m13)
+		job->status = PROC_THREAD_SUCCEEDED_m13;
+	else
+		job->status = PROC_THREAD_FAILED_m13;
+	
+	return_m13(PROC_JOB_STATUS_SET_m13);
+}
+
+
+tern	G_build_zone_maps_m13(void *level_header)
+{
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// builds zone maps for every open, unencrypted time series segment of a session or channel (one low priority job per segment)
+	// returns TRUE_m13 if all were built; encrypted segments are skipped & do not count as failures
+
+	return_m13(G_segment_sidecar_jobs_m13(level_header, G_build_zone_map_thread_m13, "G_build_zone_map_thread_m13"));
+}
+
+
 Sgmt_REC_m13	*G_build_Sgmt_records_m13(void *level_header, si4 search_mode, ui4 *source_type)
 {
 	tern			seek_mode, seg_exists;
@@ -2084,29 +2559,27 @@ tern	G_calculate_record_data_CRCs_m13(FPS_m13 *fps)
 
 tern	G_calculate_time_series_data_CRCs_m13(FPS_m13 *fps)
 {
-	si8 			i;
 	UH_m13			*uh;
-	CMP_FIXED_BH_m13	*bh;
+	CRC_SPAN_m13		data;
 	
 #ifdef FT_DEBUG_m13
 	G_push_function_m13();
 #endif
 	
 	uh = fps->uh;
-	bh = (CMP_FIXED_BH_m13 *) fps->ts_data;
 
 	// full file
 	if (fps->n_items == uh->n_entries)
 		uh->body_CRC = CRC_START_VALUE_m13;
 
-	for (i = fps->n_items; i--;) {
-		// CMP blocks lead with the 8-byte block start UID, so CRC coverage starts at the block flags (offset 12), not at sizeof(crc4) as in record headers
-		bh->block_CRC = CRC_calculate_m13((ui1 *) bh + CMP_BLOCK_CRC_START_OFFSET_m13, bh->total_block_bytes - CMP_BLOCK_CRC_START_OFFSET_m13);  // calculate block CRC value
-		uh->body_CRC = CRC_update_m13((ui1 *) bh, CMP_BLOCK_CRC_START_OFFSET_m13, uh->body_CRC);  // add block start UID & stored block CRC value to body CRC
-		uh->body_CRC = CRC_combine_m13(uh->body_CRC, bh->block_CRC, bh->total_block_bytes - CMP_BLOCK_CRC_START_OFFSET_m13);  // combine block CRC with body CRC
-
-		bh = (CMP_FIXED_BH_m13 *) ((ui1 *) bh + bh->total_block_bytes);
-	}
+	// block CRCs, & the CRC of all the blocks' bytes (large data split across worker threads)
+	memset((void *) &data, 0, sizeof(CRC_SPAN_m13));
+	data.ptr = (ui1 *) fps->ts_data;
+	data.n_blocks = fps->n_items;
+	data.calculate = TRUE_m13;
+	if (G_time_series_data_CRCs_parallel_m13(&data) == FALSE_m13)
+		return_m13(FALSE_m13);
+	uh->body_CRC = CRC_combine_m13(uh->body_CRC, data.crc, data.n_bytes);  // combine blocks' CRC with body CRC
 	
 	return_m13(TRUE_m13);
 }
@@ -2814,6 +3287,59 @@ tern	G_condition_timezone_info_m13(TIMEZONE_INFO_m13 *tz_info)
 }
 
 
+static ui1	*G_convert_samples_m13(si4 *src, si8 n, ui1 *dest, ui8 dest_type, si8 dest_stride, sf8 scale)
+{
+	ui1	out_type, el_size;
+	si2	*si2_p;
+	si4	*si4_p;
+	sf4	*sf4_p;
+	sf8	*sf8_p;
+	
+	// no FT frame: called per block
+	// converts as the DM matrix fill does (round for integers, cast for floats, both from sf8), every dest_stride'th element,
+	// scaling first (scale != 1.0) as the native units conversion does; returns the next destination element
+	// (an unusable scale - not finite, or the 0.0 "no entry" factor - converts unscaled, as the native units path does)
+	
+	if (isfinite(scale) == 0 || scale == (sf8) 0.0)
+		scale = (sf8) 1.0;
+	switch (dest_type) {
+		case DM_TYPE_SI2_m13: out_type = CMP_SI2_TYPE_m13; el_size = sizeof(si2); break;
+		case DM_TYPE_SI4_m13: out_type = CMP_SI4_TYPE_m13; el_size = sizeof(si4); break;
+		case DM_TYPE_SF4_m13: out_type = CMP_SF4_TYPE_m13; el_size = sizeof(sf4); break;
+		case DM_TYPE_SF8_m13: out_type = CMP_SF8_TYPE_m13; el_size = sizeof(sf8); break;
+		default: return(dest);
+	}
+	if (dest_stride == 1) {  // contiguous (channel major): fused vector conversion
+		CMP_si4_to_type_m13(src, (void *) dest, n, out_type, scale);
+		return(dest + (n * el_size));
+	}
+	
+	// strided (sample major)
+	if (scale != (sf8) 1.0)  // native units (in place: src is CPS scratch)
+		CMP_si4_to_type_m13(src, (void *) src, n, CMP_SI4_TYPE_m13, scale);
+	switch (out_type) {
+		case CMP_SI2_TYPE_m13:
+			for (si2_p = (si2 *) dest; n--; si2_p += dest_stride)
+				*si2_p = CMP_round_si2_m13((sf8) *src++);
+			return((ui1 *) si2_p);
+		case CMP_SI4_TYPE_m13:
+			for (si4_p = (si4 *) dest; n--; si4_p += dest_stride)
+				*si4_p = CMP_round_si4_m13((sf8) *src++);
+			return((ui1 *) si4_p);
+		case CMP_SF4_TYPE_m13:
+			for (sf4_p = (sf4 *) dest; n--; sf4_p += dest_stride)
+				*sf4_p = (sf4) *src++;
+			return((ui1 *) sf4_p);
+		case CMP_SF8_TYPE_m13:
+			for (sf8_p = (sf8 *) dest; n--; sf8_p += dest_stride)
+				*sf8_p = (sf8) *src++;
+			return((ui1 *) sf8_p);
+	}
+	
+	return(dest);
+}
+
+
 static void	G_copy_password_data_m13(UH_m13 *dst, const UH_m13 *src)
 {
 	// Stamp the session's single established schema-1 password data onto a file's universal header during a re-key.
@@ -3125,6 +3651,203 @@ si4  G_days_in_month_m13(si4 month, si4 year)
 }
 
 
+si8	G_decode_time_series_data_m13(SEG_m13 *seg, void *dest, ui8 dest_type, si8 dest_stride)
+{
+	tern				scale, direct;
+	ui1				*dest_p;
+	ui4				block_samples;
+	si4				*si4_p, *chunk_buf, n_runs, chunk_runs;
+	ui8				file_UID, saved_flags;
+	si8				j, k, n, n_samps, terminal_ts_ind, start_block, end_block, local_start_idx, local_end_idx, seg_start_samp_num, first, last;
+	si8				chunk_blocks, chunk_samples;
+	sf8				scale_factor;
+	CMP_DECODE_RUN_m13		range;
+	FPS_m13				*tsd_fps;
+	TS_IDX_m13			*tsi;
+	TS_METADATA_SECTION_2_m13	*tmd2;
+	CMP_FIXED_BH_m13		*bh;
+	CPS_m13				*cps;
+	SLICE_m13			*slice;
+	
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+	
+	// Completes a deferred read (LH_DEFER_TS_DECODE_m13): decodes the segment slice straight into dest as dest_type, one element
+	// every dest_stride elements (e.g. a sample major matrix row). Whole si4 blocks with nothing to convert decode in place; the
+	// rest pass through one block of CPS scratch. With LH_THREAD_BLOCK_DECODE_m13 the interior blocks are decoded in parallel
+	// (CMP_decode_runs_m13()) in chunks, in place or through bounded chunk scratch. dest == NULL decodes into the CPS as the
+	// read would have without the flag. A segment that was not deferred is converted from its decoded samples.
+	// returns samples written, FALSE_m13 on failure
+
+	if (seg == NULL) {
+		G_set_error_m13(E_GEN_m13, "segment structure is null");
+		return_m13(FALSE_m13);
+	}
+	if ((tsd_fps = seg->ts_data_fps) == NULL) {
+		G_set_error_m13(E_GEN_m13, "time series data FPS is null");
+		return_m13(FALSE_m13);
+	}
+	if ((cps = tsd_fps->params.cps) == NULL) {
+		G_set_error_m13(E_GEN_m13, "time series data has not been read");
+		return_m13(FALSE_m13);
+	}
+	slice = &seg->slice;
+	
+	// already decoded
+	if (cps->params.decode_deferred != TRUE_m13) {
+		n_samps = SLICE_IDX_COUNT_S_m13(seg->slice);
+		if (dest)
+			G_convert_samples_m13(cps->decompressed_data, n_samps, (ui1 *) dest, dest_type, dest_stride, (sf8) 1.0);
+		return_m13(n_samps);
+	}
+	
+	// decode into CPS (read again: the CPS holds one block of scratch)
+	if (dest == NULL) {
+		saved_flags = seg->flags;
+		seg->flags &= ~LH_DEFER_TS_DECODE_m13;
+		n_samps = G_read_time_series_data_m13(seg, slice);
+		seg->flags = saved_flags;
+		return_m13(n_samps);
+	}
+	
+	// find start and end blocks (as G_read_time_series_data_m13())
+	tsi = seg->ts_inds_fps->ts_inds;
+	tmd2 = &seg->metadata_fps->metadata->time_series_section_2;
+	seg_start_samp_num = tmd2->session_start_sample_number;
+	start_block = G_find_index_m13(seg, slice->start_samp_num, INDEX_SEARCH_m13);
+	if (start_block < 0) {  // before first block
+		start_block = 0;
+		local_start_idx = 0;
+	} else {
+		local_start_idx = slice->start_samp_num - seg_start_samp_num;
+	}
+	terminal_ts_ind = seg->ts_inds_fps->uh->n_entries - 1;
+	end_block = G_find_index_m13(seg, slice->end_samp_num, INDEX_SEARCH_m13);
+	if (end_block == terminal_ts_ind) {  // after last block (points to terminal index)
+		local_end_idx = tsi[end_block].start_samp_num - 1;
+		end_block = terminal_ts_ind - 1;
+	} else {
+		local_end_idx = slice->end_samp_num - seg_start_samp_num;
+	}
+	
+	file_UID = (globals_m13->miscellaneous.block_cache_bytes > 0 || globals_m13->miscellaneous.shared_block_cache_bytes > 0) ? tsd_fps->uh->file_UID : UID_NO_ENTRY_m13;
+
+	scale = FALSE_m13;
+	scale_factor = (sf8) 1.0;
+	if (cps->direcs.flags & CPS_DF_CONVERT_TO_NATIVE_UNITS_m13) {
+		scale_factor = tmd2->amplitude_units_conversion_factor;
+		if (isfinite(scale_factor) && scale_factor != 1.0 && scale_factor != TS_METADATA_AMPLITUDE_UNITS_CONVERSION_FACTOR_NO_ENTRY_m13)
+			scale = TRUE_m13;
+		else
+			scale_factor = (sf8) 1.0;  // no usable factor: unscaled (scale_factor is passed to G_convert_samples_m13() either way)
+	}
+	
+	// block-parallel decode of the interior blocks (as G_read_time_series_data_m13(); the first & last blocks carry the limits)
+	n_runs = 0;
+	if (seg->flags & LH_THREAD_BLOCK_DECODE_m13) {
+		n_runs = globals_m13->tables->HW_params.logical_cores;
+		if (n_runs > (end_block - start_block - 1) / CMP_DECODE_RUN_MIN_BLOCKS_m13)
+			n_runs = (si4) ((end_block - start_block - 1) / CMP_DECODE_RUN_MIN_BLOCKS_m13);
+		if (n_runs < 2)
+			n_runs = 0;
+		else if (PROC_default_threading_m13(seg) != TRUE_m13)
+			n_runs = 0;
+	}
+	chunk_blocks = (si8) n_runs * CMP_DECODE_RUN_CHUNK_BLOCKS_m13;
+	chunk_buf = NULL;  // allocated on the first chunk that is converted
+
+	// loop over blocks (whole blocks are decoded - start & end limits are applied here)
+	CMP_update_CPS_pointers_m13(tsd_fps, CMP_RESET_BLOCK_HDR_PTR_m13 | CMP_RESET_DECOMPRESSED_PTR_m13);
+	cps->params.block_start_index = 0;
+	dest_p = (ui1 *) dest;
+	n_samps = 0;
+	for (j = start_block; j <= end_block; ++j) {
+		// parallel chunk: whole interior blocks, decoded in place if nothing is converted (as below), else into chunk scratch
+		if (n_runs && j > start_block && (n = end_block - j) >= 2 * CMP_DECODE_RUN_MIN_BLOCKS_m13) {
+			if (n > chunk_blocks)
+				n = chunk_blocks;
+			chunk_runs = (n / CMP_DECODE_RUN_MIN_BLOCKS_m13 < n_runs) ? (si4) (n / CMP_DECODE_RUN_MIN_BLOCKS_m13) : n_runs;
+			direct = (dest_type == DM_TYPE_SI4_m13 && dest_stride == 1 && scale == FALSE_m13) ? TRUE_m13 : FALSE_m13;
+			chunk_samples = 0;
+			for (bh = cps->block_header, k = n; k--; bh = (CMP_FIXED_BH_m13 *) ((ui1 *) bh + bh->total_block_bytes)) {
+				chunk_samples += bh->number_of_samples;
+				if ((bh->block_flags & CMP_BF_ALGORITHMS_MASK_m13) == CMP_BF_VDS_ENCODING_m13)
+					direct = FALSE_m13;
+			}
+			if (chunk_samples > chunk_blocks * (si8) tmd2->maximum_block_samples) {
+				G_set_error_m13(E_CMP_m13, "block samples exceed segment maximum");
+				goto G_DECODE_TS_FAIL_m13;
+			}
+			if (direct == FALSE_m13 && chunk_buf == NULL) {
+				chunk_buf = (si4 *) malloc_m13((size_t) (chunk_blocks * (si8) tmd2->maximum_block_samples) * sizeof(si4));
+				if (chunk_buf == NULL)  // error set by malloc_m13()
+					goto G_DECODE_TS_FAIL_m13;
+			}
+			cps->decompressed_ptr = (direct == TRUE_m13) ? (si4 *) dest_p : chunk_buf;
+			memset((void *) &range, 0, sizeof(CMP_DECODE_RUN_m13));
+			range.skip_cached = FALSE_m13;
+			range.scale = FALSE_m13;  // converted with the samples below
+			range.n_blocks = n;
+			range.start_block_number = (si4) j;
+			range.block_end_index = 0xFFFFFFFF;
+			range.file_UID = file_UID;
+			if (CMP_decode_runs_m13(tsd_fps, &range, chunk_runs) == FALSE_m13)  // leaves the CPS at the block after the chunk
+				goto G_DECODE_TS_FAIL_m13;
+			if (direct == TRUE_m13) {
+				for (si4_p = (si4 *) dest_p, k = chunk_samples; k--; ++si4_p)
+					if (*si4_p < NEG_INF_SI4_m13)
+						*si4_p = NEG_INF_SI4_m13;
+				dest_p = (ui1 *) si4_p;
+			} else {
+				dest_p = G_convert_samples_m13(chunk_buf, chunk_samples, dest_p, dest_type, dest_stride, scale_factor);
+			}
+			n_samps += chunk_samples;
+			j += n - 1;
+			continue;
+		}
+		bh = cps->block_header;
+		block_samples = bh->number_of_samples;
+		first = (j == start_block) ? local_start_idx - tsi[j].start_samp_num : 0;
+		last = (j == end_block) ? local_end_idx - tsi[j].start_samp_num : (si8) block_samples - 1;
+		n = (last - first) + 1;
+		direct = FALSE_m13;
+		if (dest_type == DM_TYPE_SI4_m13 && dest_stride == 1 && scale == FALSE_m13 && n == (si8) block_samples)
+			if ((bh->block_flags & CMP_BF_ALGORITHMS_MASK_m13) != CMP_BF_VDS_ENCODING_m13)
+				direct = TRUE_m13;
+		cps->decompressed_ptr = (direct == TRUE_m13) ? (si4 *) dest_p : cps->params.cache;
+		if (CMP_block_cache_fetch_m13(cps, file_UID, j) == FALSE_m13) {
+			if (CMP_decode_m13(tsd_fps) == FALSE_m13)
+				goto G_DECODE_TS_FAIL_m13;
+			if (file_UID != UID_NO_ENTRY_m13)
+				CMP_block_cache_store_m13(file_UID, j, cps->decompressed_ptr, block_samples);
+		}
+		if (direct == TRUE_m13) {  // in place: only the si4 rounding (NaN => -inf) is left
+			for (si4_p = (si4 *) dest_p, k = n; k--; ++si4_p)
+				if (*si4_p < NEG_INF_SI4_m13)
+					*si4_p = NEG_INF_SI4_m13;
+			dest_p = (ui1 *) si4_p;
+		} else {
+			dest_p = G_convert_samples_m13(cps->decompressed_ptr + first, n, dest_p, dest_type, dest_stride, scale_factor);  // scale to native units & convert in one pass
+		}
+		n_samps += n;
+		CMP_update_CPS_pointers_m13(tsd_fps, CMP_UPDATE_BLOCK_HDR_PTR_m13);
+	}
+	cps->decompressed_ptr = cps->decompressed_data = cps->params.cache;  // scratch: decoded samples are in dest only
+	if (chunk_buf)
+		free_m13((void *) chunk_buf);
+
+	return_m13(n_samps);
+
+G_DECODE_TS_FAIL_m13:
+	cps->decompressed_ptr = cps->decompressed_data = cps->params.cache;
+	if (chunk_buf)
+		free_m13((void *) chunk_buf);
+
+	return_m13(FALSE_m13);
+}
+
+
 tern	G_decrypt_metadata_m13(FPS_m13 *fps)
 {
 	si1				*encryption_2, *encryption_3;
@@ -3269,7 +3992,8 @@ tern G_decrypt_time_series_m13(FPS_m13 *fps)
 {
 	static tern		warning_delivered = FALSE_m13;
 	si1			enc_level;
-	si8			i, encryption_bytes, encryptable_bytes, n_items;
+	ui1			*gather, *gp, *span;
+	si8			i, encryption_bytes, n_items, full_bytes, gather_bytes, n_leftovers;
 	CPS_m13			*cps;
 	CMP_FIXED_BH_m13	*bh;
 	PASSWORD_DATA_m13	*pwd;
@@ -3304,37 +4028,82 @@ tern G_decrypt_time_series_m13(FPS_m13 *fps)
 		return_m13(FALSE_m13);
 	}
 
-	// decrypt
+	// Batch decryption: a block's encrypted span is often only its header & one AES block, too few to fill the
+	// hardware pipeline (AES_HW_LANES_m13), so the whole AES blocks of every encrypted CMP block are gathered into
+	// one buffer & decrypted in a single call (one key selection, every AES block independent: ECB).
+	// A ciphertext-stealing tail (span not a multiple of 16 bytes) depends only on its own last 16 + n bytes of
+	// ciphertext, so it is finished per CMP block afterwards.
+	
+	// size gather buffer
 	bh = cps->block_header;
 	n_items = fps->n_items;
-	for (i = n_items; i--;) {
-
-		// check if block already decrypted
-		if (!(bh->block_flags & CMP_BF_ENCRYPTED_m13)) {
-			bh = (CMP_FIXED_BH_m13 *) ((ui1 *) bh + bh->total_block_bytes); // set pointer to next block
-			continue;
+	for (gather_bytes = 0, i = n_items; i--;) {
+		if (bh->block_flags & CMP_BF_ENCRYPTED_m13) {
+			encryption_bytes = G_block_encryption_bytes_m13(bh);
+			full_bytes = encryption_bytes & ~((si8) 0xF);
+			if ((encryption_bytes & (si8) 0xF) && full_bytes)
+				full_bytes -= ENCRYPTION_BLOCK_BYTES_m13;  // last full-block position holds the stolen block
+			gather_bytes += full_bytes;
+		}
+		bh = (CMP_FIXED_BH_m13 *) ((ui1 *) bh + bh->total_block_bytes); // set pointer to next block
+	}
+	gather = NULL;
+	if (gather_bytes) {
+		gather = (ui1 *) malloc((size_t) gather_bytes);
+		if (gather == NULL) {
+			G_set_error_m13(E_ALLOC_m13, NULL);
+			return_m13(FALSE_m13);
 		}
-
-		// calculate encryption bytes
-		encryptable_bytes = bh->total_block_bytes - CMP_BLOCK_ENCRYPTION_START_OFFSET_m13;
-		if (bh->block_flags & CMP_BF_MBE_ENCODING_m13) {  // MBE readable without other info (e.g. RED/PRED statistics) => encrypt full payload
-			encryption_bytes = encryptable_bytes;  // full 16 byte AES blocks after encryption start point; AES_encrypt/decrypt_m13() handle trailing partial block internally (AES_partial_encrypt/decrypt_m13())
-		} else {
-			encryption_bytes = (bh->total_header_bytes - CMP_BLOCK_ENCRYPTION_START_OFFSET_m13) + ENCRYPTION_BLOCK_BYTES_m13;
-			if (encryption_bytes > encryptable_bytes)
-				encryption_bytes = encryptable_bytes;
+	}
+	
+	// gather
+	bh = cps->block_header;
+	gp = gather;
+	for (i = n_items; i--;) {
+		if (bh->block_flags & CMP_BF_ENCRYPTED_m13) {
+			encryption_bytes = G_block_encryption_bytes_m13(bh);
+			full_bytes = encryption_bytes & ~((si8) 0xF);
+			if ((encryption_bytes & (si8) 0xF) && full_bytes)
+				full_bytes -= ENCRYPTION_BLOCK_BYTES_m13;
+			memcpy(gp, (ui1 *) bh + CMP_BLOCK_ENCRYPTION_START_OFFSET_m13, (size_t) full_bytes);
+			gp += full_bytes;
 		}
-
-		// decrypt
-		if (G_AES_crypt_m13(uh, pwd, enc_level, (ui1 *) bh + CMP_BLOCK_ENCRYPTION_START_OFFSET_m13, encryption_bytes, FALSE_m13) == FALSE_m13)
+		bh = (CMP_FIXED_BH_m13 *) ((ui1 *) bh + bh->total_block_bytes);
+	}
+	
+	// decrypt
+	if (gather_bytes) {
+		if (G_AES_crypt_m13(uh, pwd, enc_level, gather, gather_bytes, FALSE_m13) == FALSE_m13) {
+			free(gather);
 			return_m13(FALSE_m13);
-		
-		// mark block as decrypted
-		bh->block_flags &= ~CMP_BF_ENCRYPTED_m13;
-		
-		// set pointer to next block
+		}
+	}
+	
+	// scatter, finish stealing tails, & mark blocks as decrypted
+	bh = cps->block_header;
+	gp = gather;
+	for (i = n_items; i--;) {
+		if (bh->block_flags & CMP_BF_ENCRYPTED_m13) {
+			encryption_bytes = G_block_encryption_bytes_m13(bh);
+			n_leftovers = encryption_bytes & (si8) 0xF;
+			full_bytes = encryption_bytes - n_leftovers;
+			if (n_leftovers && full_bytes)
+				full_bytes -= ENCRYPTION_BLOCK_BYTES_m13;
+			span = (ui1 *) bh + CMP_BLOCK_ENCRYPTION_START_OFFSET_m13;
+			memcpy(span, gp, (size_t) full_bytes);
+			gp += full_bytes;
+			if (n_leftovers) {  // stolen block & trailing bytes (or a span shorter than one AES block: G_AES_crypt_m13() reports that)
+				if (G_AES_crypt_m13(uh, pwd, enc_level, span + full_bytes, encryption_bytes - full_bytes, FALSE_m13) == FALSE_m13) {
+					free(gather);
+					return_m13(FALSE_m13);
+				}
+			}
+			bh->block_flags &= ~CMP_BF_ENCRYPTED_m13;
+		}
 		bh = (CMP_FIXED_BH_m13 *) ((ui1 *) bh + bh->total_block_bytes);
 	}
+	if (gather)
+		free(gather);
 	
 	return_m13(TRUE_m13);
 }
@@ -3766,6 +4535,22 @@ static const si1	*G_error_chain_name_m13(pid_t_m13 _id)
 #endif  // FT_DEBUG_m13
 
 
+static si4	G_epoch_compare_m13(const void *a, const void *b)
+{
+	const EPOCH_SORT_m13	*ea, *eb;
+	
+	// start time, then caller order (qsort() is not stable)
+	ea = (const EPOCH_SORT_m13 *) a;
+	eb = (const EPOCH_SORT_m13 *) b;
+	if (ea->start_time != eb->start_time)
+		return((ea->start_time < eb->start_time) ? -1 : 1);
+	if (ea->epoch_idx != eb->epoch_idx)
+		return((ea->epoch_idx < eb->epoch_idx) ? -1 : 1);
+	
+	return(0);
+}
+
+
 void	G_error_clear_m13(void)
 {
 	ERROR_m13	*err;
@@ -4042,11 +4827,223 @@ si8	G_file_length_m13(void *fp, const si1 *path)
 }
 
 
+static si4	G_file_list_append_m13(const si1 *path, si1 **paths, si4 *n_paths, si4 *max_paths)
+{
+	si1	*new_paths;
+	
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// appends path to a flat expansion buffer (PATH_BYTES_m13 stride, doubled as needed)
+	// returns 1, or -1 on allocation failure
+	
+	if (*n_paths == *max_paths) {
+		*max_paths = (*max_paths) ? (*max_paths << 1) : 64;
+		new_paths = (si1 *) realloc_m13((void *) *paths, (si8) *max_paths * (si8) PATH_BYTES_m13);
+		if (new_paths == NULL) {
+			G_set_error_m13(E_ALLOC_m13, NULL);
+			return_m13(-1);
+		}
+		*paths = new_paths;
+	}
+	strcpy(*paths + ((si8) *n_paths * (si8) PATH_BYTES_m13), path);  // callers bound path to PATH_BYTES_m13
+	++(*n_paths);
+
+	return_m13(1);
+}
+
+
+static si4	G_file_list_expand_m13(const si1 *pattern, si1 **paths, si4 *n_paths, si4 *max_paths)
+{
+#if defined MACOS_m13 || defined LINUX_m13
+	si1		path[PATH_BYTES_m13], word[PATH_BYTES_m13];
+	const si1	*c, *open_brace, *close_brace, *alt;
+	si4		depth, n_matched, r, prefix_len, alt_len;
+	tern		has_comma;
+
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// in-process shell name expansion of one pattern: braces, then "*", "?" & "[...]" per path component
+	// returns number of paths appended, or -1 on allocation failure
+	
+	// find first brace group with a top level comma (a brace group without one is literal, as in the shell)
+	open_brace = close_brace = NULL;
+	for (c = pattern; *c; ++c) {
+		if (*c == '\\' && c[1]) {
+			++c;
+			continue;
+		}
+		if (*c != '{')
+			continue;
+		depth = 0;
+		has_comma = FALSE_m13;
+		for (close_brace = c; *close_brace; ++close_brace) {
+			if (*close_brace == '\\' && close_brace[1]) {
+				++close_brace;
+			} else if (*close_brace == '{') {
+				++depth;
+			} else if (*close_brace == '}') {
+				if (--depth == 0)
+					break;
+			} else if (*close_brace == ',' && depth == 1) {
+				has_comma = TRUE_m13;
+			}
+		}
+		if (*close_brace && has_comma == TRUE_m13) {
+			open_brace = c;
+			break;
+		}
+		close_brace = NULL;
+	}
+	
+	// no brace expansion: match path components
+	if (open_brace == NULL) {
+		*path = 0;
+		return_m13(G_file_list_match_m13(path, 0, pattern, paths, n_paths, max_paths));
+	}
+	
+	// expand each alternative (recursively, for nested & subsequent groups)
+	prefix_len = (si4) (open_brace - pattern);
+	n_matched = 0;
+	for (alt = c = open_brace + 1, depth = 0; c <= close_brace; ++c) {
+		if (*c == '\\' && c[1]) {
+			++c;
+			continue;
+		}
+		if (*c == '{') {
+			++depth;
+			continue;
+		}
+		if (*c == '}' && depth) {
+			--depth;
+			continue;
+		}
+		if ((*c == ',' && depth == 0) || c == close_brace) {
+			alt_len = (si4) (c - alt);
+			if (prefix_len + alt_len + strlen(close_brace + 1) < PATH_BYTES_m13) {
+				memcpy(word, pattern, (size_t) prefix_len);
+				memcpy(word + prefix_len, alt, (size_t) alt_len);
+				strcpy(word + prefix_len + alt_len, close_brace + 1);
+				if ((r = G_file_list_expand_m13(word, paths, n_paths, max_paths)) < 0)
+					return_m13(-1);
+				n_matched += r;
+			}
+			alt = c + 1;
+		}
+	}
+
+	return_m13(n_matched);
+#endif  // MACOS_m13 || LINUX_m13
+	
+	return(-1);
+}
+
+
+static si4	G_file_list_match_m13(si1 *path, si4 path_len, const si1 *pattern, si1 **paths, si4 *n_paths, si4 *max_paths)
+{
+#if defined MACOS_m13 || defined LINUX_m13
+	si1		component[PATH_BYTES_m13], *name;
+	const si1	*c;
+	si4		n_matched, r, component_len, name_len;
+	tern		is_glob, descend;
+	DIR		*dir;
+	struct dirent	*entry;
+	struct stat	sb;
+
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// path: working buffer (PATH_BYTES_m13) holding the already matched prefix (path_len bytes)
+	// pattern: remaining pattern components
+	// returns number of paths appended, or -1 on allocation failure
+	
+	// copy literal components straight through (no directory reads)
+	c = pattern;
+	while (1) {
+		while (*pattern == '/') {
+			if (path_len + 1 >= PATH_BYTES_m13)
+				return_m13(0);
+			path[path_len++] = *pattern++;
+		}
+		if (*pattern == 0)
+			break;
+		is_glob = FALSE_m13;
+		for (c = pattern; *c && *c != '/'; ++c)
+			if (*c == '*' || *c == '?' || *c == '[')
+				is_glob = TRUE_m13;
+		if (is_glob == TRUE_m13)
+			break;
+		component_len = (si4) (c - pattern);
+		if (path_len + component_len >= PATH_BYTES_m13)
+			return_m13(0);
+		memcpy(path + path_len, pattern, (size_t) component_len);
+		path_len += component_len;
+		pattern = c;
+	}
+	path[path_len] = 0;
+
+	// fully literal: listed if it exists (as "ls -d" does, a dangling link exists)
+	if (*pattern == 0) {
+		if (lstat(path, &sb))
+			return_m13(0);
+		return_m13(G_file_list_append_m13(path, paths, n_paths, max_paths));
+	}
+	
+	// glob component: match directory entries
+	component_len = (si4) (c - pattern);
+	memcpy(component, pattern, (size_t) component_len);
+	component[component_len] = 0;
+	descend = (*c == '/') ? TRUE_m13 : FALSE_m13;
+	dir = opendir((path_len) ? path : ".");
+	if (dir == NULL)
+		return_m13(0);
+	n_matched = 0;
+	while ((entry = readdir(dir))) {
+		name = entry->d_name;
+		if (*name == '.' && (name[1] == 0 || (name[1] == '.' && name[2] == 0)))  // never "." or ".."
+			continue;
+		if (fnmatch(component, name, FNM_PERIOD))  // FNM_PERIOD: leading '.' must be matched explicitly (shell rule)
+			continue;
+		name_len = (si4) strlen(name);
+		if (path_len + name_len >= PATH_BYTES_m13)
+			continue;
+		memcpy(path + path_len, name, (size_t) name_len + 1);
+		if (descend == TRUE_m13) {
+			// only directories can match further components; d_type answers that without a stat() on most file systems
+			if (entry->d_type != DT_DIR) {
+				if (entry->d_type != DT_LNK && entry->d_type != DT_UNKNOWN)
+					continue;
+				if (stat(path, &sb) || S_ISDIR(sb.st_mode) == 0)
+					continue;
+			}
+			r = G_file_list_match_m13(path, path_len + name_len, c, paths, n_paths, max_paths);
+		} else {
+			r = G_file_list_append_m13(path, paths, n_paths, max_paths);
+		}
+		if (r < 0) {
+			closedir(dir);
+			return_m13(-1);
+		}
+		n_matched += r;
+	}
+	closedir(dir);
+
+	return_m13(n_matched);
+#endif  // MACOS_m13 || LINUX_m13
+	
+	return(-1);
+}
+
+
 si1	**G_file_list_m13(si1 **file_list, si4 *n_files, const si1 *enclosing_directory, const si1 *name, const si1 *extension, ui4 flags)
 {
 	tern	regex;
 	si1	tmp_enclosing_directory[PATH_BYTES_m13], tmp_path[PATH_BYTES_m13];
-	si1	tmp_name[PATH_BYTES_m13], tmp_extension[16], tmp_ext[16], *buffer, *c, *c2;
+	si1	tmp_name[PATH_BYTES_m13], tmp_extension[PATH_BYTES_m13], tmp_ext[PATH_BYTES_m13];  // extensions may be brace or glob patterns
 	si1	**tmp_ptr_ptr;
 	ui4	path_parts;
 	si4	i, j, n_in_files, *n_out_files;
@@ -4155,80 +5152,55 @@ si1	**G_file_list_m13(si1 **file_list, si4 *n_files, const si1 *enclosing_direct
 			regex = TRUE_m13;
 	}
 
-	// expand regex (use system shell to expand regex)
+	// expand regex
 	if (regex == TRUE_m13) {
 
 	#if defined MACOS_m13 || defined LINUX_m13
-		si1		*command;
-		si4		r_val;
-		size_t		len;
-
-		len = n_in_files * PATH_BYTES_m13;
-		if (flags & GFL_INCLUDE_INVISIBLE_m13)
-			len <<= 1;
-		len += 16;
-		command = (si1 *) malloc((size_t) len);
-		if (command == NULL) {
-			G_set_error_m13(E_ALLOC_m13, NULL);
-			return_m13(NULL);
-		}
-		#ifdef MACOS_m13
-		strcpy(command, "/bin/ls -1d");
-		#endif
-		#ifdef LINUX_m13
-		strcpy(command, "/usr/bin/ls -1d");
-		#endif
+		// expanded in process, as the shell & "ls -1d" would (no fork/exec, no shell quoting of paths)
+		si1		*paths, invisible_pattern[PATH_BYTES_m13];
+		si4		n_paths, max_paths, r_val;
+
+		paths = NULL;
+		n_paths = max_paths = 0;
 		for (i = 0; i < n_in_files; ++i) {
-			STR_escape_chars_m13(file_list[i], (si1) 0x20, PATH_BYTES_m13);  // escape spaces
-			STR_escape_chars_m13(file_list[i], (si1) 0x27, PATH_BYTES_m13);  // escape apostrophes
-			STR_escape_chars_m13(file_list[i], (si1) 0x60, PATH_BYTES_m13);  // escape grave accent
-			len = sprintf_m13(command, "%s %s", command, file_list[i]);
-			if (flags & GFL_INCLUDE_INVISIBLE_m13) {
-				G_path_parts_m13(file_list[i], NULL, (si1 *) name, (si1 *) extension);
-				len = sprintf_m13(command, "%s %s/.%s", command, enclosing_directory, name);  // explicitly include hidden files & directories with a prepended "."
-				if (*extension)
-					len = sprintf_m13(command, "%s.%s", command, extension);
+			r_val = G_file_list_expand_m13(file_list[i], &paths, &n_paths, &max_paths);
+			if (r_val <= 0)  // an unmatched pattern fails the whole list (as "ls" exits with an error)
+				break;
+			if (flags & GFL_INCLUDE_INVISIBLE_m13) {  // also match names with a prepended "." (optional)
+				G_path_parts_m13(file_list[i], tmp_path, tmp_name, tmp_ext);
+				if (strlen(tmp_path) + strlen(tmp_name) + strlen(tmp_ext) + 4 > PATH_BYTES_m13)  // "/." + "." + terminal zero
+					continue;  // no room for the invisible form of this pattern
+				if (*tmp_ext)
+					sprintf_m13(invisible_pattern, "%s/.%s.%s", tmp_path, tmp_name, tmp_ext);
+				else
+					sprintf_m13(invisible_pattern, "%s/.%s", tmp_path, tmp_name);
+				if ((r_val = G_file_list_expand_m13(invisible_pattern, &paths, &n_paths, &max_paths)) < 0)
+					break;
 			}
 		}
 		free_2D_m13((void **) file_list, n_in_files);
-
-		buffer = NULL;
-		r_val = system_pipe_m13(&buffer, 0, command, (SP_BEHAVIOR_PASSED_m13 | SP_SEPARATE_STREAMS_m13), RETURN_QUIETLY_m13, NULL, 0);  // pass NULL error buffer because don't actually want error output
-		free(command);
-		if (r_val || buffer == NULL) {
-			if (buffer)
-				free_m13(buffer);
+		if (i < n_in_files || n_paths == 0) {
+			if (paths)
+				free_m13((void *) paths);
 			*n_out_files = 0;
 			return_m13(NULL);
 		}
-
-		// count expanded file list
-		c = buffer;
-		*n_out_files = 0;
-		while (*c++) {
-			if (*c == '\n')
-				++(*n_out_files);
-		}
-		if (*n_out_files == 0) {
-			free_m13(buffer);
-			return_m13(NULL);
-		}
-
-		// re-allocate
-		file_list = (si1 **) calloc_2D_m13((size_t) *n_out_files, PATH_BYTES_m13, sizeof(si1));
 		
-		// build file list
-		c = buffer;
-		for (i = 0; i < *n_out_files; ++i) {
-			c2 = file_list[i];
-			while (*c != '\n')
-				*c2++ = *c++;
-			*c2 = 0;
-			++c;
+		// re-allocate
+		*n_out_files = n_paths;
+		file_list = (si1 **) calloc_2D_m13((size_t) n_paths, PATH_BYTES_m13, sizeof(si1));
+		if (file_list == NULL) {  // error set by calloc_2D_m13()
+			free_m13((void *) paths);
+			*n_out_files = 0;
+			return_m13(NULL);
 		}
+		memcpy((void *) file_list[0], (void *) paths, (size_t) n_paths * PATH_BYTES_m13);
+		free_m13((void *) paths);
 	#endif  // MACOS_m13 || LINUX_m13
 		
 	#ifdef WINDOWS_m13
+		si1	*buffer, *c, *c2;
+
 		buffer = NULL;
 		*n_out_files = WN_ls_1d_to_buf_m13(file_list, n_in_files, TRUE_m13, &buffer);
 		free_m13(file_list);
@@ -4251,9 +5223,8 @@ si1	**G_file_list_m13(si1 **file_list, si4 *n_files, const si1 *enclosing_direct
 				++c;
 			++c;
 		}
-	#endif  // WINDOWS_m13
-		
 		free_m13(buffer);
+	#endif  // WINDOWS_m13
 	}
 
 GFL_CONDITION_RETURN_DATA_m13:
@@ -5292,6 +6263,38 @@ tern	G_free_channel_m13(void *ptr)
 }
 
 
+tern	G_free_epochs_m13(EPOCHS_m13 **epochs_ptr)
+{
+	EPOCHS_m13	*epochs;
+	
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// pass EPOCHS_m13 ** (set to NULL); the channels belong to the session & are not freed
+	
+	if (epochs_ptr == NULL) {
+		G_set_error_m13(E_GEN_m13, "pointer is null");
+		return_m13(FALSE_m13);
+	}
+	if ((epochs = *epochs_ptr) == NULL)
+		return_m13(TRUE_m13);
+	
+	if (epochs->chans)
+		free_m13(epochs->chans);
+	if (epochs->samples)
+		free_m13(epochs->samples);
+	if (epochs->start_samp_nums)
+		free_m13(epochs->start_samp_nums);
+	if (epochs->sample_counts)
+		free_m13(epochs->sample_counts);
+	free_m13(epochs);
+	*epochs_ptr = NULL;
+
+	return_m13(TRUE_m13);
+}
+
+
 void	G_free_global_tables_m13(void)
 {
 	GLOBAL_TABLES_m13	*tables;
@@ -5358,6 +6361,8 @@ void	G_free_globals_m13(tern cleanup_for_exit)
 	}
 	
 	CMP_free_buffer_depot_m13();  // release pooled checkout/return scratch bundles
+	CMP_free_block_cache_m13();  // release cached decoded blocks
+	CMP_free_shm_cache_m13();  // detach from the shared block cache (segment persists)
 
 	pthread_mutex_lock_m13(&globals_m13->mutex);
 	globals_m13->miscellaneous.suspend_stacks = TRUE_m13;
@@ -5382,6 +6387,8 @@ void	G_free_globals_m13(tern cleanup_for_exit)
 		for (i = 0; i < list_size; i += GLOBALS_FLOCK_LIST_SIZE_INCREMENT_m13)
 			free(lock_ptrs[i]);
 		free(lock_ptrs);
+		for (i = 0; i < FLOCK_LIST_SHARDS_m13; ++i)
+			pthread_mutex_destroy_m13(&globals_m13->file_lock_list->shard_mutexes[i]);
 		pthread_mutex_destroy_m13(&globals_m13->file_lock_list->mutex);
 		free(globals_m13->file_lock_list);
 	}
@@ -5457,6 +6464,23 @@ void	G_free_globals_m13(tern cleanup_for_exit)
 }
 
 
+void	G_free_overview_m13(OVW_m13 *ovw)
+{
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	if (ovw == NULL)
+		return_void_m13;
+	
+	if (ovw->data)
+		free_m13((void *) ovw->data);
+	free_m13((void *) ovw);
+	
+	return_void_m13;
+}
+
+
 tern	G_free_segment_m13(void *ptr)
 {
 	ui4		type_code;
@@ -5503,6 +6527,10 @@ tern	G_free_segment_m13(void *ptr)
 		FPS_free_m13(seg->rec_inds_fps);
 	if (seg->contigua)
 		free_m13(seg->contigua);
+	if (seg->overview)
+		G_free_overview_m13(seg->overview);
+	if (seg->zone_map)
+		G_free_zone_map_m13(seg->zone_map);
 	
 	// delete process globals
 	if (seg->proc_globs)
@@ -5527,6 +6555,8 @@ tern	G_free_session_m13(void *ptr)
 	si4		i;
 	SESS_m13 	*sess, **sess_ptr;
 	CHAN_m13	*chan;
+	PROC_GLOBS_m13	*pg;
+	SESS_MNFST_m13	*mnfst;
 	
 #ifdef FT_DEBUG_m13
 	G_push_function_m13();
@@ -5587,6 +6617,18 @@ tern	G_free_session_m13(void *ptr)
 	if (sess->contigua)
 		free_m13(sess->contigua);
 
+	// session manifest: rebuild if absent or out of date (before the process globals holding it are deleted)
+	if (globals_m13->miscellaneous.session_manifest == TRUE_m13 && (sess->flags & LH_SESS_OPEN_m13)) {
+		pg = G_proc_globs_find_m13((LH_m13 *) sess);
+		if (pg) {
+			mnfst = pg->current_session.manifest;
+			if (mnfst == NULL)
+				G_write_session_manifest_m13(sess);
+			else if (mnfst->stale == TRUE_m13 || mnfst->header->n_segments != pg->current_session.n_segments)
+				G_write_session_manifest_m13(sess);
+		}
+	}
+
 	// delete process globals
 	if (sess->proc_globs)
 		G_proc_globs_delete_m13((LH_m13 *) sess->proc_globs);
@@ -5604,6 +6646,23 @@ tern	G_free_session_m13(void *ptr)
 }
 
 
+void	G_free_session_manifest_m13(SESS_MNFST_m13 *mnfst)
+{
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	if (mnfst == NULL)
+		return_void_m13;
+	
+	if (mnfst->data)
+		free_m13((void *) mnfst->data);
+	free_m13((void *) mnfst);
+
+	return_void_m13;
+}
+
+
 tern	G_free_ssr_m13(void *ptr)
 {
 	ui4			type_code;
@@ -5674,6 +6733,23 @@ tern	G_free_ssr_m13(void *ptr)
 }
 
 
+void	G_free_zone_map_m13(ZMAP_m13 *zmap)
+{
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	if (zmap == NULL)
+		return_void_m13;
+	
+	if (zmap->data)
+		free_m13((void *) zmap->data);
+	free_m13((void *) zmap);
+	
+	return_void_m13;
+}
+
+
 tern	G_full_path_m13(const si1 *path, si1 *full_path)
 {
 	tern	contains_formatting, from_root, modify_path;
@@ -5934,14 +7010,15 @@ si1	**G_generate_numbered_names_m13(si1 **names, const si1 *prefix, si4 n_names)
 tern	G_generate_password_data_m13(FPS_m13 *fps, const si1 *L1_pw, const si1 *L2_pw, const si1 *L3_pw, const si1 *L1_pw_hint, const si1 *L2_pw_hint, ui1 lib_generated_mask, tern check_policy)
 {
 	PASSWORD_DATA_m13	*pwd;
-	ui1			hash[SHA_HASH_BYTES_m13], dk[SHA_HASH_BYTES_m13], salt[CRYPTO_KDF_SALT_BYTES_m13];
+	ui1			hash[SHA_HASH_BYTES_m13], salt[CRYPTO_KDF_SALT_BYTES_m13];
+	ui1			L1_dk[SHA_HASH_BYTES_m13], L2_dk[SHA_HASH_BYTES_m13], L3_dk[SHA_HASH_BYTES_m13];
 	ui1			L1_master[CRYPTO_MASTER_BYTES_m13], L2_master[CRYPTO_MASTER_BYTES_m13], L3_master[CRYPTO_MASTER_BYTES_m13];
 	ui1			chain_material[SHA_HASH_BYTES_m13], escrow_key[SHA_HASH_BYTES_m13];
 	si1			L1_pw_bytes[PASSWORD_BYTES_m13] = { 0 }, L2_pw_bytes[PASSWORD_BYTES_m13] = { 0 }, L3_pw_bytes[PASSWORD_BYTES_m13] = { 0 };
 	si1			*top_pw_bytes;
 	tern			shared_L1_L2_pw;
-	si4			i;
-	ui4			iterations;
+	si4			i, n_kdf_lanes;
+	SHA_PBKDF2_LANE_m13	kdf_lanes[3];
 	PROC_GLOBS_m13	*pg;
 	METADATA_SECTION_1_m13	*md1;
 	UH_m13	*uh;
@@ -6055,10 +7132,9 @@ tern	G_generate_password_data_m13(FPS_m13 *fps, const si1 *L1_pw, const si1 *L2_
 		}
 	}
 	G_build_kdf_salt_m13(uh, salt);
-	iterations = (ui4) 1 << uh->kdf_exponent[0];  // level 1
 	pwd->crypto_schema = uh->crypto_schema;
 
-	// user passed level 1 password: generate validation field and encryption keys
+	// user passed level 1 password
 	if (check_policy == TRUE_m13 && G_check_new_password_m13(L1_pw, 1, ((lib_generated_mask >> 0) & 1) ? TRUE_m13 : FALSE_m13) == FALSE_m13)  // creation-time policy (skipped for re-keyed legacy passwords)
 		return_m13(FALSE_m13);
 	if (G_condition_password_m13(L1_pw, L1_pw_bytes, uh->crypto_schema) == FALSE_m13)
@@ -6067,24 +7143,14 @@ tern	G_generate_password_data_m13(FPS_m13 *fps, const si1 *L1_pw, const si1 *L2_
 	// passed a level 1 password - at least level 1 access
 	pwd->access_level = LEVEL_1_ACCESS_m13;
 
-	// derive level 1 master secret (slow by design: KDF iterations multiply the cost of each password guess)
-	SHA_pbkdf2_m13((ui1 *) L1_pw_bytes, PASSWORD_BYTES_m13, salt, CRYPTO_KDF_SALT_BYTES_m13, iterations, dk);
-	memcpy(L1_master, dk, CRYPTO_MASTER_BYTES_m13);
+	// level 1 master secret lane (slow by design: KDF iterations multiply the cost of each password guess)
+	memset(kdf_lanes, 0, sizeof(kdf_lanes));
+	n_kdf_lanes = 0;
+	kdf_lanes[n_kdf_lanes].pw = (ui1 *) L1_pw_bytes;
+	kdf_lanes[n_kdf_lanes].iterations = (ui4) 1 << uh->kdf_exponent[0];
+	kdf_lanes[n_kdf_lanes++].dk = L1_dk;
 
-	// generate Level 1 password validation field (independent HMAC branch: field reveals nothing about key material)
-	SHA_hmac_m13(L1_master, CRYPTO_MASTER_BYTES_m13, (ui1 *) CRYPTO_VALIDATE_STRING_m13, (si8) strlen(CRYPTO_VALIDATE_STRING_m13), hash);
-	memcpy(uh->level_1_password_validation_field, hash, PASSWORD_VALIDATION_FIELD_BYTES_m13);
-
-	// generate encryption keys (AES-256 for this schema; legacy AES-128 also kept for reading legacy-schema files in the same session)
-	// decryption schedules derived alongside: built once here, consumed directly by every subsequent decrypt (files are write-once, read-many)
-	SHA_hmac_m13(L1_master, CRYPTO_MASTER_BYTES_m13, (ui1 *) CRYPTO_ENCRYPT_STRING_m13, (si8) strlen(CRYPTO_ENCRYPT_STRING_m13), hash);
-	AES_key_expansion_256_m13(pwd->level_1_encryption_key_256, hash);
-	AES_inv_key_schedule_m13(pwd->level_1_decryption_key_256, pwd->level_1_encryption_key_256, AES_NR_256_m13);
-	AES_key_expansion_m13(pwd->level_1_encryption_key, L1_pw_bytes);
-	AES_inv_key_schedule_m13(pwd->level_1_decryption_key, pwd->level_1_encryption_key, AES_NR_m13);
-	pwd->level_1_legacy_key_valid = TRUE_m13;
-
-	// user also passed level 2 password: generate validation field and encryption keys
+	// user also passed level 2 password
 	// level 2 encryption requires a level 1 password, even if level 1 encryption is not used
 	if (L2_pw) {
 		if (check_policy == TRUE_m13 && G_check_new_password_m13(L2_pw, 2, ((lib_generated_mask >> 1) & 1) ? TRUE_m13 : FALSE_m13) == FALSE_m13)
@@ -6101,12 +7167,64 @@ tern	G_generate_password_data_m13(FPS_m13 *fps, const si1 *L1_pw, const si1 *L2_
 		if (uh->kdf_exponent[1] == 0)
 			uh->kdf_exponent[1] = CRYPTO_KDF_EXPONENT_DEFAULT_m13;
 		uh->kdf_exponent[1] = G_clamp_kdf_exponent_m13((si4) uh->kdf_exponent[1], ((lib_generated_mask >> 1) & 1) ? TRUE_m13 : FALSE_m13);
-		iterations = (ui4) 1 << uh->kdf_exponent[1];
 
-		// derive level 2 master secret
-		SHA_pbkdf2_m13((ui1 *) L2_pw_bytes, PASSWORD_BYTES_m13, salt, CRYPTO_KDF_SALT_BYTES_m13, iterations, dk);
-		memcpy(L2_master, dk, CRYPTO_MASTER_BYTES_m13);
+		// level 2 master secret lane (a shared password at the shared exponent is the level 1 derivation: copied below)
+		if (shared_L1_L2_pw == FALSE_m13) {
+			kdf_lanes[n_kdf_lanes].pw = (ui1 *) L2_pw_bytes;
+			kdf_lanes[n_kdf_lanes].iterations = (ui4) 1 << uh->kdf_exponent[1];
+			kdf_lanes[n_kdf_lanes++].dk = L2_dk;
+		}
+	}
+
+	// user also passed level 3 password for recovery
+	if (L3_pw) {
+		if (check_policy == TRUE_m13 && G_check_new_password_m13(L3_pw, 3, ((lib_generated_mask >> 2) & 1) ? TRUE_m13 : FALSE_m13) == FALSE_m13)
+			return_m13(FALSE_m13);
+		if (G_condition_password_m13(L3_pw, L3_pw_bytes, uh->crypto_schema) == FALSE_m13)
+			return_m13(FALSE_m13);
 
+		// level 3 KDF exponent: defaulted & source-floored independently (the DHN machine L3 gets the low
+		// generated floor here even when L1/L2 are human - that is the whole point of the per-level split)
+		if (uh->kdf_exponent[2] == 0)
+			uh->kdf_exponent[2] = CRYPTO_KDF_EXPONENT_DEFAULT_m13;
+		uh->kdf_exponent[2] = G_clamp_kdf_exponent_m13((si4) uh->kdf_exponent[2], ((lib_generated_mask >> 2) & 1) ? TRUE_m13 : FALSE_m13);
+
+		// level 3 master secret lane
+		kdf_lanes[n_kdf_lanes].pw = (ui1 *) L3_pw_bytes;
+		kdf_lanes[n_kdf_lanes].iterations = (ui4) 1 << uh->kdf_exponent[2];
+		kdf_lanes[n_kdf_lanes++].dk = L3_dk;
+	}
+
+	// derive the master secrets: the levels' derivations are independent, so they run at once (one per core where
+	// available, interleaved otherwise) & creation costs the slowest level rather than the sum of all of them
+	for (i = 0; i < n_kdf_lanes; ++i) {
+		kdf_lanes[i].pw_bytes = PASSWORD_BYTES_m13;
+		kdf_lanes[i].salt = salt;
+		kdf_lanes[i].salt_bytes = CRYPTO_KDF_SALT_BYTES_m13;
+	}
+	if (SHA_pbkdf2_lanes_m13(kdf_lanes, n_kdf_lanes) == FALSE_m13)
+		return_m13(FALSE_m13);
+	memcpy(L1_master, L1_dk, CRYPTO_MASTER_BYTES_m13);
+	if (L2_pw)
+		memcpy(L2_master, (shared_L1_L2_pw == TRUE_m13) ? L1_dk : L2_dk, CRYPTO_MASTER_BYTES_m13);
+	if (L3_pw)
+		memcpy(L3_master, L3_dk, CRYPTO_MASTER_BYTES_m13);
+
+	// generate Level 1 password validation field (independent HMAC branch: field reveals nothing about key material)
+	SHA_hmac_m13(L1_master, CRYPTO_MASTER_BYTES_m13, (ui1 *) CRYPTO_VALIDATE_STRING_m13, (si8) strlen(CRYPTO_VALIDATE_STRING_m13), hash);
+	memcpy(uh->level_1_password_validation_field, hash, PASSWORD_VALIDATION_FIELD_BYTES_m13);
+
+	// generate encryption keys (AES-256 for this schema; legacy AES-128 also kept for reading legacy-schema files in the same session)
+	// decryption schedules derived alongside: built once here, consumed directly by every subsequent decrypt (files are write-once, read-many)
+	SHA_hmac_m13(L1_master, CRYPTO_MASTER_BYTES_m13, (ui1 *) CRYPTO_ENCRYPT_STRING_m13, (si8) strlen(CRYPTO_ENCRYPT_STRING_m13), hash);
+	AES_key_expansion_256_m13(pwd->level_1_encryption_key_256, hash);
+	AES_inv_key_schedule_m13(pwd->level_1_decryption_key_256, pwd->level_1_encryption_key_256, AES_NR_256_m13);
+	AES_key_expansion_m13(pwd->level_1_encryption_key, L1_pw_bytes);
+	AES_inv_key_schedule_m13(pwd->level_1_decryption_key, pwd->level_1_encryption_key, AES_NR_m13);
+	pwd->level_1_legacy_key_valid = TRUE_m13;
+
+	// level 2: validation field and encryption keys
+	if (L2_pw) {
 		// generate Level 2 password validation field: chain material xor level 1 master
 		// (as in the legacy schema, level 2 validates transitively through the level 1 field, & the level 2 secret recovers the level 1 secret;
 		// masters chain rather than passwords, so cracking one level no longer yields the password of another)
@@ -6123,24 +7241,8 @@ tern	G_generate_password_data_m13(FPS_m13 *fps, const si1 *L1_pw, const si1 *L2_
 		pwd->level_2_legacy_key_valid = TRUE_m13;
 	}
 
-	// user also passed level 3 password for recovery: generate validation field
+	// level 3: validation field
 	if (L3_pw) {
-		if (check_policy == TRUE_m13 && G_check_new_password_m13(L3_pw, 3, ((lib_generated_mask >> 2) & 1) ? TRUE_m13 : FALSE_m13) == FALSE_m13)
-			return_m13(FALSE_m13);
-		if (G_condition_password_m13(L3_pw, L3_pw_bytes, uh->crypto_schema) == FALSE_m13)
-			return_m13(FALSE_m13);
-
-		// level 3 KDF exponent: defaulted & source-floored independently (the DHN machine L3 gets the low
-		// generated floor here even when L1/L2 are human - that is the whole point of the per-level split)
-		if (uh->kdf_exponent[2] == 0)
-			uh->kdf_exponent[2] = CRYPTO_KDF_EXPONENT_DEFAULT_m13;
-		uh->kdf_exponent[2] = G_clamp_kdf_exponent_m13((si4) uh->kdf_exponent[2], ((lib_generated_mask >> 2) & 1) ? TRUE_m13 : FALSE_m13);
-		iterations = (ui4) 1 << uh->kdf_exponent[2];
-
-		// derive level 3 master secret
-		SHA_pbkdf2_m13((ui1 *) L3_pw_bytes, PASSWORD_BYTES_m13, salt, CRYPTO_KDF_SALT_BYTES_m13, iterations, dk);
-		memcpy(L3_master, dk, CRYPTO_MASTER_BYTES_m13);
-
 		// generate Level 3 password validation field: chain material xor highest-level master
 		// (level 3 recovery yields the master secrets, i.e. access & re-encryption ability, not the password strings themselves)
 		SHA_hmac_m13(L3_master, CRYPTO_MASTER_BYTES_m13, (ui1 *) CRYPTO_CHAIN_STRING_m13, (si8) strlen(CRYPTO_CHAIN_STRING_m13), hash);
@@ -6192,7 +7294,9 @@ tern	G_generate_password_data_m13(FPS_m13 *fps, const si1 *L1_pw, const si1 *L2_
 	G_secure_erase_m13(L1_master, CRYPTO_MASTER_BYTES_m13);
 	G_secure_erase_m13(L2_master, CRYPTO_MASTER_BYTES_m13);
 	G_secure_erase_m13(L3_master, CRYPTO_MASTER_BYTES_m13);
-	G_secure_erase_m13(dk, SHA_HASH_BYTES_m13);
+	G_secure_erase_m13(L1_dk, SHA_HASH_BYTES_m13);
+	G_secure_erase_m13(L2_dk, SHA_HASH_BYTES_m13);
+	G_secure_erase_m13(L3_dk, SHA_HASH_BYTES_m13);
 
 	return_m13(TRUE_m13);
 }
@@ -6780,6 +7884,7 @@ tern	G_init_global_tables_m13(tern init_all_tables)
 
 tern	G_init_globals_m13(tern init_all_tables, const si1 *app_path, ... )  // varargs (app_path) ui4 version_major, ui4 version_minor
 {
+	si4			i;
 	ERROR_m13		*err;
 	GLOBAL_MISC_m13		*misc;
 
@@ -6867,8 +7972,9 @@ tern	G_init_globals_m13(tern init_all_tables, const si1 *app_path, ... )  // var
 		exit(-1);
 		#endif
 	}
-	globals_m13->file_lock_list->top_idx = (si4) -1;
 	pthread_mutex_init_m13(&globals_m13->file_lock_list->mutex, NULL);
+	for (i = 0; i < FLOCK_LIST_SHARDS_m13; ++i)
+		pthread_mutex_init_m13(&globals_m13->file_lock_list->shard_mutexes[i], NULL);
 
 	// process globals
 	globals_m13->proc_globs_list = (PROC_GLOBS_LIST_m13 *) calloc((size_t) 1, sizeof(PROC_GLOBS_LIST_m13));
@@ -6973,6 +8079,10 @@ tern	G_init_globals_m13(tern init_all_tables, const si1 *app_path, ... )  // var
 	misc->new_password_min_classes = GLOBALS_NEW_PASSWORD_MIN_CLASSES_DEFAULT_m13;  // opt-in; default off (set to _STANDARD_ for AD-style 3-of-4)
 	misc->increase_priority = GLOBALS_INCREASE_PRIORITY_DEFAULT_m13;
 	misc->background_processing = GLOBALS_BACKGROUND_PROCESSING_DEFAULT_m13;
+	misc->block_cache_bytes = GLOBALS_BLOCK_CACHE_MB_DEFAULT_m13 << 20;
+	misc->shared_block_cache_bytes = GLOBALS_SHARED_BLOCK_CACHE_MB_DEFAULT_m13 << 20;
+	misc->session_manifest = GLOBALS_SESSION_MANIFEST_DEFAULT_m13;
+	misc->segment_overviews = GLOBALS_SEGMENT_OVERVIEWS_DEFAULT_m13;
 		
 	misc->suspend_stacks = FALSE_m13;
 	pthread_mutex_unlock_m13(&globals_m13->mutex);
@@ -8538,7 +9648,7 @@ CHAN_m13	*G_open_channel_m13(CHAN_m13 *chan, SLICE_m13 *slice, const si1 *chan_p
 	tern				free_chan, threading, r_val;
 	const si1			*ext;
 	si1				tmp_str[PATH_BYTES_m13], num_str[FILE_NUMBERING_DIGITS_m13 + 1], *type_str;
-	si4				i, j, k, seg_idx, n_segs, mapped_segs, null_segment_cnt;
+	si4				i, j, k, seg_idx, n_segs, mapped_segs, null_segment_cnt, lazy_first, lazy_last;
 	PROC_GLOBS_m13			*pg;
 	SEG_m13				*seg, *first_seg, *last_seg;
 	UH_m13				*uh;
@@ -8664,12 +9774,35 @@ CHAN_m13	*G_open_channel_m13(CHAN_m13 *chan, SLICE_m13 *slice, const si1 *chan_p
 		}
 	}
 	
+	// lazy segment opening: open only the first & last extant segments of the slice (they seed the channel metadata
+	// & slice limits); interior segments stay NULL until a read touches them (see G_read_channel_m13())
+	lazy_first = 0;  // advanced past missing segments in the loop below
+	lazy_last = n_segs - 1;
+	if (flags & LH_LAZY_SEG_OPEN_m13) {
+		for (; lazy_last > 0; --lazy_last) {
+			if (chan->segs[seg_idx + lazy_last])
+				break;
+			STR_fixed_width_int_m13(num_str, FILE_NUMBERING_DIGITS_m13, slice->start_seg_num + lazy_last);
+			if (chan->type_code == TS_CHAN_TYPE_CODE_m13)
+				ext = TS_SEG_TYPE_STR_m13;
+			else  // VID_CHAN_TYPE_CODE_m13
+				ext = VID_SEG_TYPE_STR_m13;
+			sprintf_m13(tmp_str, "%s/%s_s%s.%s", chan->path, chan->name, num_str, ext);
+			if (G_exists_m13(tmp_str) == DIR_EXISTS_m13)
+				break;
+		}
+	}
+
 	// set up thread infos
 	jobs = (PROC_JOB_m13 *) calloc((size_t) n_segs, sizeof(PROC_JOB_m13));
 	rmis = (READ_MED_THREAD_INFO_m13 *) calloc((size_t) n_segs, sizeof(READ_MED_THREAD_INFO_m13));
 	
 	null_segment_cnt = 0;
 	for (i = slice->start_seg_num, j = seg_idx, k = 0; k < n_segs; ++i, ++j, ++k) {
+		if ((flags & LH_LAZY_SEG_OPEN_m13) && k > lazy_first && k < lazy_last) {  // deferred to first read
+			jobs[k].skip = TRUE_m13;
+			continue;
+		}
 		seg = chan->segs[j];
 		if (seg == NULL) {
 			STR_fixed_width_int_m13(num_str, FILE_NUMBERING_DIGITS_m13, i);
@@ -8689,6 +9822,8 @@ CHAN_m13	*G_open_channel_m13(CHAN_m13 *chan, SLICE_m13 *slice, const si1 *chan_p
 					} else {
 						jobs[k].skip = TRUE_m13;
 						++null_segment_cnt;  // not every segment may exist
+						if (k == lazy_first && lazy_first < lazy_last)
+							++lazy_first;
 						continue;
 					}
 				}
@@ -8834,7 +9969,7 @@ CHAN_m13	*G_open_channel_m13(CHAN_m13 *chan, SLICE_m13 *slice, const si1 *chan_p
 			uh->type_code = VID_METADATA_TYPE_CODE_m13;
 		uh->segment_number = UH_CHANNEL_LEVEL_CODE_m13;
 		uh->session_UID = pg->current_session.UID;
-		uh->channel_UID = seg->metadata_fps->uh->channel_UID;;
+		uh->channel_UID = first_seg->metadata_fps->uh->channel_UID;  // (seg may be a missing or deferred trailing slot here)
 		uh->segment_UID = UID_NO_ENTRY_m13;
 		chan->metadata_fps->params.fp->fd = FPS_FD_EPHEMERAL_m13;
 		chan->flags |= LH_UPDATE_EPHEMERAL_DATA_m13;
@@ -8873,7 +10008,7 @@ pthread_rval_m13	G_open_channel_thread_m13(void *ptr)
 	else
 		job->status = PROC_THREAD_FAILED_m13;
 	
-	return_m13((pthread_rval_m13) 0);
+	return_m13(PROC_JOB_STATUS_SET_m13);
 }
 
 
@@ -9281,7 +10416,7 @@ pthread_rval_m13	G_open_segment_thread_m13(void *ptr)
 	else
 		job->status = PROC_THREAD_FAILED_m13;
 	
-	return_m13((pthread_rval_m13) 0);
+	return_m13(PROC_JOB_STATUS_SET_m13);
 }
 
 
@@ -9299,6 +10434,7 @@ SESS_m13	*G_open_session_m13(SESS_m13 *sess, SLICE_m13 *slice, void *file_list,
 	PROC_JOB_m13			*jobs;
 	READ_MED_THREAD_INFO_m13	*rmis;
 	SSR_m13				*ssr;
+	SESS_MNFST_m13			*mnfst;
 	
 #ifdef FT_DEBUG_m13
 	G_push_function_m13();
@@ -9319,6 +10455,7 @@ SESS_m13	*G_open_session_m13(SESS_m13 *sess, SLICE_m13 *slice, void *file_list,
 		free_sess = FALSE_m13;
 	}
 	sess->type_code = SESS_TYPE_CODE_m13;
+	memset((void *) &sess->read_ahead, 0, sizeof(READ_AHEAD_m13));  // no request history yet
 	if (slice)  // passed slice supersedes structure slice
 		sess->slice = *slice;
 	slice = &sess->slice;
@@ -9379,8 +10516,19 @@ SESS_m13	*G_open_session_m13(SESS_m13 *sess, SLICE_m13 *slice, void *file_list,
 #ifdef WINDOWS_m13
 	regex_str = "?icd";  // less specific (than MacOS or Linux)
 #endif
-	chan_list = G_file_list_m13(chan_list, &n_chans, sess_dir, NULL, regex_str, GFL_FULL_PATH_m13);
+	mnfst = NULL;
+	if (globals_m13->miscellaneous.session_manifest == TRUE_m13 && sess_dir)
+		mnfst = G_read_session_manifest_m13(sess_dir);
+	if (mnfst && mnfst->dirs_valid == TRUE_m13 && mnfst->header->n_dirs > 0) {  // session directory unchanged: channel list from the manifest
+		n_chans = mnfst->header->n_dirs;
+		chan_list = (si1 **) calloc_2D_m13((size_t) n_chans, PATH_BYTES_m13, sizeof(si1));
+		for (i = 0; i < n_chans; ++i)
+			sprintf_m13(chan_list[i], "%s/%s", mnfst->sess_path, mnfst->dirs[i].rel_path);
+	} else {
+		chan_list = G_file_list_m13(chan_list, &n_chans, sess_dir, NULL, regex_str, GFL_FULL_PATH_m13);
+	}
 	if (n_chans == 0) {
+		G_free_session_manifest_m13(mnfst);
 		if (free_sess == TRUE_m13)
 			G_free_session_m13(sess);
 		G_set_error_m13(E_GEN_m13, "no channels in file list");  // list len == 0 is not an error for G_file_list_m13(), so this is causal error
@@ -9389,6 +10537,7 @@ SESS_m13	*G_open_session_m13(SESS_m13 *sess, SLICE_m13 *slice, void *file_list,
 	
 	// set session globals (directory, name, password, time constants)
 	if (G_set_session_globals_m13(sess, chan_list[0], password) == FALSE_m13) {
+		G_free_session_manifest_m13(mnfst);
 		if (free_sess == TRUE_m13)
 			G_free_session_m13(sess);
 		return_m13(NULL);
@@ -9396,6 +10545,21 @@ SESS_m13	*G_open_session_m13(SESS_m13 *sess, SLICE_m13 *slice, void *file_list,
 	pg = G_proc_globs_m13(sess);
 	sess->path = pg->current_session.path;
 	sess->name = pg->current_session.fs_name;  // default to fs_name
+	
+	// session manifest: serves the segment & record file reads below (see FPS_read_m13())
+	if (globals_m13->miscellaneous.session_manifest == TRUE_m13) {
+		if (mnfst == NULL)
+			mnfst = G_read_session_manifest_m13(pg->current_session.path);
+		if (mnfst) {
+			if (mnfst->header->session_UID != pg->current_session.UID) {  // e.g. a session directory replaced by another with the same name
+				G_free_session_manifest_m13(mnfst);
+				mnfst = NULL;
+			}
+		}
+		if (pg->current_session.manifest)
+			G_free_session_manifest_m13(pg->current_session.manifest);
+		pg->current_session.manifest = mnfst;
+	}
 	if (STR_is_empty_m13(index_channel_name) == FALSE_m13)
 		strcpy(pg->current_session.index_channel_name, index_channel_name);
 	
@@ -10269,6 +11433,10 @@ void	G_proc_globs_delete_m13(void *level_header)
 	pthread_mutex_destroy_m13(&Sgmt_records_list->mutex);
 	
 	free(Sgmt_records_list);
+	
+	// delete session manifest
+	if (pg->current_session.manifest)
+		G_free_session_manifest_m13(pg->current_session.manifest);
 
 	// clear entire slot: empty slots are recognized by _id == 0, but stale fields (e.g. current_session.UID)
 	// must not match future searches either (deleted then reopened session would find this dead slot by UID)
@@ -11391,6 +12559,79 @@ tern	G_rates_vary_m13(SESS_m13 *sess)
 }
 
 
+tern	G_read_ahead_m13(SESS_m13 *sess)
+{
+	si4			i, j, n_segs;
+	si8			stride, start_time, end_time, start_block, end_block, start_offset, end_offset;
+	PROC_GLOBS_m13		*pg;
+	READ_AHEAD_m13		*ra;
+	SLICE_m13		*slice;
+	CHAN_m13		*chan;
+	SEG_m13			*seg;
+	UH_m13			*uh;
+	TS_IDX_m13		*tsi;
+	
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// Predict the next slice from the one just read (sess->slice) & the one before it, & ask the kernel to
+	// start fetching the time series data blocks it covers (FPS_read_ahead_m13()).  The hints return at
+	// once, so the I/O for every active channel's files is in flight while the caller works on the current
+	// slice, & the next FPS_read_m13() finds its blocks in the page cache.
+	// One request: assume the next is contiguous & the same length.  Two or more: advance by the last
+	// start-to-start stride.  Backward or repeated requests predict nothing.
+	// Called by G_read_session_m13() when LH_READ_AHEAD_m13 is set; returns TRUE_m13 if hints were issued.
+
+	if (sess == NULL)
+		return_m13(FALSE_m13);
+	slice = &sess->slice;
+	if (slice->start_time == TIME_NO_ENTRY_m13 || slice->end_time == TIME_NO_ENTRY_m13 || slice->end_time < slice->start_time)
+		return_m13(FALSE_m13);
+
+	ra = &sess->read_ahead;
+	if (ra->n_requests == 0)
+		stride = (slice->end_time - slice->start_time) + 1;
+	else
+		stride = slice->start_time - ra->last_start_time;
+	ra->last_start_time = slice->start_time;
+	ra->last_end_time = slice->end_time;
+	++ra->n_requests;
+	if (stride <= 0)
+		return_m13(FALSE_m13);
+	start_time = slice->start_time + stride;
+	end_time = slice->end_time + stride;
+
+	pg = G_proc_globs_m13(sess);
+	n_segs = pg->current_session.n_segments;
+	for (i = 0; i < sess->n_ts_chans; ++i) {
+		chan = sess->ts_chans[i];
+		if (chan == NULL || chan->segs == NULL || (chan->flags & LH_CHAN_ACTIVE_m13) == 0)
+			continue;
+		for (j = 0; j < n_segs; ++j) {
+			seg = chan->segs[j];  // segments not yet opened are skipped: opening is itself blocking I/O
+			if (seg == NULL || seg->ts_data_fps == NULL || seg->ts_inds_fps == NULL)
+				continue;
+			if (seg->ts_inds_fps->params.full_file_read != TRUE_m13)
+				continue;
+			uh = seg->ts_inds_fps->uh;
+			if (uh->n_entries < 2)  // terminal index only
+				continue;
+			if (uh->segment_end_time < start_time || uh->segment_start_time > end_time)
+				continue;
+			start_block = G_find_index_m13(seg, start_time, TIME_SEARCH_m13 | NO_OVERFLOWS_m13);
+			end_block = G_find_index_m13(seg, end_time, TIME_SEARCH_m13 | NO_OVERFLOWS_m13);
+			tsi = seg->ts_inds_fps->ts_inds;
+			start_offset = REMOVE_DISCONT_m13(tsi[start_block].file_offset);
+			end_offset = REMOVE_DISCONT_m13(tsi[end_block + 1].file_offset);  // terminal index bounds the last block
+			FPS_read_ahead_m13(seg->ts_data_fps, start_offset, end_offset - start_offset);
+		}
+	}
+
+	return_m13(TRUE_m13);
+}
+
+
 CHAN_m13	*G_read_channel_m13(CHAN_m13 *chan, SLICE_m13 *slice, ...)  // varargs(chan == NULL): si1 *chan_path, void *parent, ui8 lh_flags, si1 *password
 {
 	tern				open_chan, free_chan, threading, r_val;
@@ -11398,6 +12639,7 @@ CHAN_m13	*G_read_channel_m13(CHAN_m13 *chan, SLICE_m13 *slice, ...)  // varargs(
 	si1 				num_str[FILE_NUMBERING_DIGITS_m13 + 1];
 	ui8 				flags;
 	si4 				i, j, k, n_segs, seg_idx, null_segment_cnt;
+	si8				now;
 	va_list				v_args;
 	LH_m13				*parent;
 	SEG_m13				*seg, *first_seg, *last_seg;
@@ -11509,7 +12751,7 @@ CHAN_m13	*G_read_channel_m13(CHAN_m13 *chan, SLICE_m13 *slice, ...)  // varargs(
 	// thread out segment reads
 	if (n_segs == 1)  // no sense in thread overhead for one segment
 		threading = FALSE_m13;
-	else if ((flags & LH_THREAD_SEG_READS_m13) == 0)
+	else if ((chan->flags & LH_THREAD_SEG_READS_m13) == 0)  // chan->flags: local flags are only set when opening here
 		threading = FALSE_m13;
 	else
 		threading = PROC_default_threading_m13(chan);
@@ -11541,11 +12783,14 @@ CHAN_m13	*G_read_channel_m13(CHAN_m13 *chan, SLICE_m13 *slice, ...)  // varargs(
 
 	// assign results (& keep first & last segments)
 	first_seg = NULL;
+	now = (chan->flags & LH_LAZY_SEG_OPEN_m13) ? G_current_uutc_m13() : 0;
 	for (i = 0, j = seg_idx; i < n_segs; ++i, ++j) {
 		if (jobs[i].skip == FALSE_m13) {
 			last_seg = chan->segs[j] = (SEG_m13 *) rmis[i].MED_struct;  // rmis & jobs are slice-relative (0 based, as i); chan->segs is map-relative (seg_idx based, as j)
 			if (first_seg == NULL)
 				first_seg = last_seg;
+			if (now)  // recency for G_release_lazy_segments_m13()
+				last_seg->access_time = now;
 		}
 	}
 
@@ -11594,6 +12839,10 @@ CHAN_m13	*G_read_channel_m13(CHAN_m13 *chan, SLICE_m13 *slice, ...)  // varargs(
 		chan->metadata_fps->uh->segment_number = UH_CHANNEL_LEVEL_CODE_m13;
 		chan->metadata_fps->uh->segment_UID = UID_NO_ENTRY_m13;
 	}
+	
+	// close least recently read segments if over the open file budget
+	if (chan->flags & LH_LAZY_SEG_OPEN_m13)
+		G_release_lazy_segments_m13(chan);
 
 	return_m13(chan);
 }
@@ -11623,7 +12872,7 @@ pthread_rval_m13	G_read_channel_thread_m13(void *ptr)
 	else
 		job->status = PROC_THREAD_FAILED_m13;
 	
-	return_m13((pthread_rval_m13) 0);
+	return_m13(PROC_JOB_STATUS_SET_m13);
 }
 
 
@@ -11936,6 +13185,188 @@ LH_m13 	*G_read_data_m13(void *level_header, SLICE_m13 *slice, ...)  // varargs
 }
 
 
+EPOCHS_m13	*G_read_epochs_m13(SESS_m13 *sess, SLICE_m13 *slices, si8 n_slices)
+{
+	si4			i, j, n_chans, seg_idx;
+	si8			k, m, first, row_idx, stride, n_rows, max_dur, max_span, span_start, span_end, s0, s1, o0, o1, n_samps;
+	sf8			max_sf;
+	ui8			saved_flags;
+	si4			*row;
+	SLICE_m13		w, span_slice;
+	EPOCH_SORT_m13		*order;
+	EPOCHS_m13		*epochs;
+	PROC_GLOBS_m13		*pg;
+	CHAN_m13		*chan;
+	SEG_m13			*seg;
+	CPS_m13			*cps;
+	
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// reads the windows in slices[] from an open session into one [epoch][channel][sample] array (see EPOCHS_m13)
+	// windows may be given in time or sample numbers, in any order, & may overlap; epochs keep the caller's order
+	// windows are sorted & coalesced into spans so blocks shared by windows of one span are read & decoded once
+	// (a block straddling two spans - split by the span limit or the merge gap - is decoded by both, unless the block cache holds it)
+	// spans falling in a recording gap leave their rows padded; any other read failure fails the call
+	// the session is left holding the last span read: its slices describe those data (not the slice it had on entry)
+	
+	if (sess == NULL || slices == NULL) {
+		G_set_error_m13(E_GEN_m13, "session or slices is null");
+		return_m13(NULL);
+	}
+	if (n_slices <= 0) {
+		G_set_error_m13(E_GEN_m13, "no slices");
+		return_m13(NULL);
+	}
+	pg = G_proc_globs_m13((LH_m13 *) sess);
+	
+	// active channels
+	for (n_chans = i = 0; i < sess->n_ts_chans; ++i)
+		if (sess->ts_chans[i]->flags & LH_CHAN_ACTIVE_m13)
+			++n_chans;
+	if (n_chans == 0) {
+		G_set_error_m13(E_GEN_m13, "no active time series channels");
+		return_m13(NULL);
+	}
+	max_sf = pg->active_channels.maximum_sampling_frequency;
+	if (max_sf == RATE_NO_ENTRY_m13) {
+		G_rates_vary_m13(sess);
+		if ((max_sf = pg->active_channels.maximum_sampling_frequency) == RATE_NO_ENTRY_m13) {
+			G_set_error_m13(E_GEN_m13, "sampling frequency unknown");
+			return_m13(NULL);
+		}
+	}
+	
+	// condition windows to absolute times
+	order = (EPOCH_SORT_m13 *) malloc_m13((size_t) n_slices * sizeof(EPOCH_SORT_m13));
+	for (max_dur = k = 0; k < n_slices; ++k) {
+		w = slices[k];
+		G_condition_slice_m13((LH_m13 *) sess, &w);
+		if (w.start_time == TIME_NO_ENTRY_m13)
+			w.start_time = G_time_for_index_m13((LH_m13 *) sess, w.start_samp_num, FIND_START_m13);
+		if (w.end_time == TIME_NO_ENTRY_m13)
+			w.end_time = G_time_for_index_m13((LH_m13 *) sess, w.end_samp_num, FIND_END_m13);
+		if (w.start_time == BEGINNING_OF_TIME_m13 || w.start_time < pg->current_session.start_time)
+			w.start_time = pg->current_session.start_time;
+		if (w.end_time == END_OF_TIME_m13 || w.end_time > pg->current_session.end_time)
+			w.end_time = pg->current_session.end_time;
+		if (w.end_time < w.start_time) {
+			G_set_error_m13(E_GEN_m13, "slice %ld is empty or outside the session", k);
+			free_m13(order);
+			return_m13(NULL);
+		}
+		order[k].start_time = w.start_time;
+		order[k].end_time = w.end_time;
+		order[k].epoch_idx = k;
+		if (max_dur < w.end_time - w.start_time)
+			max_dur = w.end_time - w.start_time;
+	}
+	qsort((void *) order, (size_t) n_slices, sizeof(EPOCH_SORT_m13), G_epoch_compare_m13);
+	
+	// output (rows padded: samples the windows don't reach stay NAN_SI4_m13)
+	stride = (si8) ceil(((sf8) (max_dur + 1) / (sf8) 1.0e6) * max_sf) + 2;
+	n_rows = n_slices * (si8) n_chans;
+	epochs = (EPOCHS_m13 *) calloc_m13((size_t) 1, sizeof(EPOCHS_m13));
+	epochs->n_epochs = n_slices;
+	epochs->n_chans = n_chans;
+	epochs->epoch_samples = stride;
+	epochs->chans = (CHAN_m13 **) malloc_m13((size_t) n_chans * sizeof(CHAN_m13 *));
+	for (j = i = 0; i < sess->n_ts_chans; ++i)
+		if (sess->ts_chans[i]->flags & LH_CHAN_ACTIVE_m13)
+			epochs->chans[j++] = sess->ts_chans[i];
+	epochs->samples = (si4 *) malloc_m13((size_t) (n_rows * stride) * sizeof(si4));
+	for (row = epochs->samples, k = n_rows * stride; k--;)
+		*row++ = NAN_SI4_m13;
+	epochs->start_samp_nums = (si8 *) calloc_m13((size_t) n_rows, sizeof(si8));
+	epochs->sample_counts = (si8 *) calloc_m13((size_t) n_rows, sizeof(si8));
+	
+	// span limit: bounds decoded memory of one coalesced read, but always holds the longest window
+	max_span = (si8) (((sf8) EPOCHS_MAX_SPAN_BYTES_DEFAULT_m13 / ((sf8) sizeof(si4) * max_sf * (sf8) n_chans)) * (sf8) 1.0e6);
+	if (max_span < max_dur)
+		max_span = max_dur;
+	
+	// segment records (a span with no segment is a gap only if these exist)
+	if (G_Sgmt_records_m13((LH_m13 *) sess, TIME_SEARCH_m13) == NULL) {
+		G_set_error_m13(E_GEN_m13, "no segment records");
+		G_free_epochs_m13(&epochs);
+		free_m13(order);
+		return_m13(NULL);
+	}
+
+	// no ephemeral data (slice-independent; built by the first open) & no deferred decode (samples are gathered from the CPSs)
+	saved_flags = sess->flags & (LH_GENERATE_EPHEMERAL_DATA_m13 | LH_DEFER_TS_DECODE_m13);
+	if (saved_flags)
+		G_propagate_flags_m13((LH_m13 *) sess, sess->flags & ~saved_flags);
+	
+	for (first = 0; first < n_slices; first = m) {
+		// coalesce
+		span_start = order[first].start_time;
+		span_end = order[first].end_time;
+		for (m = first + 1; m < n_slices; ++m) {
+			if (order[m].start_time > span_end + EPOCHS_MERGE_GAP_DEFAULT_m13)
+				break;
+			if (order[m].end_time > span_end) {
+				if (order[m].end_time - span_start > max_span)
+					break;
+				span_end = order[m].end_time;
+			}
+		}
+		
+		// read (channel threads)
+		G_init_slice_m13(&span_slice);
+		span_slice.start_time = span_start;
+		span_slice.end_time = span_end;
+		if (G_segment_range_m13((LH_m13 *) sess, &span_slice) == UNKNOWN_m13)
+			continue;  // span falls in a recording gap: its rows stay padded
+		++epochs->n_reads;
+		if (G_read_session_m13(sess, &span_slice) == NULL) {
+			G_set_error_m13(E_GEN_m13, "error reading epochs span [%ld, %ld]", span_start, span_end);
+			G_free_epochs_m13(&epochs);
+			break;
+		}
+		
+		// scatter
+		for (k = first; k < m; ++k) {
+			for (i = 0; i < n_chans; ++i) {
+				chan = epochs->chans[i];
+				row_idx = (order[k].epoch_idx * (si8) n_chans) + (si8) i;
+				row = epochs->samples + (row_idx * stride);
+				s0 = G_index_for_time_m13((LH_m13 *) chan, order[k].start_time, FIND_CURRENT_m13);
+				s1 = G_index_for_time_m13((LH_m13 *) chan, order[k].end_time, FIND_CURRENT_m13);
+				epochs->start_samp_nums[row_idx] = s0;
+				if (s0 < 0 || s1 < s0)
+					continue;
+				if (s1 - s0 >= stride)
+					s1 = (s0 + stride) - 1;
+				n_samps = 0;
+				seg_idx = chan->slice.start_seg_num - 1;
+				for (j = chan->slice.start_seg_num; j <= chan->slice.end_seg_num; ++j, ++seg_idx) {
+					seg = chan->segs[seg_idx];
+					if (seg == NULL || seg->ts_data_fps == NULL)
+						continue;
+					if ((cps = seg->ts_data_fps->params.cps) == NULL)
+						continue;
+					o0 = (s0 > seg->slice.start_samp_num) ? s0 : seg->slice.start_samp_num;
+					o1 = (s1 < seg->slice.end_samp_num) ? s1 : seg->slice.end_samp_num;
+					if (o0 > o1)
+						continue;
+					memcpy((void *) (row + (o0 - s0)), (void *) (cps->decompressed_data + (o0 - seg->slice.start_samp_num)), (size_t) ((o1 - o0) + 1) * sizeof(si4));
+					n_samps += (o1 - o0) + 1;
+				}
+				epochs->sample_counts[row_idx] = n_samps;
+			}
+		}
+	}
+	
+	if (saved_flags)
+		G_propagate_flags_m13((LH_m13 *) sess, sess->flags | saved_flags);
+	free_m13(order);
+
+	return_m13(epochs);  // NULL on a read error
+}
+
+
 tern	G_read_medlibrc_m13(const si1 *path, tern sequential)
 {
 	si1		user_path[PATH_BYTES_m13], *buffer;
@@ -12347,6 +13778,100 @@ tern	G_enter_password_m13(si1 *password, const si1 *prompt, tern confirm_no_entr
 #endif  // WINDOWS_m13
 
 
+OVW_m13	*G_read_overview_m13(SEG_m13 *seg)
+{
+	si1			data_path[PATH_BYTES_m13], ovw_path[PATH_BYTES_m13];
+	si4			i;
+	si8			file_len, tail;
+	ui1			*data;
+	FILE_m13		*fp;
+	FILE_TIMES_m13		ft;
+	struct_stat_m13		sb;
+	OVW_HDR_m13		*hdr;
+	OVW_LEVEL_m13		*lev;
+	
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// returns the segment's overview if its file is present, intact, & current (same data file length, modification time, & sample count)
+	// result is cached in the segment: a missing or stale overview is not looked for again until G_build_overview_m13() is called
+
+	if (seg == NULL)
+		return_m13(NULL);
+	if (seg->overview_read != UNKNOWN_m13)
+		return_m13(seg->overview);
+	seg->overview_read = FALSE_m13;
+	if (seg->metadata_fps == NULL)
+		return_m13(NULL);
+	
+	sprintf_m13(ovw_path, "%s/%s.%s", seg->path, seg->name, OVW_TYPE_STR_m13);
+	if (stat_m13(ovw_path, &sb))
+		return_m13(NULL);
+	file_len = (si8) sb.st_size;
+	if (file_len < (si8) sizeof(OVW_HDR_m13))
+		return_m13(NULL);
+
+	data = (ui1 *) malloc_m13((size_t) file_len);
+	G_add_behavior_m13(RETURN_ON_FAIL_m13 | SUPPRESS_OUTPUT_m13);
+	fp = fopen_m13(ovw_path, "r");
+	if (fp) {
+		if (fread_m13((void *) data, sizeof(ui1), (size_t) file_len, fp) != (size_t) file_len)
+			file_len = 0;
+		fclose_m13(fp);
+	}
+	G_pop_behavior_m13();
+	if (fp == NULL || file_len == 0)
+		goto OVW_REJECT_m13;
+	
+	// validate
+	hdr = (OVW_HDR_m13 *) data;
+	if (hdr->tag != OVW_TAG_m13 || hdr->version_major != OVW_VER_MAJOR_m13)
+		goto OVW_REJECT_m13;
+	if (CRC_validate_m13(data + OVW_HDR_CRC_START_OFFSET_m13, (si8) sizeof(OVW_HDR_m13) - OVW_HDR_CRC_START_OFFSET_m13, hdr->header_CRC) == FALSE_m13)
+		goto OVW_REJECT_m13;
+	if (hdr->n_levels < 1 || hdr->n_levels > OVW_MAX_LEVELS_m13)
+		goto OVW_REJECT_m13;
+	tail = (si8) sizeof(OVW_HDR_m13) + ((si8) hdr->n_levels * (si8) sizeof(OVW_LEVEL_m13));
+	if (tail > file_len)
+		goto OVW_REJECT_m13;
+	if (CRC_validate_m13(data + sizeof(OVW_HDR_m13), file_len - (si8) sizeof(OVW_HDR_m13), hdr->body_CRC) == FALSE_m13)
+		goto OVW_REJECT_m13;
+	lev = (OVW_LEVEL_m13 *) (data + sizeof(OVW_HDR_m13));
+	for (i = 0; i < hdr->n_levels; ++i, ++lev) {
+		if (lev->bin_samples != ((si8) OVW_BASE_BIN_SAMPLES_m13 << i) || lev->n_bins < 1)
+			goto OVW_REJECT_m13;
+		if (lev->offset < tail || lev->offset + (lev->n_bins * (si8) (sizeof(si4) + sizeof(si4) + sizeof(sf4))) > file_len)
+			goto OVW_REJECT_m13;
+	}
+	
+	// currency
+	if (hdr->number_of_samples != seg->metadata_fps->metadata->time_series_section_2.number_of_samples)
+		goto OVW_REJECT_m13;
+	sprintf_m13(data_path, "%s/%s.%s", seg->path, seg->name, TS_DATA_TYPE_STR_m13);
+	if (stat_m13(data_path, &sb))
+		goto OVW_REJECT_m13;
+	if ((si8) sb.st_size != hdr->data_len)
+		goto OVW_REJECT_m13;
+	G_file_times_m13(NULL, data_path, &ft, FALSE_m13);
+	if (ft.modification != hdr->data_mod_time)
+		goto OVW_REJECT_m13;
+	
+	seg->overview = (OVW_m13 *) calloc_m13((size_t) 1, sizeof(OVW_m13));
+	seg->overview->data = data;
+	seg->overview->header = hdr;
+	seg->overview->levels = (OVW_LEVEL_m13 *) (data + sizeof(OVW_HDR_m13));
+	seg->overview_read = TRUE_m13;
+	
+	return_m13(seg->overview);
+	
+OVW_REJECT_m13:
+	free_m13((void *) data);
+	
+	return_m13(NULL);
+}
+
+
 si8 G_read_records_m13(void *level_header, SLICE_m13 *slice, ...)  // varags(level->type_code == SSR_TYPE_CODE_m13): si4 seg_num
 {
 	tern		sort;
@@ -12658,7 +14183,7 @@ pthread_rval_m13	G_read_segment_thread_m13(void *ptr)
 	else
 		job->status = PROC_THREAD_FAILED_m13;
 	
-	return_m13((pthread_rval_m13) 0);
+	return_m13(PROC_JOB_STATUS_SET_m13);
 }
 
 
@@ -12894,6 +14419,10 @@ SESS_m13	*G_read_session_m13(SESS_m13 *sess, SLICE_m13 *slice, ...)  // varargs(
 	if (pg->active_channels.sampling_frequencies_vary == TRUE_m13 || pg->active_channels.frame_rates_vary == TRUE_m13)
 		slice->start_samp_num = slice->end_samp_num = INDEX_NO_ENTRY_m13;  // unioned with video fields
 
+	// start fetching the predicted next slice
+	if (sess->flags & LH_READ_AHEAD_m13)
+		G_read_ahead_m13(sess);
+
 	// update ephemeral data  (session record ephemeral data updated on session / segment open)
 	if (sess->flags & LH_GENERATE_EPHEMERAL_DATA_m13) {
 		// time series ephemeral data
@@ -12935,17 +14464,110 @@ SESS_m13	*G_read_session_m13(SESS_m13 *sess, SLICE_m13 *slice, ...)  // varargs(
 }
 
 
+SESS_MNFST_m13	*G_read_session_manifest_m13(const si1 *sess_path)
+{
+	si1			full_path[PATH_BYTES_m13], mnfst_path[PATH_BYTES_m13], sess_name[NAME_BYTES_m13];
+	si4			i;
+	si8			len, n_entries, images_offset;
+	FILE_m13		*fp;
+	FILE_TIMES_m13		ft;
+	struct_stat_m13		sb;
+	SESS_MNFST_HDR_m13	*hdr;
+	SESS_MNFST_ENTRY_m13	*entry;
+	SESS_MNFST_m13		*mnfst;
+	
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// returns NULL if the session has no manifest, or it cannot be used - not an error: the caller opens from the file system
+	// (one read of the whole manifest; images are validated individually when served - see G_session_manifest_image_m13())
+
+	if (STR_is_empty_m13(sess_path) == TRUE_m13)
+		return_m13(NULL);
+	G_full_path_m13(sess_path, full_path);
+	G_path_parts_m13(full_path, NULL, sess_name, NULL);
+	sprintf_m13(mnfst_path, "%s/%s/%s.%s", full_path, SESS_MNFST_DIR_STR_m13, sess_name, SESS_MNFST_TYPE_STR_m13);
+	if (stat_m13(mnfst_path, &sb))
+		return_m13(NULL);
+	len = (si8) sb.st_size;
+	if (len < (si8) sizeof(SESS_MNFST_HDR_m13))
+		return_m13(NULL);
+
+	mnfst = (SESS_MNFST_m13 *) calloc_m13((size_t) 1, sizeof(SESS_MNFST_m13));
+	mnfst->data = (ui1 *) malloc_m13(len);
+	G_add_behavior_m13(RETURN_ON_FAIL_m13 | SUPPRESS_OUTPUT_m13);
+	fp = fopen_m13(mnfst_path, "r");
+	if (fp) {
+		if ((si8) fread_m13(mnfst->data, sizeof(ui1), (size_t) len, fp) != len)
+			len = 0;
+		fclose_m13(fp);
+	} else {
+		len = 0;
+	}
+	G_pop_behavior_m13();
+	if (len == 0) {
+		G_free_session_manifest_m13(mnfst);
+		return_m13(NULL);
+	}
+
+	// validate
+	hdr = mnfst->header = (SESS_MNFST_HDR_m13 *) mnfst->data;
+	if (hdr->tag != SESS_MNFST_TAG_m13 || hdr->version_major != SESS_MNFST_VER_MAJOR_m13) {
+		G_free_session_manifest_m13(mnfst);
+		return_m13(NULL);
+	}
+	if (CRC_validate_m13(mnfst->data + SESS_MNFST_HDR_CRC_START_OFFSET_m13, (si8) sizeof(SESS_MNFST_HDR_m13) - SESS_MNFST_HDR_CRC_START_OFFSET_m13, hdr->header_CRC) == FALSE_m13) {
+		G_free_session_manifest_m13(mnfst);
+		return_m13(NULL);
+	}
+	n_entries = (si8) hdr->n_dirs + (si8) hdr->n_files;
+	if (hdr->n_dirs < 0 || hdr->n_files < 0 || (si8) sizeof(SESS_MNFST_HDR_m13) + (n_entries * (si8) sizeof(SESS_MNFST_ENTRY_m13)) > len) {
+		G_free_session_manifest_m13(mnfst);
+		return_m13(NULL);
+	}
+	if (CRC_validate_m13(mnfst->data + sizeof(SESS_MNFST_HDR_m13), len - (si8) sizeof(SESS_MNFST_HDR_m13), hdr->body_CRC) == FALSE_m13) {
+		G_free_session_manifest_m13(mnfst);
+		return_m13(NULL);
+	}
+	mnfst->dirs = (SESS_MNFST_ENTRY_m13 *) (mnfst->data + sizeof(SESS_MNFST_HDR_m13));
+	mnfst->files = mnfst->dirs + hdr->n_dirs;
+	images_offset = (si8) sizeof(SESS_MNFST_HDR_m13) + (n_entries * (si8) sizeof(SESS_MNFST_ENTRY_m13));
+	for (i = 0; i < hdr->n_files; ++i) {
+		entry = mnfst->files + i;
+		if (entry->offset < images_offset || entry->len < UH_BYTES_m13 || entry->offset + entry->len > len) {
+			G_free_session_manifest_m13(mnfst);
+			return_m13(NULL);
+		}
+	}
+	strcpy(mnfst->sess_path, full_path);
+	
+	// directory list: usable only while no channel has been added, removed, or renamed
+	G_file_times_m13(NULL, full_path, &ft, FALSE_m13);
+	if (ft.modification == hdr->session_dir_mod_time) {
+		mnfst->dirs_valid = TRUE_m13;
+		mnfst->stale = FALSE_m13;
+	} else {
+		mnfst->dirs_valid = FALSE_m13;
+		mnfst->stale = TRUE_m13;
+	}
+
+	return_m13(mnfst);
+}
+
 si8	G_read_time_series_data_m13(SEG_m13 *seg, SLICE_m13 *slice)
 {
-	tern				cps_caching, scale;
-	ui4				cached_block_samples;
-	si4				cached_block_cnt, *to_ptr, *from_ptr, *si4_p, to_idx, from_idx;
+	tern				cps_caching, scale, defer;
+	ui4				cached_block_samples, block_samples;
+	si4				cached_block_cnt, *to_ptr, *from_ptr, to_idx, from_idx, n_runs;
+	ui8				file_UID;
 	si4				first_cached_block, first_cached_block_idx, last_cached_block, last_cached_block_idx;
-	si8				i, j, k, terminal_ts_ind, n_samps, n_blocks, start_offset;
+	si8				i, j, terminal_ts_ind, n_samps, n_blocks, start_offset;
 	si8				start_block, end_block, read_start_block, read_end_block, read_n_blocks, compressed_data_bytes;
-	si8				local_start_idx, local_end_idx, seg_start_samp_num, n_cached_samples, cache_offset;
+	si8				local_start_idx, local_end_idx, seg_start_samp_num, n_cached_samples, cache_offset, serial_blocks;
 	sf8				scale_factor;
 	CMP_CACHE_BLOCK_INFO_m13	*cached_blocks;
+	CMP_DECODE_RUN_m13		range;
 	FPS_m13				*tsd_fps, *tsi_fps;
 	TS_IDX_m13			*tsi;
 	TS_METADATA_SECTION_2_m13	*tmd2;
@@ -12999,12 +14621,16 @@ si8	G_read_time_series_data_m13(SEG_m13 *seg, SLICE_m13 *slice)
 	start_offset = REMOVE_DISCONT_m13(tsi[start_block].file_offset);
 	tmd2 = &seg->metadata_fps->metadata->time_series_section_2;
 	cached_block_cnt = 0;
+	cached_blocks = NULL;
 	read_start_block = start_block;
 	read_end_block = end_block;
 	if (tsd_fps->params.cps == NULL) {
 		compressed_data_bytes = REMOVE_DISCONT_m13(tsi[end_block + 1].file_offset) - start_offset;
-		cps = CMP_allocate_CPS_m13(tsd_fps, CMP_DECOMPRESSION_MODE_m13, n_samps, compressed_data_bytes, tmd2->maximum_block_keysample_bytes, tmd2->maximum_block_samples, NULL, NULL);
-		cps_caching = (cps->direcs.flags & CPS_DF_CPS_CACHING_m13) ? TRUE_m13 : FALSE_m13;
+		// deferred decode needs only one block of scratch.  A deferral request overrides CPS caching for this read: the caller
+		// decodes into its own buffer, so there is nothing to cache (the directive stays set for later, undeferred reads).
+		defer = (seg->flags & LH_DEFER_TS_DECODE_m13) ? TRUE_m13 : FALSE_m13;
+		cps = CMP_allocate_CPS_m13(tsd_fps, CMP_DECOMPRESSION_MODE_m13, (defer == TRUE_m13) ? (si8) tmd2->maximum_block_samples : n_samps, compressed_data_bytes, tmd2->maximum_block_keysample_bytes, tmd2->maximum_block_samples, NULL, NULL);
+		cps_caching = ((cps->direcs.flags & CPS_DF_CPS_CACHING_m13) && defer == FALSE_m13) ? TRUE_m13 : FALSE_m13;
 		if (cps_caching == TRUE_m13) {
 			cached_blocks = cps->params.cached_blocks = (CMP_CACHE_BLOCK_INFO_m13 *) calloc_m13((size_t) n_blocks, sizeof(CMP_CACHE_BLOCK_INFO_m13));
 			cps->params.cached_block_list_len = n_blocks;
@@ -13012,6 +14638,11 @@ si8	G_read_time_series_data_m13(SEG_m13 *seg, SLICE_m13 *slice)
 	} else {
 		cps = tsd_fps->params.cps;
 		cps_caching = (cps->direcs.flags & CPS_DF_CPS_CACHING_m13) ? TRUE_m13 : FALSE_m13;
+		defer = (seg->flags & LH_DEFER_TS_DECODE_m13) ? TRUE_m13 : FALSE_m13;
+		if (defer == TRUE_m13 && cps_caching == TRUE_m13) {  // deferral overrides caching: the cache becomes decode scratch => drop it
+			cps->params.cached_block_cnt = 0;
+			cps_caching = FALSE_m13;
+		}
 		if (cps_caching == TRUE_m13) {
 			if (cps->params.cached_block_list_len < n_blocks) {
 				cps->params.cached_blocks = (CMP_CACHE_BLOCK_INFO_m13 *) realloc_m13(cps->params.cached_blocks, (size_t) n_blocks * sizeof(CMP_CACHE_BLOCK_INFO_m13));
@@ -13108,7 +14739,7 @@ si8	G_read_time_series_data_m13(SEG_m13 *seg, SLICE_m13 *slice)
 			compressed_data_bytes = REMOVE_DISCONT_m13(tsi[end_block + 1].file_offset) - start_offset;
 		}
 		CMP_update_CPS_pointers_m13(tsd_fps, CMP_RESET_DECOMPRESSED_PTR_m13 | CMP_RESET_BLOCK_HDR_PTR_m13);
-		cps = CMP_realloc_CPS_m13(tsd_fps, CMP_DECOMPRESSION_MODE_m13, n_samps, tmd2->maximum_block_samples);
+		cps = CMP_realloc_CPS_m13(tsd_fps, CMP_DECOMPRESSION_MODE_m13, (defer == TRUE_m13) ? (si8) tmd2->maximum_block_samples : n_samps, tmd2->maximum_block_samples);
 		if (cps == NULL)
 			return_m13(FALSE_m13);
 	}
@@ -13117,21 +14748,45 @@ si8	G_read_time_series_data_m13(SEG_m13 *seg, SLICE_m13 *slice)
 	read_n_blocks = (read_end_block - read_start_block) + 1;
 	if (FPS_read_m13(tsd_fps, start_offset, compressed_data_bytes, read_n_blocks) == NULL)
 		return_m13(FALSE_m13);
+	
+	// deferred decode: caller decodes into its own buffer (G_decode_time_series_data_m13())
+	cps->params.decode_deferred = defer;
+	if (defer == TRUE_m13) {
+		n_samps = (local_end_idx - local_start_idx) + 1;
+		return_m13(n_samps);
+	}
 
 	// set limit on first block
 	cps->params.block_start_index = local_start_idx - tsi[start_block].start_samp_num;
 	
+	// process-wide block cache key
+	file_UID = (globals_m13->miscellaneous.block_cache_bytes > 0 || globals_m13->miscellaneous.shared_block_cache_bytes > 0) ? tsd_fps->uh->file_UID : UID_NO_ENTRY_m13;
+
 	scale = FALSE_m13;
+	scale_factor = (sf8) 1.0;
 	if (cps->direcs.flags & CPS_DF_CONVERT_TO_NATIVE_UNITS_m13) {
 		scale_factor = tmd2->amplitude_units_conversion_factor;
-		if (scale_factor != 1.0 && scale_factor != TS_METADATA_AMPLITUDE_UNITS_CONVERSION_FACTOR_NO_ENTRY_m13)
+		if (isfinite(scale_factor) && scale_factor != 1.0 && scale_factor != TS_METADATA_AMPLITUDE_UNITS_CONVERSION_FACTOR_NO_ENTRY_m13)
 			scale = TRUE_m13;
 	}
 		
+	// block-parallel decode: remaining blocks split into runs (first block, which carries the start limit, is decoded here)
+	n_runs = 0;
+	if (seg->flags & LH_THREAD_BLOCK_DECODE_m13) {
+		n_runs = globals_m13->tables->HW_params.logical_cores;
+		if (n_runs > (n_blocks - 1) / CMP_DECODE_RUN_MIN_BLOCKS_m13)
+			n_runs = (si4) ((n_blocks - 1) / CMP_DECODE_RUN_MIN_BLOCKS_m13);
+		if (n_runs < 2)
+			n_runs = 0;
+		else if (PROC_default_threading_m13(seg) != TRUE_m13)
+			n_runs = 0;
+	}
+	serial_blocks = (n_runs) ? 1 : n_blocks;
+
 	// loop over blocks
 	cache_offset = 0;
 	cps->decompressed_ptr = cps->params.cache;
-	for (i = 0, j = start_block; i < n_blocks; ++i, ++j) {
+	for (i = 0, j = start_block; i < serial_blocks; ++i, ++j) {
 		if (cached_block_cnt) {
 			if ((cached_block_samples = cached_blocks[i].block_samples)) {
 				cps->decompressed_ptr += cached_block_samples;
@@ -13145,8 +14800,13 @@ si8	G_read_time_series_data_m13(SEG_m13 *seg, SLICE_m13 *slice)
 		// set limit on last block
 		if (j == end_block)
 			cps->params.block_end_index = local_end_idx - tsi[j].start_samp_num;
-		if (CMP_decode_m13(tsd_fps) == FALSE_m13)
-			return_m13(FALSE_m13);
+		if (CMP_block_cache_fetch_m13(cps, file_UID, j) == FALSE_m13) {
+			block_samples = cps->block_header->number_of_samples;
+			if (CMP_decode_m13(tsd_fps) == FALSE_m13)
+				return_m13(FALSE_m13);
+			if (file_UID != UID_NO_ENTRY_m13 && cps->block_header->number_of_samples == block_samples)  // whole block decoded (VDS may trim the slice ends)
+				CMP_block_cache_store_m13(file_UID, j, cps->decompressed_ptr, block_samples);
+		}
 
 		if (cps_caching == TRUE_m13) {
 			cached_blocks[i].cache_offset = cache_offset;
@@ -13154,13 +14814,29 @@ si8	G_read_time_series_data_m13(SEG_m13 *seg, SLICE_m13 *slice)
 			cache_offset += cached_blocks[i].block_samples;
 			cached_blocks[i].block_number = j;
 		}
-		if (scale == TRUE_m13) {  // scale to native units
-			si4_p = cps->decompressed_ptr;
-			for (k = cps->block_header->number_of_samples; k--; ++si4_p)
-				*si4_p = CMP_round_si4_m13((sf8) *si4_p * scale_factor);
-		}
+		if (scale == TRUE_m13)  // scale to native units
+			CMP_si4_to_type_m13(cps->decompressed_ptr, cps->decompressed_ptr, (si8) cps->block_header->number_of_samples, CMP_SI4_TYPE_m13, scale_factor);
 		CMP_update_CPS_pointers_m13(tsd_fps, CMP_UPDATE_BLOCK_HDR_PTR_m13 | CMP_UPDATE_DECOMPRESSED_PTR_m13);
 	}
+	if (n_runs) {
+		memset((void *) &range, 0, sizeof(CMP_DECODE_RUN_m13));
+		range.cached_blocks = (cps_caching == TRUE_m13) ? cached_blocks : NULL;
+		range.skip_cached = (cached_block_cnt) ? TRUE_m13 : FALSE_m13;
+		range.scale = scale;
+		range.scale_factor = scale_factor;
+		range.start_idx = 1;
+		range.n_blocks = n_blocks - 1;
+		range.cache_offset = cache_offset;
+		range.start_block_number = (si4) start_block + 1;
+		range.block_end_index = (ui4) (local_end_idx - tsi[end_block].start_samp_num);
+		range.file_UID = file_UID;
+		if (CMP_decode_runs_m13(tsd_fps, &range, n_runs) == FALSE_m13)
+			return_m13(FALSE_m13);
+		if (cps->params.block_start_index) {  // first block was cached => limit not consumed by a decode (as in CMP_decode_m13(); caching => always applies)
+			cps->decompressed_data = cps->params.cache + cps->params.block_start_index;
+			cps->params.block_start_index = 0;
+		}
+	}
 	if (cps_caching == TRUE_m13)
 		cps->params.cached_block_cnt = n_blocks;  // all blocks now cached
 		
@@ -13248,6 +14924,91 @@ READ_UH_FAIL_m13:
 }
 
 
+ZMAP_m13	*G_read_zone_map_m13(SEG_m13 *seg)
+{
+	si1			data_path[PATH_BYTES_m13], zmap_path[PATH_BYTES_m13];
+	si8			file_len;
+	ui1			*data;
+	FILE_m13		*fp;
+	FILE_TIMES_m13		ft;
+	struct_stat_m13		sb;
+	ZMAP_HDR_m13		*hdr;
+	
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// returns the segment's zone map if its file is present, intact, & current (same data file length, modification time, sample & block counts)
+	// result is cached in the segment: a missing or stale zone map is not looked for again until G_build_zone_map_m13() is called
+
+	if (seg == NULL)
+		return_m13(NULL);
+	if (seg->zone_map_read != UNKNOWN_m13)
+		return_m13(seg->zone_map);
+	seg->zone_map_read = FALSE_m13;
+	if (seg->metadata_fps == NULL)
+		return_m13(NULL);
+	
+	sprintf_m13(zmap_path, "%s/%s.%s", seg->path, seg->name, ZMAP_TYPE_STR_m13);
+	if (stat_m13(zmap_path, &sb))
+		return_m13(NULL);
+	file_len = (si8) sb.st_size;
+	if (file_len < (si8) sizeof(ZMAP_HDR_m13))
+		return_m13(NULL);
+
+	data = (ui1 *) malloc_m13((size_t) file_len);
+	G_add_behavior_m13(RETURN_ON_FAIL_m13 | SUPPRESS_OUTPUT_m13);
+	fp = fopen_m13(zmap_path, "r");
+	if (fp) {
+		if (fread_m13((void *) data, sizeof(ui1), (size_t) file_len, fp) != (size_t) file_len)
+			file_len = 0;
+		fclose_m13(fp);
+	}
+	G_pop_behavior_m13();
+	if (fp == NULL || file_len == 0)
+		goto ZMAP_REJECT_m13;
+	
+	// validate
+	hdr = (ZMAP_HDR_m13 *) data;
+	if (hdr->tag != ZMAP_TAG_m13 || hdr->version_major != ZMAP_VER_MAJOR_m13)
+		goto ZMAP_REJECT_m13;
+	if (CRC_validate_m13(data + ZMAP_HDR_CRC_START_OFFSET_m13, (si8) sizeof(ZMAP_HDR_m13) - ZMAP_HDR_CRC_START_OFFSET_m13, hdr->header_CRC) == FALSE_m13)
+		goto ZMAP_REJECT_m13;
+	if (hdr->n_blocks < 1 || file_len != (si8) sizeof(ZMAP_HDR_m13) + ((si8) hdr->n_blocks * (si8) sizeof(ZMAP_BLOCK_m13)))
+		goto ZMAP_REJECT_m13;
+	if (CRC_validate_m13(data + sizeof(ZMAP_HDR_m13), file_len - (si8) sizeof(ZMAP_HDR_m13), hdr->body_CRC) == FALSE_m13)
+		goto ZMAP_REJECT_m13;
+	
+	// currency
+	if (hdr->number_of_samples != seg->metadata_fps->metadata->time_series_section_2.number_of_samples)
+		goto ZMAP_REJECT_m13;
+	if (seg->ts_inds_fps && seg->ts_inds_fps->uh->n_entries != (si8) hdr->n_blocks + 1)  // terminal index
+		goto ZMAP_REJECT_m13;
+	sprintf_m13(data_path, "%s/%s.%s", seg->path, seg->name, TS_DATA_TYPE_STR_m13);
+	if (stat_m13(data_path, &sb))
+		goto ZMAP_REJECT_m13;
+	if ((si8) sb.st_size != hdr->data_len)
+		goto ZMAP_REJECT_m13;
+	G_file_times_m13(NULL, data_path, &ft, FALSE_m13);
+	if (ft.modification != hdr->data_mod_time)
+		goto ZMAP_REJECT_m13;
+	
+	seg->zone_map = (ZMAP_m13 *) calloc_m13((size_t) 1, sizeof(ZMAP_m13));
+	seg->zone_map->data = data;
+	seg->zone_map->header = hdr;
+	seg->zone_map->blocks = (ZMAP_BLOCK_m13 *) (data + sizeof(ZMAP_HDR_m13));
+	seg->zone_map->max_blocks = hdr->n_blocks;
+	seg->zone_map_read = TRUE_m13;
+	
+	return_m13(seg->zone_map);
+	
+ZMAP_REJECT_m13:
+	free_m13((void *) data);
+	
+	return_m13(NULL);
+}
+
+
 tern	G_rec_inds_ordered_m13(REC_IDX_m13 *inds, si8 n_recs)
 {
 	si8		i;
@@ -13634,6 +15395,72 @@ tern	G_reset_metadata_for_update_m13(FPS_m13 *fps)
 }
 
 
+static void	G_release_lazy_segments_m13(CHAN_m13 *chan)
+{
+	si4		i, n_chans, n_open, max_open, mapped_segs, limit, oldest_idx, slice_start_idx, slice_end_idx;
+	si8		oldest_time;
+	SEG_m13		*seg;
+	SESS_m13	*sess;
+	PROC_GLOBS_m13	*pg;
+
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// LH_LAZY_SEG_OPEN_m13: free the least recently read segments of this channel beyond its share of the open file budget
+	// segments of the current slice, & segments not opened on demand (allocated en bloc), are never released
+	// a released slot is NULL again, & reopens on its next read (see G_read_channel_m13())
+
+	if (chan->segs == NULL)
+		return_void_m13;
+	pg = G_proc_globs_m13(chan);
+	mapped_segs = pg->current_session.n_segments;
+	
+	// channel's share: the segment count at which MAX_OPEN_FILES_m13() reaches the process limit
+	n_chans = 1;
+	sess = (SESS_m13 *) chan->parent;
+	if (sess)
+		if (sess->type_code == SESS_TYPE_CODE_m13)
+			if (sess->n_ts_chans + sess->n_vid_chans > 1)
+				n_chans = sess->n_ts_chans + sess->n_vid_chans;
+	limit = PROC_open_file_limit_m13();
+	max_open = (limit - (2 * n_chans) - 5) / ((5 * n_chans) + 2);
+	if (max_open < 1)
+		max_open = 1;
+
+	n_open = 0;
+	for (i = 0; i < mapped_segs; ++i)
+		if (chan->segs[i])
+			++n_open;
+	
+	// release oldest first (usually one per read in steady state, so a scan per release beats sorting)
+	slice_start_idx = chan->slice.start_seg_num - 1;
+	slice_end_idx = chan->slice.end_seg_num - 1;
+	while (n_open > max_open) {
+		oldest_idx = -1;
+		oldest_time = 0;
+		for (i = 0; i < mapped_segs; ++i) {
+			if ((seg = chan->segs[i]) == NULL)
+				continue;
+			if (i >= slice_start_idx && i <= slice_end_idx)  // in current slice
+				continue;
+			if (seg->allocated != TRUE_m13)
+				continue;
+			if (oldest_idx == -1 || seg->access_time < oldest_time) {
+				oldest_idx = i;
+				oldest_time = seg->access_time;
+			}
+		}
+		if (oldest_idx == -1)  // nothing releasable
+			break;
+		G_free_segment_m13((void *) (chan->segs + oldest_idx));  // sets slot to NULL
+		--n_open;
+	}
+
+	return_void_m13;
+}
+
+
 // restore "path" from its pre-image "tmp_path" by STREAMING through fwrite_m13() - NOT by renaming:
 // a failed in-place rewrite has already pushed partial content through the parity hooks, so the restore
 // must run the same machinery to leave parity coherent with the restored bytes; returns TRUE_m13 on success
@@ -14152,6 +15979,79 @@ si4 G_segment_range_m13(void *level_header, SLICE_m13 *slice)
 }
 
 
+static tern	G_segment_sidecar_jobs_m13(void *level_header, pthread_fn_m13 thread_f, const si1 *thread_name)
+{
+	tern		threading, r_val;
+	si4		i, j, n_chans, n_segs, n_jobs;
+	LH_m13		*lh;
+	SESS_m13	*sess;
+	CHAN_m13	**chans, *chan;
+	SEG_m13		*seg;
+	PROC_JOB_m13	*jobs;
+	PROC_GLOBS_m13	*pg;
+	
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// runs thread_f (a segment sidecar builder) as one low priority job per open, unencrypted time series segment of a session or channel
+	// returns TRUE_m13 if all jobs succeeded; encrypted segments are skipped & do not count as failures
+
+	lh = (LH_m13 *) level_header;
+	if (lh == NULL) {
+		G_set_error_m13(E_GEN_m13, "level is null");
+		return_m13(FALSE_m13);
+	}
+	switch (lh->type_code) {
+		case SESS_TYPE_CODE_m13:
+			sess = (SESS_m13 *) lh;
+			chans = sess->ts_chans;
+			n_chans = sess->n_ts_chans;
+			break;
+		case TS_CHAN_TYPE_CODE_m13:
+			chan = (CHAN_m13 *) lh;
+			chans = &chan;
+			n_chans = 1;
+			break;
+		default:
+			G_set_error_m13(E_GEN_m13, "invalid level type");
+			return_m13(FALSE_m13);
+	}
+	pg = G_proc_globs_m13(lh);
+	n_segs = pg->current_session.n_segments;
+	
+	jobs = (PROC_JOB_m13 *) calloc((size_t) n_chans * (size_t) n_segs, sizeof(PROC_JOB_m13));
+	if (jobs == NULL) {
+		G_set_error_m13(E_ALLOC_m13, NULL);
+		return_m13(FALSE_m13);
+	}
+	for (n_jobs = i = 0; i < n_chans; ++i) {
+		for (j = 0; j < n_segs; ++j) {
+			seg = chans[i]->segs[j];
+			if (seg == NULL || seg->metadata_fps == NULL)
+				continue;
+			if (seg->metadata_fps->uh->time_series_data_encryption != NO_ENCRYPTION_m13)
+				continue;
+			jobs[n_jobs].name = thread_name;
+			jobs[n_jobs].function = thread_f;
+			jobs[n_jobs].function_arg = (void *) seg;
+			jobs[n_jobs].priority = PROC_LOW_PRIORITY_m13;
+			jobs[n_jobs].skip = FALSE_m13;
+			++n_jobs;
+		}
+	}
+	if (n_jobs == 0) {
+		free(jobs);
+		return_m13(TRUE_m13);
+	}
+	
+	threading = (n_jobs == 1) ? FALSE_m13 : PROC_default_threading_m13(lh);
+	r_val = PROC_jobs_distribute_m13(jobs, n_jobs, 0, PROC_JOBS_PER_CORE_DEFAULT_m13, threading, TRUE_m13);  // waits for all: a failed launch mustn't free jobs still running
+	free(jobs);
+
+	return_m13(r_val);
+}
+
 ui4	*G_segment_video_start_frames_m13(FPS_m13 *vid_inds_fps, ui4 *n_video_files)
 {
 	ui4		j, *start_frames, local_n_video_files;
@@ -14285,6 +16185,68 @@ tern	G_session_directory_m13(FPS_m13 *fps)
 }
 
 
+static si4	G_session_manifest_compare_m13(const void *a, const void *b)
+{
+	// entries sort & search by rel_path (first member, so a key string & an entry compare alike)
+	return(strcmp((si1 *) a, (si1 *) b));
+}
+
+
+ui1	*G_session_manifest_image_m13(SESS_MNFST_m13 *mnfst, const si1 *path, si8 *len)
+{
+	si8			sess_path_len;
+	const si1		*rel_path;
+	ui1			*image;
+	FILE_TIMES_m13		ft;
+	struct_stat_m13		sb;
+	SESS_MNFST_ENTRY_m13	*entry;
+	UH_m13			*uh;
+	
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// returns the manifest image of the file at path (its on-disk bytes, universal header first) if the file is unchanged since
+	// the manifest was built, else NULL; unchanged == same length & modification time (the library dictates lib_mod_time to
+	// the file system on every write close, so a library write always changes it) - a metadata check (stat_m13() & file times)
+	// instead of an open, read & close
+	
+	if (mnfst == NULL || STR_is_empty_m13(path) == TRUE_m13)
+		return_m13(NULL);
+	if (mnfst->header->n_files == 0)
+		return_m13(NULL);
+	sess_path_len = strlen(mnfst->sess_path);
+	if (strncmp(path, mnfst->sess_path, (size_t) sess_path_len) || path[sess_path_len] != '/')
+		return_m13(NULL);
+	rel_path = path + sess_path_len + 1;
+	
+	entry = (SESS_MNFST_ENTRY_m13 *) bsearch((void *) rel_path, (void *) mnfst->files, (size_t) mnfst->header->n_files, sizeof(SESS_MNFST_ENTRY_m13), G_session_manifest_compare_m13);
+	if (entry == NULL)  // not imaged (e.g. too large, or created since the build)
+		return_m13(NULL);
+	image = mnfst->data + entry->offset;
+	uh = (UH_m13 *) image;  // entry CRCs were copied from this universal header at the build
+	if (uh->header_CRC != entry->header_CRC || uh->body_CRC != entry->body_CRC) {
+		mnfst->stale = TRUE_m13;
+		return_m13(NULL);
+	}
+
+	// file unchanged
+	if (stat_m13(path, &sb)) {
+		mnfst->stale = TRUE_m13;
+		return_m13(NULL);
+	}
+	G_file_times_m13(NULL, path, &ft, FALSE_m13);
+	if ((si8) sb.st_size != entry->len || ft.modification != entry->mod_time) {
+		mnfst->stale = TRUE_m13;
+		return_m13(NULL);
+	}
+	
+	if (len)
+		*len = entry->len;
+
+	return_m13(image);
+}
+
 si1	*G_session_path_for_path_m13(const si1 *path, si1 *sess_path)
 {
 	si1		tmp_path[PATH_BYTES_m13];
@@ -17370,7 +19332,7 @@ tern	G_sort_records_m13(FPS_m13 *ri_fps, FPS_m13 *rd_fps)
 	}
 
 	// update FPSs (buffer ownership transfers to the FPSs here)
-	free_m13(ri_fps->params.raw_data);
+	FPS_free_raw_data_m13(&ri_fps->params);
 	ri_fps->params.raw_data = ri_data;
 	ri_fps->params.raw_data_bytes = malloc_size_m13(ri_data);
 	if (ri_fps->params.raw_data_bytes == 0)  // size query unavailable (MATLAB persistent allocation): use the requested size
@@ -17385,7 +19347,7 @@ tern	G_sort_records_m13(FPS_m13 *ri_fps, FPS_m13 *rd_fps)
 			if (fclose_m13(ri_fps->params.fp))
 				goto G_SORT_RECORDS_FAIL_m13;
 
-	free_m13(rd_fps->params.raw_data);
+	FPS_free_raw_data_m13(&rd_fps->params);
 	rd_fps->params.raw_data = sorted_rd_data;
 	rd_fps->params.raw_data_bytes = malloc_size_m13(sorted_rd_data);
 	if (rd_fps->params.raw_data_bytes == 0)  // size query unavailable (MATLAB persistent allocation): use the requested size
@@ -17460,6 +19422,304 @@ ui1	G_suggest_kdf_exponent_m13(const si1 *password, tern lib_generated_password)
 }
 
 
+tern	G_stream_close_m13(STREAM_m13 **stream_ptr)
+{
+	STREAM_m13	*stream;
+	
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// waits for any outstanding prefetch, frees the stream, & closes the channel if the stream opened it
+	
+	if (stream_ptr == NULL) {
+		G_set_error_m13(E_GEN_m13, "pointer is null");
+		return_m13(FALSE_m13);
+	}
+	if ((stream = *stream_ptr) == NULL)
+		return_m13(TRUE_m13);
+	
+	if (stream->prefetch_pending == TRUE_m13)
+		PROC_jobs_wait_m13(&stream->job, 1);
+	if (stream->free_chan == TRUE_m13)
+		G_free_channel_m13(stream->chan);
+	if (stream->contigua)
+		free_m13(stream->contigua);
+	if (stream->chunk.samples)
+		free_m13(stream->chunk.samples);
+	if (stream->next_chunk.samples)
+		free_m13(stream->next_chunk.samples);
+	free_m13(stream);
+	*stream_ptr = NULL;
+
+	return_m13(TRUE_m13);
+}
+
+
+static tern	G_stream_fill_m13(STREAM_m13 *stream, STREAM_CHUNK_m13 *chunk)
+{
+	si4		i, seg_idx;
+	si8		n_seg_samps;
+	si4		*samps;
+	SLICE_m13	slice;
+	CHAN_m13	*chan;
+	SEG_m13		*seg;
+	CPS_m13		*cps;
+	CONTIGUON_m13	*contiguon;
+	
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// reads & decodes the chunk at the fill position into chunk->samples, then advances the fill position
+	// (runs in the prefetch thread or the caller's; the stream's channel is only touched by one of them at a time)
+
+	chunk->n_samples = 0;
+	if (stream->fill_contiguon_idx >= stream->n_contigua)  // end of stream
+		return_m13(TRUE_m13);
+	
+	// chunk limits: a chunk never crosses the end of its contiguon
+	contiguon = stream->contigua + stream->fill_contiguon_idx;
+	chunk->contiguon_idx = stream->fill_contiguon_idx;
+	chunk->discontinuity = (stream->fill_samp_num == contiguon->start_samp_num) ? TRUE_m13 : FALSE_m13;
+	chunk->start_samp_num = stream->fill_samp_num;
+	chunk->end_samp_num = (chunk->start_samp_num + stream->chunk_samples) - 1;
+	if (chunk->end_samp_num > contiguon->end_samp_num)
+		chunk->end_samp_num = contiguon->end_samp_num;
+	
+	// read (crosses segment boundaries via the Sgmt records)
+	chan = stream->chan;
+	G_init_slice_m13(&slice);
+	slice.start_samp_num = chunk->start_samp_num;
+	slice.end_samp_num = chunk->end_samp_num;
+	if (G_read_channel_m13(chan, &slice) == NULL)
+		return_m13(FALSE_m13);
+	
+	// gather segment samples
+	samps = chunk->samples;
+	seg_idx = chan->slice.start_seg_num - 1;
+	for (i = chan->slice.start_seg_num; i <= chan->slice.end_seg_num; ++i, ++seg_idx) {
+		seg = chan->segs[seg_idx];
+		if (seg == NULL || seg->ts_data_fps == NULL)
+			continue;
+		if ((cps = seg->ts_data_fps->params.cps) == NULL)
+			continue;
+		n_seg_samps = SLICE_IDX_COUNT_S_m13(seg->slice);
+		if (chunk->n_samples + n_seg_samps > stream->chunk_samples) {  // can't happen: slice is limited to chunk
+			G_set_error_m13(E_GEN_m13, "segment samples exceed chunk");
+			return_m13(FALSE_m13);
+		}
+		memcpy((void *) samps, (void *) cps->decompressed_data, (size_t) n_seg_samps * sizeof(si4));
+		samps += n_seg_samps;
+		chunk->n_samples += n_seg_samps;
+	}
+	chunk->start_time = chan->slice.start_time;
+	chunk->end_time = chan->slice.end_time;
+	
+	// release data of segments the stream has passed (a later read reopens the data file: see G_read_segment_m13())
+	seg_idx = stream->release_seg_num - 1;
+	for (i = stream->release_seg_num; i < chan->slice.end_seg_num; ++i, ++seg_idx) {
+		seg = chan->segs[seg_idx];
+		if (seg && seg->ts_data_fps)
+			FPS_free_m13(&seg->ts_data_fps);
+	}
+	if (stream->release_seg_num < chan->slice.end_seg_num)
+		stream->release_seg_num = chan->slice.end_seg_num;
+
+	// advance
+	stream->fill_samp_num = chunk->end_samp_num + 1;
+	if (stream->fill_samp_num > contiguon->end_samp_num) {
+		if (++stream->fill_contiguon_idx < stream->n_contigua)
+			stream->fill_samp_num = stream->contigua[stream->fill_contiguon_idx].start_samp_num;
+	}
+	
+	return_m13(TRUE_m13);
+}
+
+
+STREAM_CHUNK_m13	*G_stream_next_m13(STREAM_m13 *stream)
+{
+	STREAM_CHUNK_m13	tmp_chunk;
+	
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// returns the next chunk (chunk->n_samples == 0 at end of stream), or NULL on error
+	// the returned chunk's samples are valid until the next call; with prefetch, the following chunk is read meanwhile
+
+	if (stream == NULL) {
+		G_set_error_m13(E_GEN_m13, "stream is null");
+		return_m13(NULL);
+	}
+	
+	if (stream->prefetch_pending == TRUE_m13) {  // prefetched chunk becomes current
+		stream->prefetch_pending = FALSE_m13;
+		if (PROC_jobs_wait_m13(&stream->job, 1) == FALSE_m13)
+			return_m13(NULL);
+		tmp_chunk = stream->chunk;
+		stream->chunk = stream->next_chunk;
+		stream->next_chunk = tmp_chunk;
+	} else if (G_stream_fill_m13(stream, &stream->chunk) == FALSE_m13) {
+		return_m13(NULL);
+	}
+	
+	// launch prefetch of the following chunk
+	if (stream->prefetch == TRUE_m13 && stream->chunk.n_samples && stream->fill_contiguon_idx < stream->n_contigua) {
+		memset((void *) &stream->job, 0, sizeof(PROC_JOB_m13));
+		stream->job.name = "G_stream_thread_m13";
+		stream->job.function = G_stream_thread_m13;
+		stream->job.function_arg = (void *) stream;
+		stream->job.priority = PROC_HIGH_PRIORITY_m13;
+		stream->job.skip = FALSE_m13;
+		if (PROC_jobs_distribute_m13(&stream->job, 1, 0, PROC_JOBS_PER_CORE_DEFAULT_m13, TRUE_m13, FALSE_m13) != FALSE_m13)
+			stream->prefetch_pending = TRUE_m13;
+		else  // launch failed: read synchronously from here on
+			stream->prefetch = FALSE_m13;
+	}
+
+	return_m13(&stream->chunk);
+}
+
+
+STREAM_m13	*G_stream_open_m13(CHAN_m13 *chan, SLICE_m13 *slice, si8 chunk_samples, tern prefetch, ...)  // varargs(chan == NULL): const si1 *chan_path, ui8 lh_flags, const si1 *password
+{
+	tern		free_chan;
+	si1		*chan_path, *password, seg_path[PATH_BYTES_m13], num_str[FILE_NUMBERING_DIGITS_m13 + 1];
+	ui8		flags;
+	si4		seg_idx;
+	si8		i, j, n_contigua;
+	va_list		v_args;
+	CONTIGUON_m13	contiguon;
+	STREAM_m13	*stream;
+	
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// slice == NULL streams the whole channel; chunk_samples <= 0 uses STREAM_CHUNK_SAMPLES_DEFAULT_m13
+	// the stream needs the channel's segment metadata & indices only: no data are read here
+	// a passed channel must not be used by the caller while the stream is open (a prefetch may be reading it)
+
+	// open channel
+	free_chan = FALSE_m13;
+	if (chan == NULL) {
+		va_start(v_args, prefetch);
+		chan_path = va_arg(v_args, si1 *);
+		flags = va_arg(v_args, ui8);
+		password = va_arg(v_args, si1 *);
+		va_end(v_args);
+		chan = G_open_channel_m13(NULL, slice, chan_path, NULL, flags, password);
+		if (chan == NULL)
+			return_m13(NULL);
+		free_chan = TRUE_m13;
+	} else if ((chan->flags & LH_CHAN_OPEN_m13) == 0) {
+		if (G_open_channel_m13(chan, slice, NULL, NULL, LH_NO_FLAGS_m13, NULL) == NULL)
+			return_m13(NULL);
+	} else {  // already open: set stream range
+		if (slice)
+			chan->slice = *slice;
+		else
+			G_init_slice_m13(&chan->slice);
+		chan->slice.conditioned = FALSE_m13;
+		chan->slice.n_segs = UNKNOWN_m13;
+		if (G_segment_range_m13((LH_m13 *) chan, &chan->slice) <= 0)
+			return_m13(NULL);
+		if (chan->slice.start_samp_num == INDEX_NO_ENTRY_m13)
+			chan->slice.start_samp_num = G_index_for_time_m13((LH_m13 *) chan, chan->slice.start_time, FIND_CURRENT_m13);
+		if (chan->slice.end_samp_num == INDEX_NO_ENTRY_m13)
+			chan->slice.end_samp_num = G_index_for_time_m13((LH_m13 *) chan, chan->slice.end_time, FIND_CURRENT_m13);
+	}
+	if (chan->type_code != TS_CHAN_TYPE_CODE_m13 || (chan->flags & LH_READ_SEG_DATA_MASK_m13) == 0) {
+		G_set_error_m13(E_GEN_m13, "streams require a time series channel opened for segment data");
+		if (free_chan == TRUE_m13)
+			G_free_channel_m13(chan);
+		return_m13(NULL);
+	}
+	
+	// open any unopened segments in range (contigua need their indices; extant but unopened segments would read as gaps)
+	seg_idx = chan->slice.start_seg_num - 1;
+	for (i = chan->slice.start_seg_num; i <= chan->slice.end_seg_num; ++i, ++seg_idx) {
+		if (chan->segs[seg_idx])
+			continue;
+		STR_fixed_width_int_m13(num_str, FILE_NUMBERING_DIGITS_m13, i);
+		sprintf_m13(seg_path, "%s/%s_s%s.%s", chan->path, chan->name, num_str, TS_SEG_TYPE_STR_m13);
+		if (G_exists_m13(seg_path) == DIR_EXISTS_m13)
+			chan->segs[seg_idx] = G_open_segment_m13(NULL, &chan->slice, seg_path, (LH_m13 *) chan, LH_NO_FLAGS_m13, NULL);
+	}
+
+	// contigua of the stream range (built block-granular: clip to the slice)
+	n_contigua = G_build_contigua_m13((LH_m13 *) chan);
+	for (i = 0, j = 0; i < n_contigua; ++i) {
+		contiguon = chan->contigua[i];
+		if (contiguon.end_samp_num < chan->slice.start_samp_num || contiguon.start_samp_num > chan->slice.end_samp_num)
+			continue;
+		if (contiguon.start_samp_num < chan->slice.start_samp_num) {
+			contiguon.start_samp_num = chan->slice.start_samp_num;
+			contiguon.start_time = chan->slice.start_time;
+		}
+		if (contiguon.end_samp_num > chan->slice.end_samp_num) {
+			contiguon.end_samp_num = chan->slice.end_samp_num;
+			contiguon.end_time = chan->slice.end_time;
+		}
+		chan->contigua[j++] = contiguon;
+	}
+	n_contigua = j;
+	if (n_contigua == 0) {
+		G_set_error_m13(E_GEN_m13, "no data in stream range");
+		if (free_chan == TRUE_m13)
+			G_free_channel_m13(chan);
+		return_m13(NULL);
+	}
+	
+	// set up stream
+	stream = (STREAM_m13 *) calloc_m13((size_t) 1, sizeof(STREAM_m13));
+	stream->chan = chan;
+	stream->free_chan = free_chan;
+	stream->prefetch = (prefetch == TRUE_m13) ? TRUE_m13 : FALSE_m13;
+	stream->prefetch_pending = FALSE_m13;
+	if (chunk_samples <= 0)
+		chunk_samples = STREAM_CHUNK_SAMPLES_DEFAULT_m13;
+	stream->chunk_samples = chunk_samples;
+	stream->n_contigua = n_contigua;
+	stream->contigua = (CONTIGUON_m13 *) malloc_m13((size_t) n_contigua * sizeof(CONTIGUON_m13));
+	memcpy((void *) stream->contigua, (void *) chan->contigua, (size_t) n_contigua * sizeof(CONTIGUON_m13));
+	stream->fill_contiguon_idx = 0;
+	stream->fill_samp_num = stream->contigua[0].start_samp_num;
+	stream->release_seg_num = stream->contigua[0].start_seg_num;
+	stream->chunk.samples = (si4 *) malloc_m13((size_t) chunk_samples * sizeof(si4));
+	if (stream->prefetch == TRUE_m13)
+		stream->next_chunk.samples = (si4 *) malloc_m13((size_t) chunk_samples * sizeof(si4));
+	
+	return_m13(stream);
+}
+
+
+static pthread_rval_m13	G_stream_thread_m13(void *ptr)
+{
+	PROC_JOB_m13	*job;
+	STREAM_m13	*stream;
+
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// prefetch job: fills stream->next_chunk
+	// form required by PROC_jobs_distribute_m13()
+
+	job = (PROC_JOB_m13 *) ptr;
+	job->status = PROC_THREAD_RUNNING_m13;
+
+	stream = (STREAM_m13 *) job->function_arg;
+	if (G_stream_fill_m13(stream, &stream->next_chunk) == TRUE_m13)
+		job->status = PROC_THREAD_SUCCEEDED_m13;
+	else
+		job->status = PROC_THREAD_FAILED_m13;
+	
+	return_m13(PROC_JOB_STATUS_SET_m13);
+}
+
+
 tern	G_swap_names_m13(void *level_header)
 {
 	si1		num_str[FILE_NUMBERING_DIGITS_m13 + 1], seg_name[SEG_NAME_BYTES_m13];
@@ -17918,8 +20178,10 @@ void	G_thread_exit_m13(void)
 	if (G_error_code_m13()) {
 		err = &globals_m13->error;
 		pthread_mutex_lock_m13(&err->isem.mutex);
-		if (err->isem.owner == _id)
+		if (err->isem.owner == _id) {
 			err->isem.owner = PROC_thread_parent_id_m13(_id);  // assign directly - isem_chown_m13() would relock held mutex (deadlock)
+			isem_wake_m13(&err->isem);  // (so wake waiters directly too)
+		}
 		pthread_mutex_unlock_m13(&err->isem.mutex);
 	}
 
@@ -18138,6 +20400,136 @@ TIME_FOR_INDEX_FINALIZE_m13:
 }
 
 
+static tern	G_time_series_data_CRCs_parallel_m13(CRC_SPAN_m13 *data)
+{
+	tern			r_val;
+	si4			i, n_spans;
+	si8			j, target_bytes;
+	CMP_FIXED_BH_m13	*bh;
+	PROC_JOB_m13		*jobs;
+	CRC_SPAN_m13		*spans;
+	
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// pass data->ptr (first block header), data->n_blocks, & data->calculate
+	// splits the blocks into spans of about equal bytes, one per worker thread (small data is done here as one span)
+	// returns data->valid; data->crc is the CRC of all n_bytes (span CRCs combined in order), if calculating
+	
+	// total bytes
+	bh = (CMP_FIXED_BH_m13 *) data->ptr;
+	for (j = data->n_blocks; j--;)
+		bh = (CMP_FIXED_BH_m13 *) ((ui1 *) bh + bh->total_block_bytes);
+	data->n_bytes = (si8) ((ui1 *) bh - data->ptr);
+	
+	n_spans = CRC_parallel_spans_m13(data->n_bytes);
+	if ((si8) n_spans > data->n_blocks)
+		n_spans = (si4) data->n_blocks;
+	jobs = NULL;
+	if (n_spans > 1)
+		jobs = (PROC_JOB_m13 *) calloc((size_t) n_spans, sizeof(PROC_JOB_m13) + sizeof(CRC_SPAN_m13));
+	if (jobs == NULL) {  // one span (or allocation failed): this thread
+		G_time_series_data_CRCs_span_m13(data);
+		return_m13(data->valid);
+	}
+	spans = (CRC_SPAN_m13 *) (jobs + n_spans);
+	
+	// spans of whole blocks (last span takes the remainder)
+	target_bytes = data->n_bytes / (si8) n_spans;
+	bh = (CMP_FIXED_BH_m13 *) data->ptr;
+	for (i = 0, j = data->n_blocks; i < n_spans && j; ++i) {
+		spans[i].ptr = (ui1 *) bh;
+		spans[i].calculate = data->calculate;
+		do {
+			spans[i].n_bytes += (si8) bh->total_block_bytes;
+			++spans[i].n_blocks;
+			bh = (CMP_FIXED_BH_m13 *) ((ui1 *) bh + bh->total_block_bytes);
+		} while (--j && (i == n_spans - 1 || spans[i].n_bytes < target_bytes));
+		jobs[i].name = "G_time_series_data_CRCs_thread_m13";
+		jobs[i].function = G_time_series_data_CRCs_thread_m13;
+		jobs[i].function_arg = (void *) (spans + i);
+		jobs[i].priority = PROC_HIGH_PRIORITY_m13;
+		jobs[i].skip = FALSE_m13;
+	}
+	n_spans = i;
+	
+	// in calculate mode span jobs write block CRCs into the data: none may still be running when this thread redoes the spans
+	// (distribution waits, running queued spans itself meanwhile)
+	r_val = PROC_jobs_distribute_m13(jobs, n_spans, 0, PROC_JOBS_PER_CORE_DEFAULT_m13, TRUE_m13, TRUE_m13);
+	if (r_val == FALSE_m13) {  // launch failed: this thread
+		free(jobs);
+		G_time_series_data_CRCs_span_m13(data);
+		return_m13(data->valid);
+	}
+	
+	// combine
+	data->crc = CRC_START_VALUE_m13;
+	data->valid = TRUE_m13;
+	for (i = 0; i < n_spans; ++i) {
+		if (data->calculate == TRUE_m13)
+			data->crc = CRC_combine_m13(data->crc, spans[i].crc, spans[i].n_bytes);
+		else if (spans[i].valid == FALSE_m13)
+			data->valid = FALSE_m13;
+	}
+	free(jobs);
+	
+	return_m13(data->valid);
+}
+
+
+static void	G_time_series_data_CRCs_span_m13(CRC_SPAN_m13 *span)
+{
+	si8			i, block_bytes;
+	CMP_FIXED_BH_m13	*bh;
+	
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// calculates (& CRCs the bytes of) or validates span->n_blocks block CRCs; validation stops at the first bad block
+	
+	span->crc = CRC_START_VALUE_m13;
+	span->valid = TRUE_m13;
+	bh = (CMP_FIXED_BH_m13 *) span->ptr;
+	for (i = span->n_blocks; i--;) {
+		// CMP blocks lead with the 8-byte block start UID, so CRC coverage starts at the block flags (offset 12), not at sizeof(crc4) as in record headers
+		block_bytes = (si8) bh->total_block_bytes - CMP_BLOCK_CRC_START_OFFSET_m13;
+		if (span->calculate == TRUE_m13) {
+			bh->block_CRC = CRC_calculate_m13((ui1 *) bh + CMP_BLOCK_CRC_START_OFFSET_m13, block_bytes);  // calculate block CRC value
+			span->crc = CRC_update_m13((ui1 *) bh, CMP_BLOCK_CRC_START_OFFSET_m13, span->crc);  // add block start UID & stored block CRC value to span CRC
+			span->crc = CRC_combine_m13(span->crc, bh->block_CRC, block_bytes);  // combine block CRC with span CRC
+		} else if (CRC_validate_m13((ui1 *) bh + CMP_BLOCK_CRC_START_OFFSET_m13, block_bytes, bh->block_CRC) == FALSE_m13) {
+			span->valid = FALSE_m13;
+			break;
+		}
+		bh = (CMP_FIXED_BH_m13 *) ((ui1 *) bh + bh->total_block_bytes);
+	}
+	
+	return_void_m13;
+}
+
+
+static pthread_rval_m13	G_time_series_data_CRCs_thread_m13(void *ptr)
+{
+	PROC_JOB_m13	*job;
+
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// form required by PROC_jobs_distribute_m13(): job->function_arg is a CRC_SPAN_m13 * of whole CMP blocks
+
+	job = (PROC_JOB_m13 *) ptr;
+	job->status = PROC_THREAD_RUNNING_m13;
+
+	G_time_series_data_CRCs_span_m13((CRC_SPAN_m13 *) job->function_arg);
+	job->status = PROC_THREAD_SUCCEEDED_m13;
+	
+	return_m13(PROC_JOB_STATUS_SET_m13);
+}
+
+
 si1	*G_unseal_password_string_m13(si1 *password_string, const ui1 *anchor_private_key, UH_m13 *universal_header)
 {
 	tern	valid;
@@ -19755,8 +22147,7 @@ tern	G_validate_record_data_CRCs_m13(FPS_m13 *fps)
 tern	G_validate_time_series_data_CRCs_m13(FPS_m13 *fps)
 {
 	tern  		valid;
-	si8 		i;
-	CMP_FIXED_BH_m13	*bh;
+	CRC_SPAN_m13	data;
 	
 #ifdef FT_DEBUG_m13
 	G_push_function_m13();
@@ -19769,15 +22160,13 @@ tern	G_validate_time_series_data_CRCs_m13(FPS_m13 *fps)
 	// CRC validation on - it does on Linux, & only misses on macOS by the luck of the allocation.
 	if (fps->params.cps == NULL)
 		return_m13(UNKNOWN_m13);
-	bh = fps->params.cps->block_header;
-	for (i = fps->n_items; i--;) {
-		
-		valid = CRC_validate_m13((ui1 *) bh + CMP_BLOCK_CRC_START_OFFSET_m13, bh->total_block_bytes - CMP_BLOCK_CRC_START_OFFSET_m13, bh->block_CRC);
-		if (valid == FALSE_m13)
-			return_m13(valid);
-		
-		bh = (CMP_FIXED_BH_m13 *) ((ui1 *) bh + bh->total_block_bytes);
-	}
+
+	// large data split across worker threads
+	memset((void *) &data, 0, sizeof(CRC_SPAN_m13));
+	data.ptr = (ui1 *) fps->params.cps->block_header;
+	data.n_blocks = fps->n_items;
+	data.calculate = FALSE_m13;
+	valid = G_time_series_data_CRCs_parallel_m13(&data);
 	
 	return_m13(valid);
 }
@@ -19896,6 +22285,645 @@ void	G_write_medlibrc_m13(const si1 *path)
 }
 
 
+tern	G_write_session_manifest_m13(SESS_m13 *sess)
+{
+	tern			update_parity;
+	si1			mnfst_dir[PATH_BYTES_m13], mnfst_path[PATH_BYTES_m13], tmp_path[PATH_BYTES_m13], seg_dir[PATH_BYTES_m13], num_str[FILE_NUMBERING_DIGITS_m13 + 1];
+	si1			chan_name[NAME_BYTES_m13], chan_ext[TYPE_BYTES_m13], **chan_list, **cands, *regex_str;
+	const si1		*seg_ext, *md_ext, *idx_ext;
+	si4			i, j, k, n_chans, n_segs, n_cands, n_files, max_files;
+	si8			len, rel_start, image_bytes, images_alloced, base_offset;
+	ui1			*images;
+	ui8			session_UID;
+	crc4			crc;
+	tern			written;
+	FILE_m13		*fp;
+	FILE_TIMES_m13		ft, dir_ft;
+	struct_stat_m13		sb;
+	PROC_GLOBS_m13		*pg;
+	SESS_MNFST_HDR_m13	hdr;
+	SESS_MNFST_ENTRY_m13	*dirs, *files, *entry, *old_entry;
+	SESS_MNFST_m13		*old;
+	UH_m13			*uh;
+	
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// (re)builds the session manifest from the file system (not from what is open: a later open of a different slice still hits)
+	// images are read, not copied from open FPSs, because an FPS holds decrypted data & the manifest holds on-disk bytes
+	// incremental: an image in the manifest the session opened with is reused while its file is unchanged (checked as when served:
+	// same length & modification time), so a rebuild reads only the files written since (the rest cost a stat each)
+	// failure (e.g. a read-only session directory) is silent & leaves sessions opening from the file system
+
+	if (sess == NULL)
+		return_m13(FALSE_m13);
+	pg = G_proc_globs_m13(sess);
+	if (STR_is_empty_m13(pg->current_session.path) == TRUE_m13)
+		return_m13(FALSE_m13);
+	n_segs = pg->current_session.n_segments;
+	if (n_segs <= 0)
+		return_m13(FALSE_m13);
+	old = pg->current_session.manifest;
+	if (old && old->header->n_files == 0)
+		old = NULL;
+
+#if defined MACOS_m13 || defined LINUX_m13
+	regex_str = "[tv]icd";
+#endif
+#ifdef WINDOWS_m13
+	regex_str = "?icd";
+#endif
+	G_add_behavior_m13(RETURN_ON_FAIL_m13 | SUPPRESS_OUTPUT_m13);
+	
+	// manifest subdirectory first (creating it changes the session directory), then the session directory time the channel list is valid for:
+	// taken before the listing, so a channel added or removed during the build still shows as a mismatch
+	sprintf_m13(mnfst_dir, "%s/%s", pg->current_session.path, SESS_MNFST_DIR_STR_m13);
+	if (G_exists_m13(mnfst_dir) != DIR_EXISTS_m13) {
+		if (md_m13(mnfst_dir) == FALSE_m13) {
+			G_pop_behavior_m13();
+			return_m13(FALSE_m13);
+		}
+	}
+	G_file_times_m13(NULL, pg->current_session.path, &dir_ft, FALSE_m13);
+	chan_list = G_file_list_m13(NULL, &n_chans, pg->current_session.path, NULL, regex_str, GFL_FULL_PATH_m13);
+	if (n_chans == 0) {
+		G_pop_behavior_m13();
+		return_m13(FALSE_m13);
+	}
+	rel_start = strlen(pg->current_session.path) + 1;
+	
+	// directory list (file list order, as G_open_session_m13() would get it)
+	dirs = (SESS_MNFST_ENTRY_m13 *) calloc_m13((size_t) n_chans, sizeof(SESS_MNFST_ENTRY_m13));
+	for (i = 0; i < n_chans; ++i) {
+		if (strlen(chan_list[i]) - rel_start >= SESS_MNFST_REL_PATH_BYTES_m13)
+			break;
+		strcpy(dirs[i].rel_path, chan_list[i] + rel_start);
+		G_file_times_m13(NULL, chan_list[i], &ft, FALSE_m13);
+		dirs[i].mod_time = ft.modification;
+	}
+	if (i < n_chans) {  // unrepresentable path
+		free_m13((void *) chan_list);
+		free_m13((void *) dirs);
+		G_pop_behavior_m13();
+		return_m13(FALSE_m13);
+	}
+
+	// images: session record indices, then per channel: channel record indices & each segment's metadata, indices & record indices
+	cands = (si1 **) calloc_2D_m13((size_t) ((n_segs * 3) + 1), PATH_BYTES_m13, sizeof(si1));
+	files = NULL;
+	images = NULL;
+	n_files = max_files = 0;
+	image_bytes = images_alloced = 0;
+	session_UID = UID_NO_ENTRY_m13;
+	for (k = -1; k < n_chans; ++k) {
+		n_cands = 0;
+		if (k == -1) {
+			sprintf_m13(cands[n_cands++], "%s/%s.%s", pg->current_session.path, pg->current_session.fs_name, REC_INDS_TYPE_STR_m13);
+		} else {
+			G_path_parts_m13(chan_list[k], NULL, chan_name, chan_ext);
+			if (strcmp(chan_ext, TS_CHAN_TYPE_STR_m13) == 0) {
+				seg_ext = TS_SEG_TYPE_STR_m13;
+				md_ext = TS_METADATA_TYPE_STR_m13;
+				idx_ext = TS_INDS_TYPE_STR_m13;
+			} else {
+				seg_ext = VID_SEG_TYPE_STR_m13;
+				md_ext = VID_METADATA_TYPE_STR_m13;
+				idx_ext = VID_INDS_TYPE_STR_m13;
+			}
+			sprintf_m13(cands[n_cands++], "%s/%s.%s", chan_list[k], chan_name, REC_INDS_TYPE_STR_m13);
+			for (j = 1; j <= n_segs; ++j) {
+				STR_fixed_width_int_m13(num_str, FILE_NUMBERING_DIGITS_m13, j);
+				sprintf_m13(seg_dir, "%s/%s_s%s.%s", chan_list[k], chan_name, num_str, seg_ext);
+				sprintf_m13(cands[n_cands++], "%s/%s_s%s.%s", seg_dir, chan_name, num_str, md_ext);
+				sprintf_m13(cands[n_cands++], "%s/%s_s%s.%s", seg_dir, chan_name, num_str, idx_ext);
+				sprintf_m13(cands[n_cands++], "%s/%s_s%s.%s", seg_dir, chan_name, num_str, REC_INDS_TYPE_STR_m13);
+			}
+		}
+		
+		for (i = 0; i < n_cands; ++i) {
+			if (stat_m13(cands[i], &sb))
+				continue;  // not every segment, or record file, exists
+			len = (si8) sb.st_size;
+			if (len <= UH_BYTES_m13 || len > SESS_MNFST_MAX_IMAGE_BYTES_m13 || image_bytes + len > SESS_MNFST_MAX_BYTES_m13)
+				continue;
+			if (strlen(cands[i]) - rel_start >= SESS_MNFST_REL_PATH_BYTES_m13)
+				continue;
+			G_file_times_m13(NULL, cands[i], &ft, FALSE_m13);  // before the read: a write racing the build leaves the entry stale, never wrong
+			if (image_bytes + len > images_alloced) {
+				images_alloced = (image_bytes + len) * 2;
+				images = (ui1 *) realloc_m13((void *) images, images_alloced);
+			}
+			old_entry = NULL;
+			if (old)
+				old_entry = (SESS_MNFST_ENTRY_m13 *) bsearch((void *) (cands[i] + rel_start), (void *) old->files, (size_t) old->header->n_files, sizeof(SESS_MNFST_ENTRY_m13), G_session_manifest_compare_m13);
+			if (old_entry && old_entry->len == len && old_entry->mod_time == ft.modification) {
+				memcpy((void *) (images + image_bytes), (void *) (old->data + old_entry->offset), (size_t) len);
+			} else {
+				fp = fopen_m13(cands[i], "r");
+				if (fp == NULL)
+					continue;
+				if ((si8) fread_m13(images + image_bytes, sizeof(ui1), (size_t) len, fp) != len) {
+					fclose_m13(fp);
+					continue;
+				}
+				fclose_m13(fp);
+			}
+			uh = (UH_m13 *) (images + image_bytes);
+			if (uh->n_entries <= 0)
+				continue;  // live or abnormally terminated file: FPS_read_m13() corrects these from the file system
+			if (session_UID == UID_NO_ENTRY_m13)
+				session_UID = uh->session_UID;
+			else if (uh->session_UID != session_UID)
+				continue;
+			if (n_files == max_files) {
+				max_files = (max_files) ? max_files * 2 : 256;
+				files = (SESS_MNFST_ENTRY_m13 *) realloc_m13((void *) files, (si8) max_files * (si8) sizeof(SESS_MNFST_ENTRY_m13));
+			}
+			entry = files + n_files++;
+			memset((void *) entry, 0, sizeof(SESS_MNFST_ENTRY_m13));
+			strcpy(entry->rel_path, cands[i] + rel_start);
+			entry->mod_time = ft.modification;
+			entry->len = len;
+			entry->offset = image_bytes;  // made absolute below
+			entry->header_CRC = uh->header_CRC;
+			entry->body_CRC = uh->body_CRC;
+			image_bytes += len;
+		}
+	}
+	free_m13((void *) cands);
+	free_m13((void *) chan_list);
+	
+	if (n_files == 0) {
+		free_m13((void *) dirs);
+		G_pop_behavior_m13();
+		return_m13(FALSE_m13);
+	}
+	qsort((void *) files, (size_t) n_files, sizeof(SESS_MNFST_ENTRY_m13), G_session_manifest_compare_m13);
+	base_offset = (si8) sizeof(SESS_MNFST_HDR_m13) + ((si8) (n_chans + n_files) * (si8) sizeof(SESS_MNFST_ENTRY_m13));
+	for (i = 0; i < n_files; ++i)
+		files[i].offset += base_offset;
+	
+	// header
+	memset((void *) &hdr, 0, sizeof(SESS_MNFST_HDR_m13));
+	hdr.tag = SESS_MNFST_TAG_m13;
+	hdr.version_major = SESS_MNFST_VER_MAJOR_m13;
+	hdr.version_minor = SESS_MNFST_VER_MINOR_m13;
+	hdr.n_dirs = n_chans;
+	hdr.n_files = n_files;
+	hdr.n_segments = n_segs;
+	hdr.session_UID = session_UID;
+	hdr.session_dir_mod_time = dir_ft.modification;
+	hdr.build_time = G_current_uutc_m13();
+	crc = CRC_update_m13((ui1 *) dirs, (si8) n_chans * (si8) sizeof(SESS_MNFST_ENTRY_m13), CRC_START_VALUE_m13);
+	crc = CRC_update_m13((ui1 *) files, (si8) n_files * (si8) sizeof(SESS_MNFST_ENTRY_m13), crc);
+	hdr.body_CRC = CRC_update_m13(images, image_bytes, crc);
+	hdr.header_CRC = CRC_calculate_m13((ui1 *) &hdr + SESS_MNFST_HDR_CRC_START_OFFSET_m13, (si8) sizeof(SESS_MNFST_HDR_m13) - SESS_MNFST_HDR_CRC_START_OFFSET_m13);
+
+	// write to a temporary file & rename it over the manifest: readers see the old manifest or the new one, never a partial one
+	// (both in the manifest subdirectory: the session directory time is untouched)
+	update_parity = globals_m13->miscellaneous.update_parity;
+	globals_m13->miscellaneous.update_parity = FALSE_m13;  // not a MED file: no parity data
+	sprintf_m13(mnfst_path, "%s/%s.%s", mnfst_dir, pg->current_session.fs_name, SESS_MNFST_TYPE_STR_m13);
+	sprintf_m13(tmp_path, "%s.%d.tmp", mnfst_path, (si4) getpid_m13());  // per process: concurrent builders do not share it
+	written = FALSE_m13;
+	fp = fopen_m13(tmp_path, "w");
+	if (fp) {
+		written = TRUE_m13;
+		if (fwrite_m13((void *) &hdr, sizeof(ui1), sizeof(SESS_MNFST_HDR_m13), fp) != sizeof(SESS_MNFST_HDR_m13))
+			written = FALSE_m13;
+		else if (fwrite_m13((void *) dirs, sizeof(SESS_MNFST_ENTRY_m13), (size_t) n_chans, fp) != (size_t) n_chans)
+			written = FALSE_m13;
+		else if (fwrite_m13((void *) files, sizeof(SESS_MNFST_ENTRY_m13), (size_t) n_files, fp) != (size_t) n_files)
+			written = FALSE_m13;
+		else if (fwrite_m13((void *) images, sizeof(ui1), (size_t) image_bytes, fp) != (size_t) image_bytes)
+			written = FALSE_m13;
+		if (fclose_m13(fp))
+			written = FALSE_m13;
+		if (written == TRUE_m13) {
+		#ifdef WINDOWS_m13
+			if (MoveFileExA(tmp_path, mnfst_path, MOVEFILE_REPLACE_EXISTING) == 0)
+				written = FALSE_m13;
+		#else
+			if (rename(tmp_path, mnfst_path))
+				written = FALSE_m13;
+		#endif
+		}
+		if (written == FALSE_m13)
+			remove(tmp_path);
+	}
+	globals_m13->miscellaneous.update_parity = update_parity;
+	G_pop_behavior_m13();
+
+	free_m13((void *) dirs);
+	free_m13((void *) files);
+	free_m13((void *) images);
+	
+	if (written == FALSE_m13)
+		return_m13(FALSE_m13);
+
+	return_m13(TRUE_m13);
+}
+
+
+tern	G_write_zone_map_m13(FPS_m13 *ts_data_fps)
+{
+	tern		r_val;
+	CPS_m13		*cps;
+	
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// writes the zone map CMP_encode_m13() accumulated (CPS_DF_ZONE_MAP_m13) beside the data file, then resets the accumulation
+	// call once the data file is complete & closed (the zone map records the file's length & modification time)
+
+	if (ts_data_fps == NULL || ts_data_fps->uh->type_code != TS_DATA_TYPE_CODE_m13) {
+		G_set_error_m13(E_GEN_m13, "fps must be time series data");
+		return_m13(FALSE_m13);
+	}
+	cps = ts_data_fps->params.cps;
+	if (cps == NULL || cps->zone_map == NULL || cps->zone_map->header == NULL || cps->zone_map->header->n_blocks == 0) {
+		G_set_error_m13(E_GEN_m13, "no zone map accumulated");
+		return_m13(FALSE_m13);
+	}
+	
+	if (ts_data_fps->uh->time_series_data_encryption != NO_ENCRYPTION_m13) {
+		G_set_error_m13(E_GEN_m13, "time series data are encrypted");
+		r_val = FALSE_m13;
+	} else {
+		r_val = G_zone_map_write_m13(cps->zone_map, ts_data_fps->path, ts_data_fps->uh->segment_UID);
+	}
+	cps->zone_map->header->n_blocks = 0;  // next segment
+
+	return_m13(r_val);
+}
+
+
+static ZMAP_BLOCK_m13	*G_zone_map_add_block_m13(ZMAP_m13 **zmap_ptr)
+{
+	si8		new_max;
+	ZMAP_m13	*zmap;
+	ZMAP_BLOCK_m13	*blk;
+	
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// appends a zeroed block to an accumulating zone map (allocated on first use), numbered on from the previous block
+	
+	if ((zmap = *zmap_ptr) == NULL)
+		zmap = *zmap_ptr = (ZMAP_m13 *) calloc_m13((size_t) 1, sizeof(ZMAP_m13));
+	if (zmap->header == NULL || zmap->header->n_blocks == zmap->max_blocks) {
+		new_max = (zmap->max_blocks) ? zmap->max_blocks << 1 : (si8) 1024;  // ~ 2.5 hours of 8 kHz data in 1 s blocks
+		zmap->data = (ui1 *) realloc_m13((void *) zmap->data, (size_t) (sizeof(ZMAP_HDR_m13) + (new_max * sizeof(ZMAP_BLOCK_m13))));
+		if (zmap->max_blocks == 0)
+			memset((void *) zmap->data, 0, sizeof(ZMAP_HDR_m13));
+		zmap->header = (ZMAP_HDR_m13 *) zmap->data;
+		zmap->blocks = (ZMAP_BLOCK_m13 *) (zmap->data + sizeof(ZMAP_HDR_m13));
+		zmap->max_blocks = new_max;
+	}
+	blk = zmap->blocks + zmap->header->n_blocks;
+	memset((void *) blk, 0, sizeof(ZMAP_BLOCK_m13));
+	if (zmap->header->n_blocks)
+		blk->start_samp_num = blk[-1].start_samp_num + (si8) blk[-1].n_samps;
+	++zmap->header->n_blocks;
+	
+	return_m13(blk);
+}
+
+
+static void	G_zone_map_block_stats_m13(si4 *samps, si8 n_samps, ZMAP_BLOCK_m13 *blk)
+{
+	si4		x, min, max;
+	si8		i, n_valid;
+	sf8		d, sum, sum_sq, mean, shift;
+	
+	// fills the block's statistic fields (not start_time, start_samp_num, or flags)
+	// one pass: sums are taken about the first valid sample, so the variance keeps its precision on offset signals
+
+	min = max = 0;
+	n_valid = 0;
+	shift = sum = sum_sq = (sf8) 0.0;
+	for (i = 0; i < n_samps; ++i) {
+		if ((x = samps[i]) == NAN_SI4_m13)
+			continue;
+		if (n_valid++ == 0) {
+			min = max = x;
+			shift = (sf8) x;
+		} else if (x < min) {
+			min = x;
+		} else if (x > max) {
+			max = x;
+		}
+		d = (sf8) x - shift;
+		sum += d;
+		sum_sq += d * d;
+	}
+	blk->n_samps = (si4) n_samps;
+	blk->n_valid = (si4) n_valid;
+	blk->minimum = min;
+	blk->maximum = max;
+	blk->abs_maximum = (ui4) ((max > -(si8) min) ? (si8) max : -(si8) min);
+	if (n_valid) {
+		mean = sum / (sf8) n_valid;
+		blk->mean = (sf4) (shift + mean);
+		d = (sum_sq / (sf8) n_valid) - (mean * mean);
+		blk->variance = (sf4) ((d > (sf8) 0.0) ? d : (sf8) 0.0);
+	} else {
+		blk->mean = blk->variance = (sf4) 0.0;
+	}
+	
+	return;
+}
+
+
+si8	G_zone_map_exceedances_m13(CHAN_m13 *chan, si8 start_time, si8 end_time, si4 threshold, ZMAP_INTERVAL_m13 **intervals)
+{
+	tern				open_run;
+	si4				j, n_segs, *samps, x;
+	ui4				ax;
+	ui8				saved_flags;
+	si8				b, e, k, i, lo, hi, n_intervals, max_intervals, seg_start, abs_samp, t;
+	sf8				usecs_per_samp;
+	SEG_m13				*seg;
+	SLICE_m13			slice;
+	ZMAP_m13			*zmap;
+	ZMAP_BLOCK_m13			*blk;
+	ZMAP_INTERVAL_m13		*ivl;
+	PROC_GLOBS_m13			*pg;
+	TS_METADATA_SECTION_2_m13	*tmd2;
+	
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// finds the runs of samples with |x| > threshold in [start_time, end_time] (NaNs end a run)
+	// only blocks whose zone map abs_maximum exceeds the threshold are read & decoded, in whole-block slices of about ZMAP_BUILD_CHUNK_SAMPLES_m13
+	// searches the channel's open time series segments that have a current zone map (others are not searched: see G_build_zone_maps_m13())
+	// *intervals is allocated (caller frees; NULL if none); returns the interval count, or -1 on error
+	// a segment read here is left holding its last chunk read: its slice describes those data (not the slice it had on entry)
+	
+	if (chan == NULL || intervals == NULL) {
+		G_set_error_m13(E_GEN_m13, "channel or interval pointer is null");
+		return_m13((si8) -1);
+	}
+	if (threshold < 0) {
+		G_set_error_m13(E_GEN_m13, "threshold is negative");
+		return_m13((si8) -1);
+	}
+	*intervals = NULL;
+	n_intervals = max_intervals = 0;
+	ivl = NULL;
+	pg = G_proc_globs_m13((LH_m13 *) chan);
+	n_segs = pg->current_session.n_segments;
+	
+	for (j = 0; j < n_segs; ++j) {
+		seg = chan->segs[j];
+		if (seg == NULL || seg->metadata_fps == NULL)
+			continue;
+		if ((zmap = G_read_zone_map_m13(seg)) == NULL)
+			continue;
+		tmd2 = &seg->metadata_fps->metadata->time_series_section_2;
+		seg_start = tmd2->session_start_sample_number;
+		usecs_per_samp = (sf8) 1000000.0 / tmd2->sampling_frequency;
+		blk = zmap->blocks;
+		
+		saved_flags = seg->flags;
+		seg->flags = (seg->flags | LH_READ_SLICE_SEG_DATA_m13) & ~(LH_DEFER_TS_DECODE_m13 | LH_GENERATE_EPHEMERAL_DATA_m13);
+		open_run = FALSE_m13;
+		for (b = 0; b < zmap->header->n_blocks; b = e) {
+			// next candidate block
+			if (blk[b].start_time > end_time)
+				break;
+			if (blk[b].n_valid == 0 || blk[b].abs_maximum <= (ui4) threshold || blk[b].start_time + (si8) (((sf8) blk[b].n_samps * usecs_per_samp) + (sf8) 0.5) <= start_time) {
+				e = b + 1;
+				open_run = FALSE_m13;
+				continue;
+			}
+			// extend over following candidate blocks
+			for (e = b + 1; e < zmap->header->n_blocks; ++e) {
+				if (blk[e].n_valid == 0 || blk[e].abs_maximum <= (ui4) threshold || blk[e].start_time > end_time)
+					break;
+				if ((blk[e].start_samp_num + (si8) blk[e].n_samps) - blk[b].start_samp_num > ZMAP_BUILD_CHUNK_SAMPLES_m13)
+					break;
+			}
+			
+			// read & scan
+			G_init_slice_m13(&slice);
+			slice.start_samp_num = seg_start + blk[b].start_samp_num;
+			slice.end_samp_num = (seg_start + blk[e - 1].start_samp_num + (si8) blk[e - 1].n_samps) - 1;
+			if (G_read_segment_m13(seg, &slice) == NULL || seg->ts_data_fps == NULL || seg->ts_data_fps->params.cps == NULL)
+				break;
+			if (seg->slice.start_samp_num != slice.start_samp_num || SLICE_IDX_COUNT_S_m13(seg->slice) != SLICE_IDX_COUNT_S_m13(slice))
+				break;
+			for (k = b; k < e; ++k) {
+				if (blk[k].flags & ZMAP_BF_DISCONTINUITY_m13)
+					open_run = FALSE_m13;
+				samps = seg->ts_data_fps->params.cps->decompressed_data + (blk[k].start_samp_num - blk[b].start_samp_num);
+				lo = 0;
+				hi = (si8) blk[k].n_samps;
+				if (blk[k].start_time < start_time)
+					lo = (si8) ceil((sf8) (start_time - blk[k].start_time) / usecs_per_samp);
+				if (blk[k].start_time + (si8) ((sf8) (hi - 1) * usecs_per_samp) > end_time)
+					hi = (si8) floor((sf8) (end_time - blk[k].start_time) / usecs_per_samp) + 1;
+				for (i = lo; i < hi; ++i) {
+					x = samps[i];
+					ax = (x < 0) ? (ui4) -(si8) x : (ui4) x;
+					if (x == NAN_SI4_m13 || ax <= (ui4) threshold) {
+						open_run = FALSE_m13;
+						continue;
+					}
+					abs_samp = seg_start + blk[k].start_samp_num + i;
+					t = blk[k].start_time + (si8) (((sf8) i * usecs_per_samp) + (sf8) 0.5);
+					if (open_run == TRUE_m13 && ivl->end_samp_num + 1 == abs_samp) {
+						ivl->end_samp_num = abs_samp;
+						ivl->end_time = t;
+						if ((sf4) ax > ivl->value)
+							ivl->value = (sf4) ax;
+						continue;
+					}
+					if (n_intervals == max_intervals) {
+						max_intervals = (max_intervals) ? max_intervals << 1 : (si8) 64;
+						*intervals = (ZMAP_INTERVAL_m13 *) realloc_m13((void *) *intervals, (size_t) max_intervals * sizeof(ZMAP_INTERVAL_m13));
+					}
+					ivl = *intervals + n_intervals++;
+					ivl->start_time = ivl->end_time = t;
+					ivl->start_samp_num = ivl->end_samp_num = abs_samp;
+					ivl->seg_num = j + 1;
+					ivl->value = (sf4) ax;
+					open_run = TRUE_m13;
+				}
+				if (hi < (si8) blk[k].n_samps)
+					open_run = FALSE_m13;
+			}
+			if (e < zmap->header->n_blocks && (blk[e].n_valid == 0 || blk[e].abs_maximum <= (ui4) threshold))
+				open_run = FALSE_m13;
+		}
+		seg->flags = saved_flags;
+		if (b < zmap->header->n_blocks && blk[b].start_time <= end_time) {  // broke out on a read failure
+			G_set_error_m13(E_GEN_m13, "segment data read failed");
+			if (*intervals) {
+				free_m13((void *) *intervals);
+				*intervals = NULL;
+			}
+			return_m13((si8) -1);
+		}
+	}
+	
+	return_m13(n_intervals);
+}
+
+
+si8	G_zone_map_variance_m13(CHAN_m13 *chan, si8 start_time, si8 end_time, sf8 min_variance, ZMAP_INTERVAL_m13 **intervals)
+{
+	si4				j, n_segs;
+	si8				k, n_intervals, max_intervals, abs_start, blk_end_time;
+	sf8				usecs_per_samp;
+	SEG_m13				*seg;
+	ZMAP_m13			*zmap;
+	ZMAP_BLOCK_m13			*blk;
+	ZMAP_INTERVAL_m13		*ivl;
+	PROC_GLOBS_m13			*pg;
+	TS_METADATA_SECTION_2_m13	*tmd2;
+	
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// finds the runs of adjacent blocks with variance > min_variance overlapping [start_time, end_time] from zone maps alone (no data are read)
+	// searches the channel's open time series segments that have a current zone map (others are not searched: see G_build_zone_maps_m13())
+	// *intervals is allocated (caller frees; NULL if none); returns the interval count, or -1 on error
+	
+	if (chan == NULL || intervals == NULL) {
+		G_set_error_m13(E_GEN_m13, "channel or interval pointer is null");
+		return_m13((si8) -1);
+	}
+	*intervals = NULL;
+	n_intervals = max_intervals = 0;
+	ivl = NULL;
+	pg = G_proc_globs_m13((LH_m13 *) chan);
+	n_segs = pg->current_session.n_segments;
+	
+	for (j = 0; j < n_segs; ++j) {
+		seg = chan->segs[j];
+		if (seg == NULL || seg->metadata_fps == NULL)
+			continue;
+		if ((zmap = G_read_zone_map_m13(seg)) == NULL)
+			continue;
+		tmd2 = &seg->metadata_fps->metadata->time_series_section_2;
+		usecs_per_samp = (sf8) 1000000.0 / tmd2->sampling_frequency;
+		for (blk = zmap->blocks, k = 0; k < zmap->header->n_blocks; ++k, ++blk) {
+			if (blk->start_time > end_time)
+				break;
+			if (k + 1 < zmap->header->n_blocks && (blk[1].flags & ZMAP_BF_DISCONTINUITY_m13) == 0)
+				blk_end_time = blk[1].start_time - 1;
+			else
+				blk_end_time = (blk->start_time + (si8) (((sf8) blk->n_samps * usecs_per_samp) + (sf8) 0.5)) - 1;
+			if (blk_end_time < start_time)
+				continue;
+			if (blk->n_valid == 0 || (sf8) blk->variance <= min_variance)
+				continue;
+			abs_start = tmd2->session_start_sample_number + blk->start_samp_num;
+			if (ivl && ivl->seg_num == j + 1 && ivl->end_samp_num + 1 == abs_start && (blk->flags & ZMAP_BF_DISCONTINUITY_m13) == 0) {
+				ivl->end_samp_num = (abs_start + (si8) blk->n_samps) - 1;
+				ivl->end_time = blk_end_time;
+				if (blk->variance > ivl->value)
+					ivl->value = blk->variance;
+				continue;
+			}
+			if (n_intervals == max_intervals) {
+				max_intervals = (max_intervals) ? max_intervals << 1 : (si8) 64;
+				*intervals = (ZMAP_INTERVAL_m13 *) realloc_m13((void *) *intervals, (size_t) max_intervals * sizeof(ZMAP_INTERVAL_m13));
+			}
+			ivl = *intervals + n_intervals++;
+			ivl->start_time = blk->start_time;
+			ivl->end_time = blk_end_time;
+			ivl->start_samp_num = abs_start;
+			ivl->end_samp_num = (abs_start + (si8) blk->n_samps) - 1;
+			ivl->seg_num = j + 1;
+			ivl->value = blk->variance;
+		}
+	}
+	
+	return_m13(n_intervals);
+}
+
+
+static tern	G_zone_map_write_m13(ZMAP_m13 *zmap, const si1 *data_path, ui8 segment_UID)
+{
+	tern		update_parity, written;
+	si1		zmap_path[PATH_BYTES_m13], tmp_path[PATH_BYTES_m13], *c;
+	si8		i, body_len;
+	FILE_m13	*fp;
+	FILE_TIMES_m13	ft;
+	struct_stat_m13	sb;
+	ZMAP_HDR_m13	*hdr;
+	
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// completes the header of an accumulated zone map & writes it beside data_path (a ".tdat" file)
+	// written to a temporary file & renamed over the zone map: readers see the old zone map or the new one, never a partial one
+	
+	if (stat_m13(data_path, &sb)) {
+		G_set_error_m13(E_GEN_m13, "no time series data file");
+		return_m13(FALSE_m13);
+	}
+	G_file_times_m13(NULL, data_path, &ft, FALSE_m13);
+	strcpy(zmap_path, data_path);
+	if ((c = strrchr(zmap_path, '.')) == NULL) {
+		G_set_error_m13(E_GEN_m13, "invalid data file path");
+		return_m13(FALSE_m13);
+	}
+	strcpy(c + 1, ZMAP_TYPE_STR_m13);
+	
+	hdr = zmap->header;
+	hdr->tag = ZMAP_TAG_m13;
+	hdr->version_major = ZMAP_VER_MAJOR_m13;
+	hdr->version_minor = ZMAP_VER_MINOR_m13;
+	for (hdr->number_of_samples = i = 0; i < hdr->n_blocks; ++i)
+		hdr->number_of_samples += (si8) zmap->blocks[i].n_samps;
+	hdr->data_len = (si8) sb.st_size;
+	hdr->data_mod_time = ft.modification;
+	hdr->segment_UID = segment_UID;
+	hdr->build_time = G_current_uutc_m13();
+	body_len = (si8) hdr->n_blocks * (si8) sizeof(ZMAP_BLOCK_m13);
+	hdr->body_CRC = CRC_calculate_m13((ui1 *) zmap->blocks, body_len);
+	hdr->header_CRC = CRC_calculate_m13((ui1 *) hdr + ZMAP_HDR_CRC_START_OFFSET_m13, (si8) sizeof(ZMAP_HDR_m13) - ZMAP_HDR_CRC_START_OFFSET_m13);
+
+	update_parity = globals_m13->miscellaneous.update_parity;
+	globals_m13->miscellaneous.update_parity = FALSE_m13;  // not a MED file: no parity data
+	G_add_behavior_m13(RETURN_ON_FAIL_m13 | SUPPRESS_OUTPUT_m13);
+	sprintf_m13(tmp_path, "%s.%d.tmp", zmap_path, (si4) getpid_m13());  // per process: concurrent builders do not share it
+	written = FALSE_m13;
+	fp = fopen_m13(tmp_path, "w");
+	if (fp) {
+		written = TRUE_m13;
+		if (fwrite_m13((void *) zmap->data, sizeof(ui1), (size_t) (sizeof(ZMAP_HDR_m13) + body_len), fp) != (size_t) (sizeof(ZMAP_HDR_m13) + body_len))
+			written = FALSE_m13;
+		if (fclose_m13(fp))
+			written = FALSE_m13;
+		if (written == TRUE_m13) {
+		#ifdef WINDOWS_m13
+			if (MoveFileExA(tmp_path, zmap_path, MOVEFILE_REPLACE_EXISTING) == 0)
+				written = FALSE_m13;
+		#else
+			if (rename(tmp_path, zmap_path))
+				written = FALSE_m13;
+		#endif
+		}
+		if (written == FALSE_m13)
+			remove(tmp_path);
+	}
+	G_pop_behavior_m13();
+	globals_m13->miscellaneous.update_parity = update_parity;
+
+	return_m13(written);
+}
+
+
 static si4	PW_char_pool_m13(const si1 *password, si4 len)
 {
 	tern	lower, upper, digit, other;
@@ -20134,7 +23162,7 @@ static void	RC_apply_field_m13(RC_FIELD_m13 *f, si1 *str_val, si8 int_val, tern
 static RC_FIELD_m13	*RC_field_table_m13(si4 *n_fields)
 {
 	// targets are addresses within the globals, so the table is filled in at first use
-	static RC_FIELD_m13	table[19];  // ⚠ MUST match the number of entries below - adding a field without growing this overflows into adjacent statics (silently on non-ASan builds)
+	static RC_FIELD_m13	table[23];  // ⚠ MUST match the number of entries below - adding a field without growing this overflows into adjacent statics (silently on non-ASan builds)
 	static tern		built = FALSE_m13;
 	si4			i;
 
@@ -20224,6 +23252,34 @@ static RC_FIELD_m13	*RC_field_table_m13(si4 *n_fields)
 		table[i].rc_type = RC_TERNARY_TYPE_m13;  table[i].target_type = RC_TGT_TERN_m13;
 		table[i].target = (void *) &globals_m13->miscellaneous.threading;  table[i].shift = 0;  ++i;
 
+		table[i].name = "Block Cache";
+		table[i].notes = "Memory (in MB) for a process-wide cache of decoded time series blocks, shared by all open channels\nRevisited data (browsing back & forth, overlapping analysis windows) is copied from memory instead of decoded again\nLeast recently used blocks are dropped to stay within this budget\n0 (the default) turns the cache off";
+		table[i].type_str = "integer";  table[i].options_key = "OPTIONS";
+		table[i].options = NULL;  table[i].dflt = "0";
+		table[i].rc_type = RC_INTEGER_TYPE_m13;  table[i].target_type = RC_TGT_SI8_m13;
+		table[i].target = (void *) &globals_m13->miscellaneous.block_cache_bytes;  table[i].shift = 20;  ++i;
+
+		table[i].name = "Shared Block Cache";
+		table[i].notes = "Memory (in MB) for a host-wide cache of decoded time series blocks in shared memory (Linux only)\nProcesses of the same user reviewing the same sessions decode each block once between them\nThe first process to use the cache creates it at this size; later processes use it as created\nThe cache holds decrypted data: it is readable only by the user that created it\n0 (the default) turns the cache off";
+		table[i].type_str = "integer";  table[i].options_key = "OPTIONS";
+		table[i].options = NULL;  table[i].dflt = "0";
+		table[i].rc_type = RC_INTEGER_TYPE_m13;  table[i].target_type = RC_TGT_SI8_m13;
+		table[i].target = (void *) &globals_m13->miscellaneous.shared_block_cache_bytes;  table[i].shift = 20;  ++i;
+
+		table[i].name = "Session Manifest";
+		table[i].notes = "Keep a manifest file in each session directory with images of the small files every session open reads\n(segment metadata & indices, record indices) & the channel directory list; sessions then open with one file read\nImages are used only while their files are unchanged; anything else is read from the file system as usual\nThe manifest is rebuilt when a session is closed, if it is missing or out of date (needs write access to the session)";
+		table[i].type_str = "ternary";  table[i].options_key = "OPTIONS ONLY";
+		table[i].options = "YES, NO";  table[i].dflt = "NO";
+		table[i].rc_type = RC_TERNARY_TYPE_m13;  table[i].target_type = RC_TGT_TERN_m13;
+		table[i].target = (void *) &globals_m13->miscellaneous.session_manifest;  table[i].shift = 0;  ++i;
+
+		table[i].name = "Segment Overviews";
+		table[i].notes = "Use per-segment overview files (precomputed min/max/mean at power-of-two resolutions) for trace ranges of strongly decimated, unfiltered matrices\nThe segment data are then not decoded; segments without a current overview are read as usual\nOverviews are built by G_build_overviews_m13() (needs write access to the session)";
+		table[i].type_str = "ternary";  table[i].options_key = "OPTIONS ONLY";
+		table[i].options = "YES, NO";  table[i].dflt = "NO";
+		table[i].rc_type = RC_TERNARY_TYPE_m13;  table[i].target_type = RC_TGT_TERN_m13;
+		table[i].target = (void *) &globals_m13->miscellaneous.segment_overviews;  table[i].shift = 0;  ++i;
+
 		table[i].name = "Access Times";
 		table[i].notes = "Record the time of each structure & file access (small overhead on every operation)";
 		table[i].type_str = "ternary";  table[i].options_key = "OPTIONS ONLY";
@@ -20394,6 +23450,31 @@ void	AES_add_round_key_m13(si4 round, ui1 state[][4], ui1 *round_key)
 }
 
 
+void	AES_cipher_blocks_m13(ui1 *data, si8 n_blocks, ui1 *round_key, si4 nr)
+{
+	ui1	state[4][4];
+
+
+	// no function tracking: hot path, as with the other AES cipher functions
+	// in place, n_blocks whole 16 byte blocks (ECB); nr == AES_NR_m13 (10) for AES-128, AES_NR_256_m13 (14) for AES-256
+	// the hardware path keeps AES_HW_LANES_m13 blocks in flight per round
+
+#ifdef HW_CRYPTO_m13
+	if (AES_hw_ready_m13() == TRUE_m13) {
+		AES_cipher_blocks_hw_m13(data, n_blocks, round_key, nr);
+		return;
+	}
+#endif
+
+	for (; n_blocks > 0; --n_blocks) {
+		AES_cipher_nr_m13(data, data, state, round_key, nr);
+		data += ENCRYPTION_BLOCK_BYTES_m13;
+	}
+
+	return;
+}
+
+
 void	AES_cipher_m13(ui1 *in, ui1 *out, ui1 state[][4], ui1 *round_key)
 {
 	AES_cipher_nr_m13(in, out, state, round_key, AES_NR_m13);
@@ -20459,6 +23540,9 @@ void	AES_ctr_blocks_m13(ui1 *data, si8 len, si4 phase, const ui1 *init_ctr_block
 {
 	ui1	state[4][4], ctr_block[ENCRYPTION_BLOCK_BYTES_m13], keystream[ENCRYPTION_BLOCK_BYTES_m13];
 	si4	i, n;
+#ifdef HW_CRYPTO_m13
+	si8	n_blocks;
+#endif
 
 
 	// no function tracking: hot path, as with the other AES cipher functions
@@ -20466,6 +23550,16 @@ void	AES_ctr_blocks_m13(ui1 *data, si8 len, si4 phase, const ui1 *init_ctr_block
 	memcpy(ctr_block, init_ctr_block, ENCRYPTION_BLOCK_BYTES_m13);
 
 	while (len > 0) {
+#ifdef HW_CRYPTO_m13
+		// whole blocks from a block boundary: pipelined hardware kernel (a partial first or last block takes the path below)
+		if (phase == 0 && len >= (AES_HW_LANES_m13 << 4) && AES_hw_ready_m13() == TRUE_m13) {
+			n_blocks = len >> 4;
+			AES_ctr_blocks_hw_m13(data, n_blocks, ctr_block, round_key_256, AES_NR_256_m13);
+			data += n_blocks << 4;
+			len -= n_blocks << 4;
+			continue;
+		}
+#endif
 		AES_cipher_nr_m13(ctr_block, keystream, state, round_key_256, AES_NR_256_m13);
 
 		n = ENCRYPTION_BLOCK_BYTES_m13 - phase;
@@ -20535,7 +23629,7 @@ void	AES_decrypt_256_m13(ui1 *data, si8 len, const ui1 *key, ui1 *expanded_key)
 	ui1	*ui1_p;
 	ui1	*last_c, steal_block[ENCRYPTION_BLOCK_BYTES_m13], recon_block[ENCRYPTION_BLOCK_BYTES_m13];
 	ui8	*ui8_p;
-	si8	j, encryption_blocks, full_blocks, n_leftovers;
+	si8	encryption_blocks, full_blocks, n_leftovers;
 
 #ifdef FT_DEBUG_m13
 	G_push_function_m13();
@@ -20562,11 +23656,8 @@ void	AES_decrypt_256_m13(ui1 *data, si8 len, const ui1 *key, ui1 *expanded_key)
 		--full_blocks;  // last full-block position holds the stolen block: handled with the tail below
 	ui8_p = (ui8 *) state;
 	ui8_p[0] = ui8_p[1] = (ui8) 0;  // zero state array
-	ui1_p = data;
-	for (j = full_blocks; j--;) {
-		AES_inv_cipher_nr_m13(ui1_p, ui1_p, state, round_key, AES_NR_256_m13);
-		ui1_p += ENCRYPTION_BLOCK_BYTES_m13;
-	}
+	AES_inv_cipher_blocks_m13(data, full_blocks, round_key, AES_NR_256_m13);
+	ui1_p = data + (full_blocks << 4);
 
 	// leftover decryption: ciphertext stealing (see AES_encrypt_256_m13)
 	if (n_leftovers) {
@@ -20594,11 +23685,8 @@ void	AES_decrypt_256_m13(ui1 *data, si8 len, const ui1 *key, ui1 *expanded_key)
 // decryption is done in place
 void	AES_decrypt_m13(ui1 *data, si8 len, const si1 *password, ui1 *expanded_key)
 {
-	ui1	state[4][4];
 	ui1	*round_key, local_round_key[AES_EXPANDED_KEY_BYTES_m13];
-	ui1	*ui1_p;
-	ui8	*ui8_p;
-	si8	j, encryption_blocks;
+	si8	encryption_blocks;
 
 #ifdef FT_DEBUG_m13
 	G_push_function_m13();
@@ -20626,13 +23714,7 @@ void	AES_decrypt_m13(ui1 *data, si8 len, const si1 *password, ui1 *expanded_key)
 
 	// decrypt
 	encryption_blocks = len >> 4;
-	ui8_p = (ui8 *) state;
-	ui8_p[0] = ui8_p[1] = (ui8) 0;  // zero state array
-	ui1_p = data;
-	for (j = encryption_blocks; j--;) {
-		AES_inv_cipher_m13(ui1_p, ui1_p, state, round_key);
-		ui1_p += ENCRYPTION_BLOCK_BYTES_m13;
-	}
+	AES_inv_cipher_blocks_m13(data, encryption_blocks, round_key, AES_NR_m13);
 
 	return_void_m13;
 }
@@ -20647,7 +23729,7 @@ void	AES_encrypt_256_m13(ui1 *data, si8 len, const ui1 *key, ui1 *expanded_key)
 	ui1	*ui1_p;
 	ui1	*last_c, steal_block[ENCRYPTION_BLOCK_BYTES_m13];
 	ui8	*ui8_p;
-	si8	j, encryption_blocks, n_leftovers;
+	si8	encryption_blocks, n_leftovers;
 
 #ifdef FT_DEBUG_m13
 	G_push_function_m13();
@@ -20671,11 +23753,8 @@ void	AES_encrypt_256_m13(ui1 *data, si8 len, const ui1 *key, ui1 *expanded_key)
 	encryption_blocks = len >> 4;
 	n_leftovers = len & (si8) 0xF;
 	ui8_p[0] = ui8_p[1] = (ui8) 0;  // zero state array
-	ui1_p = data;
-	for (j = encryption_blocks; j--;) {
-		AES_cipher_nr_m13(ui1_p, ui1_p, state, round_key, AES_NR_256_m13);
-		ui1_p += ENCRYPTION_BLOCK_BYTES_m13;
-	}
+	AES_cipher_blocks_m13(data, encryption_blocks, round_key, AES_NR_256_m13);
+	ui1_p = data + (encryption_blocks << 4);
 
 	// leftover encryption: ciphertext stealing (ECB-CS, per the CBC-CS construction of NIST SP 800-38A addendum / RFC 3962)
 	// the trailing partial block borrows ciphertext from the last full block, so every byte gets true block-cipher
@@ -20703,11 +23782,8 @@ void	AES_encrypt_256_m13(ui1 *data, si8 len, const ui1 *key, ui1 *expanded_key)
 // encryption is done in place
 void	AES_encrypt_m13(ui1 *data, si8 len, const si1 *password, ui1 *expanded_key)
 {
-	ui1	state[AES_NK_m13][AES_NB_m13];
 	ui1	*round_key, local_round_key[AES_EXPANDED_KEY_BYTES_m13];
-	ui1	*ui1_p;
-	ui8	*ui8_p;
-	si8	j, encryption_blocks;
+	si8	encryption_blocks;
 
 #ifdef FT_DEBUG_m13
 	G_push_function_m13();
@@ -20734,14 +23810,8 @@ void	AES_encrypt_m13(ui1 *data, si8 len, const si1 *password, ui1 *expanded_key)
 	}
 
 	// encryption
-	ui8_p = (ui8 *) state;
 	encryption_blocks = len >> 4;
-	ui8_p[0] = ui8_p[1] = (ui8) 0;  // zero state array
-	ui1_p = data;
-	for (j = encryption_blocks; j--;) {
-		AES_cipher_m13(ui1_p, ui1_p, state, round_key);
-		ui1_p += ENCRYPTION_BLOCK_BYTES_m13;
-	}
+	AES_cipher_blocks_m13(data, encryption_blocks, round_key, AES_NR_m13);
 
 	return_void_m13;
 }
@@ -20762,6 +23832,37 @@ static tern	AES_hw_ready_m13(void)  // detection results live in the global tabl
 }
 
 #if defined __x86_64__ || defined __i386__
+HW_AES_FN_ATTR_m13
+static void	AES_cipher_blocks_hw_m13(ui1 *data, si8 n_blocks, ui1 *round_key, si4 nr)
+{
+	si4	r, k;
+	__m128i	rk, blk[AES_HW_LANES_m13];
+
+	// in place; AES_HW_LANES_m13 independent blocks per round, so each AESENC's latency is covered by the others' issue
+	for (; n_blocks >= AES_HW_LANES_m13; n_blocks -= AES_HW_LANES_m13) {
+		rk = _mm_loadu_si128((const __m128i *) round_key);
+		#pragma GCC unroll 8
+		for (k = 0; k < AES_HW_LANES_m13; ++k)
+			blk[k] = _mm_xor_si128(_mm_loadu_si128((const __m128i *) (data + (k << 4))), rk);
+		for (r = 1; r < nr; ++r) {
+			rk = _mm_loadu_si128((const __m128i *) (round_key + (r << 4)));
+			#pragma GCC unroll 8
+			for (k = 0; k < AES_HW_LANES_m13; ++k)
+				blk[k] = _mm_aesenc_si128(blk[k], rk);
+		}
+		rk = _mm_loadu_si128((const __m128i *) (round_key + (nr << 4)));
+		#pragma GCC unroll 8
+		for (k = 0; k < AES_HW_LANES_m13; ++k)
+			_mm_storeu_si128((__m128i *) (data + (k << 4)), _mm_aesenclast_si128(blk[k], rk));
+		data += AES_HW_LANES_m13 << 4;
+	}
+	for (; n_blocks--; data += ENCRYPTION_BLOCK_BYTES_m13)
+		AES_cipher_hw_m13(data, data, round_key, nr);
+
+	return;
+}
+
+
 HW_AES_FN_ATTR_m13
 static void	AES_cipher_hw_m13(ui1 *in, ui1 *out, ui1 *round_key, si4 nr)
 {
@@ -20778,6 +23879,79 @@ static void	AES_cipher_hw_m13(ui1 *in, ui1 *out, ui1 *round_key, si4 nr)
 	return;
 }
 
+HW_AES_FN_ATTR_m13
+static void	AES_ctr_blocks_hw_m13(ui1 *data, si8 n_blocks, ui1 *ctr_block, ui1 *round_key, si4 nr)
+{
+	si4	r, k;
+	ui8	nonce, counter;
+	__m128i	rk, blk[AES_HW_LANES_m13];
+
+	// xors n_blocks whole blocks of keystream into data, AES_HW_LANES_m13 counter blocks in flight per round
+	// ctr_block (nonce || big-endian counter) is advanced past them, as the byte-wise increment in AES_ctr_blocks_m13() would
+	memcpy(&nonce, ctr_block, 8);
+	memcpy(&counter, ctr_block + 8, 8);
+	counter = __builtin_bswap64(counter);
+	for (; n_blocks >= AES_HW_LANES_m13; n_blocks -= AES_HW_LANES_m13) {
+		rk = _mm_loadu_si128((const __m128i *) round_key);
+		#pragma GCC unroll 8
+		for (k = 0; k < AES_HW_LANES_m13; ++k)
+			blk[k] = _mm_xor_si128(_mm_set_epi64x((long long) __builtin_bswap64(counter + (ui8) k), (long long) nonce), rk);
+		for (r = 1; r < nr; ++r) {
+			rk = _mm_loadu_si128((const __m128i *) (round_key + (r << 4)));
+			#pragma GCC unroll 8
+			for (k = 0; k < AES_HW_LANES_m13; ++k)
+				blk[k] = _mm_aesenc_si128(blk[k], rk);
+		}
+		rk = _mm_loadu_si128((const __m128i *) (round_key + (nr << 4)));
+		#pragma GCC unroll 8
+		for (k = 0; k < AES_HW_LANES_m13; ++k) {
+			blk[k] = _mm_aesenclast_si128(blk[k], rk);
+			_mm_storeu_si128((__m128i *) (data + (k << 4)), _mm_xor_si128(blk[k], _mm_loadu_si128((const __m128i *) (data + (k << 4)))));
+		}
+		counter += AES_HW_LANES_m13;
+		data += AES_HW_LANES_m13 << 4;
+	}
+	for (; n_blocks--; data += ENCRYPTION_BLOCK_BYTES_m13) {
+		blk[0] = _mm_set_epi64x((long long) __builtin_bswap64(counter++), (long long) nonce);
+		AES_cipher_hw_m13((ui1 *) blk, (ui1 *) blk, round_key, nr);
+		_mm_storeu_si128((__m128i *) data, _mm_xor_si128(blk[0], _mm_loadu_si128((const __m128i *) data)));
+	}
+	counter = __builtin_bswap64(counter);
+	memcpy(ctr_block + 8, &counter, 8);
+
+	return;
+}
+
+HW_AES_FN_ATTR_m13
+static void	AES_inv_cipher_blocks_hw_m13(ui1 *data, si8 n_blocks, ui1 *round_key, si4 nr)
+{
+	si4	r, k;
+	__m128i	rk, blk[AES_HW_LANES_m13];
+
+	// in place; equivalent inverse cipher schedule (see AES_inv_cipher_hw_m13()), AES_HW_LANES_m13 blocks per round
+	for (; n_blocks >= AES_HW_LANES_m13; n_blocks -= AES_HW_LANES_m13) {
+		rk = _mm_loadu_si128((const __m128i *) (round_key + (nr << 4)));
+		#pragma GCC unroll 8
+		for (k = 0; k < AES_HW_LANES_m13; ++k)
+			blk[k] = _mm_xor_si128(_mm_loadu_si128((const __m128i *) (data + (k << 4))), rk);
+		for (r = nr - 1; r > 0; --r) {
+			rk = _mm_loadu_si128((const __m128i *) (round_key + (r << 4)));
+			#pragma GCC unroll 8
+			for (k = 0; k < AES_HW_LANES_m13; ++k)
+				blk[k] = _mm_aesdec_si128(blk[k], rk);
+		}
+		rk = _mm_loadu_si128((const __m128i *) round_key);
+		#pragma GCC unroll 8
+		for (k = 0; k < AES_HW_LANES_m13; ++k)
+			_mm_storeu_si128((__m128i *) (data + (k << 4)), _mm_aesdeclast_si128(blk[k], rk));
+		data += AES_HW_LANES_m13 << 4;
+	}
+	for (; n_blocks--; data += ENCRYPTION_BLOCK_BYTES_m13)
+		AES_inv_cipher_hw_m13(data, data, round_key, nr);
+
+	return;
+}
+
 HW_AES_FN_ATTR_m13
 static void	AES_inv_cipher_hw_m13(ui1 *in, ui1 *out, ui1 *round_key, si4 nr)
 {
@@ -20798,6 +23972,39 @@ static void	AES_inv_cipher_hw_m13(ui1 *in, ui1 *out, ui1 *round_key, si4 nr)
 #endif  // __x86_64__ || __i386__
 
 #ifdef __aarch64__
+HW_AES_FN_ATTR_m13
+static void	AES_cipher_blocks_hw_m13(ui1 *data, si8 n_blocks, ui1 *round_key, si4 nr)
+{
+	si4		r, k;
+	uint8x16_t	rk, blk[AES_HW_LANES_m13];
+
+	// in place; AES_HW_LANES_m13 independent blocks per round (AESE/AESMC pairs fuse, but each pair still has latency to cover)
+	for (; n_blocks >= AES_HW_LANES_m13; n_blocks -= AES_HW_LANES_m13) {
+		#pragma GCC unroll 8
+		for (k = 0; k < AES_HW_LANES_m13; ++k)
+			blk[k] = vld1q_u8(data + (k << 4));
+		for (r = 0; r < (nr - 1); ++r) {
+			rk = vld1q_u8(round_key + (r << 4));
+			#pragma GCC unroll 8
+			for (k = 0; k < AES_HW_LANES_m13; ++k)
+				blk[k] = vaesmcq_u8(vaeseq_u8(blk[k], rk));
+		}
+		rk = vld1q_u8(round_key + ((nr - 1) << 4));
+		#pragma GCC unroll 8
+		for (k = 0; k < AES_HW_LANES_m13; ++k)
+			blk[k] = vaeseq_u8(blk[k], rk);
+		rk = vld1q_u8(round_key + (nr << 4));
+		#pragma GCC unroll 8
+		for (k = 0; k < AES_HW_LANES_m13; ++k)
+			vst1q_u8(data + (k << 4), veorq_u8(blk[k], rk));
+		data += AES_HW_LANES_m13 << 4;
+	}
+	for (; n_blocks--; data += ENCRYPTION_BLOCK_BYTES_m13)
+		AES_cipher_hw_m13(data, data, round_key, nr);
+
+	return;
+}
+
 HW_AES_FN_ATTR_m13
 static void	AES_cipher_hw_m13(ui1 *in, ui1 *out, ui1 *round_key, si4 nr)
 {
@@ -20817,6 +24024,84 @@ static void	AES_cipher_hw_m13(ui1 *in, ui1 *out, ui1 *round_key, si4 nr)
 	return;
 }
 
+HW_AES_FN_ATTR_m13
+static void	AES_ctr_blocks_hw_m13(ui1 *data, si8 n_blocks, ui1 *ctr_block, ui1 *round_key, si4 nr)
+{
+	si4		r, k;
+	ui8		nonce, counter;
+	uint8x16_t	rk, blk[AES_HW_LANES_m13];
+
+	// xors n_blocks whole blocks of keystream into data, AES_HW_LANES_m13 counter blocks in flight per round
+	// ctr_block (nonce || big-endian counter) is advanced past them, as the byte-wise increment in AES_ctr_blocks_m13() would
+	memcpy(&nonce, ctr_block, 8);
+	memcpy(&counter, ctr_block + 8, 8);
+	counter = __builtin_bswap64(counter);
+	for (; n_blocks >= AES_HW_LANES_m13; n_blocks -= AES_HW_LANES_m13) {
+		#pragma GCC unroll 8
+		for (k = 0; k < AES_HW_LANES_m13; ++k)
+			blk[k] = vreinterpretq_u8_u64(vcombine_u64(vcreate_u64(nonce), vcreate_u64(__builtin_bswap64(counter + (ui8) k))));
+		for (r = 0; r < (nr - 1); ++r) {
+			rk = vld1q_u8(round_key + (r << 4));
+			#pragma GCC unroll 8
+			for (k = 0; k < AES_HW_LANES_m13; ++k)
+				blk[k] = vaesmcq_u8(vaeseq_u8(blk[k], rk));
+		}
+		rk = vld1q_u8(round_key + ((nr - 1) << 4));
+		#pragma GCC unroll 8
+		for (k = 0; k < AES_HW_LANES_m13; ++k)
+			blk[k] = vaeseq_u8(blk[k], rk);
+		rk = vld1q_u8(round_key + (nr << 4));
+		#pragma GCC unroll 8
+		for (k = 0; k < AES_HW_LANES_m13; ++k)
+			vst1q_u8(data + (k << 4), veorq_u8(veorq_u8(blk[k], rk), vld1q_u8(data + (k << 4))));
+		counter += AES_HW_LANES_m13;
+		data += AES_HW_LANES_m13 << 4;
+	}
+	for (; n_blocks--; data += ENCRYPTION_BLOCK_BYTES_m13) {
+		blk[0] = vreinterpretq_u8_u64(vcombine_u64(vcreate_u64(nonce), vcreate_u64(__builtin_bswap64(counter++))));
+		AES_cipher_hw_m13((ui1 *) blk, (ui1 *) blk, round_key, nr);
+		vst1q_u8(data, veorq_u8(blk[0], vld1q_u8(data)));
+	}
+	counter = __builtin_bswap64(counter);
+	memcpy(ctr_block + 8, &counter, 8);
+
+	return;
+}
+
+HW_AES_FN_ATTR_m13
+static void	AES_inv_cipher_blocks_hw_m13(ui1 *data, si8 n_blocks, ui1 *round_key, si4 nr)
+{
+	si4		r, k;
+	uint8x16_t	rk, blk[AES_HW_LANES_m13];
+
+	// in place; equivalent inverse cipher schedule (see AES_inv_cipher_hw_m13()), AES_HW_LANES_m13 blocks per round
+	for (; n_blocks >= AES_HW_LANES_m13; n_blocks -= AES_HW_LANES_m13) {
+		rk = vld1q_u8(round_key + (nr << 4));
+		#pragma GCC unroll 8
+		for (k = 0; k < AES_HW_LANES_m13; ++k)
+			blk[k] = vaesimcq_u8(vaesdq_u8(vld1q_u8(data + (k << 4)), rk));
+		for (r = nr - 1; r > 1; --r) {
+			rk = vld1q_u8(round_key + (r << 4));
+			#pragma GCC unroll 8
+			for (k = 0; k < AES_HW_LANES_m13; ++k)
+				blk[k] = vaesimcq_u8(vaesdq_u8(blk[k], rk));
+		}
+		rk = vld1q_u8(round_key + 16);
+		#pragma GCC unroll 8
+		for (k = 0; k < AES_HW_LANES_m13; ++k)
+			blk[k] = vaesdq_u8(blk[k], rk);
+		rk = vld1q_u8(round_key);
+		#pragma GCC unroll 8
+		for (k = 0; k < AES_HW_LANES_m13; ++k)
+			vst1q_u8(data + (k << 4), veorq_u8(blk[k], rk));
+		data += AES_HW_LANES_m13 << 4;
+	}
+	for (; n_blocks--; data += ENCRYPTION_BLOCK_BYTES_m13)
+		AES_inv_cipher_hw_m13(data, data, round_key, nr);
+
+	return;
+}
+
 HW_AES_FN_ATTR_m13
 static void	AES_inv_cipher_hw_m13(ui1 *in, ui1 *out, ui1 *round_key, si4 nr)
 {
@@ -20868,6 +24153,31 @@ tern	AES_init_tables_m13(void)
 }
 
 
+void	AES_inv_cipher_blocks_m13(ui1 *data, si8 n_blocks, ui1 *round_key, si4 nr)
+{
+	ui1	state[4][4];
+
+
+	// no function tracking: hot path, as with the other AES cipher functions
+	// in place, n_blocks whole 16 byte blocks (ECB); round_key is a decryption schedule (AES_inv_key_expansion_m13() / _256_m13())
+	// the hardware path keeps AES_HW_LANES_m13 blocks in flight per round
+
+#ifdef HW_CRYPTO_m13
+	if (AES_hw_ready_m13() == TRUE_m13) {
+		AES_inv_cipher_blocks_hw_m13(data, n_blocks, round_key, nr);
+		return;
+	}
+#endif
+
+	for (; n_blocks > 0; --n_blocks) {
+		AES_inv_cipher_nr_m13(data, data, state, round_key, nr);
+		data += ENCRYPTION_BLOCK_BYTES_m13;
+	}
+
+	return;
+}
+
+
 void	AES_inv_cipher_m13(ui1 *in, ui1 *out, ui1 state[][4], ui1 *round_key)
 {
 	AES_inv_cipher_nr_m13(in, out, state, round_key, AES_NR_m13);
@@ -22781,6 +26091,247 @@ tern	CMP_binterpolate_sf8_m13(sf8 *in_data, si8 in_len, sf8 *out_data, si8 out_l
 }
 
 
+tern	CMP_block_cache_budget_m13(si8 budget_bytes)
+{
+	si4				i;
+	CMP_BLOCK_CACHE_m13		*cache;
+	CMP_BLOCK_CACHE_SHARD_m13	*shard;
+	
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// sets the process-wide block cache budget & evicts to fit (0 empties the cache & turns it off)
+	// the cache itself is created lazily, on the first store
+
+	if (budget_bytes < 0)
+		budget_bytes = 0;
+	globals_m13->miscellaneous.block_cache_bytes = budget_bytes;
+	
+	cache = globals_m13->CMP_block_cache;
+	if (cache == NULL)
+		return_m13(TRUE_m13);
+	for (i = 0; i < CMP_BLOCK_CACHE_SHARDS_m13; ++i) {
+		shard = cache->shards + i;
+		pthread_mutex_lock_m13(&shard->mutex);
+		CMP_block_cache_evict_m13(shard, budget_bytes / CMP_BLOCK_CACHE_SHARDS_m13);
+		pthread_mutex_unlock_m13(&shard->mutex);
+	}
+	
+	return_m13(TRUE_m13);
+}
+
+
+static void	CMP_block_cache_evict_m13(CMP_BLOCK_CACHE_SHARD_m13 *shard, si8 shard_budget)
+{
+	si4				bucket;
+	CMP_BLOCK_CACHE_ENTRY_m13	*entry, **link;
+
+	// drop least recently used entries until the shard fits its budget (caller holds the shard mutex)
+	// no FT frame: called with a shard lock held, in the read path
+	while (shard->bytes > shard_budget && (entry = shard->lru_tail) != NULL) {
+		CMP_block_cache_shard_m13(entry->file_UID, entry->block_number, &bucket);
+		for (link = shard->buckets + bucket; *link != entry; link = &(*link)->hash_next);
+		*link = entry->hash_next;
+		shard->lru_tail = entry->lru_prev;
+		if (shard->lru_tail)
+			shard->lru_tail->lru_next = NULL;
+		else
+			shard->lru_head = NULL;
+		shard->bytes -= entry->bytes;
+		free_m13((void *) entry);
+	}
+}
+
+
+tern	CMP_block_cache_fetch_m13(CPS_m13 *cps, ui8 file_UID, si8 block_number)
+{
+	tern				hit;
+	si4				bucket;
+	CMP_BLOCK_CACHE_SHARD_m13	*shard;
+	CMP_BLOCK_CACHE_ENTRY_m13	*entry;
+	CMP_FIXED_BH_m13		*bh;
+	
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// On a hit, copies the block's decoded samples to cps->decompressed_ptr & leaves the CPS as CMP_decode_m13()
+	// would for a non-VDS block (discontinuity set, start/end limits consumed). The entry must match the block
+	// header's sample count: anything else is a different file under a reused key, & misses.
+	// Process cache first, then the shared memory cache behind it (a shared hit is promoted to the process cache).
+	
+	if (file_UID == UID_NO_ENTRY_m13)
+		return_m13(FALSE_m13);
+	bh = cps->block_header;
+	
+	hit = FALSE_m13;
+	if (globals_m13->CMP_block_cache != NULL) {
+		shard = CMP_block_cache_shard_m13(file_UID, block_number, &bucket);
+		pthread_mutex_lock_m13(&shard->mutex);
+		for (entry = shard->buckets[bucket]; entry; entry = entry->hash_next)
+			if (entry->file_UID == file_UID && entry->block_number == block_number)
+				break;
+		if (entry != NULL && entry->n_samples == bh->number_of_samples) {
+			memcpy((void *) cps->decompressed_ptr, (void *) entry->samples, (size_t) entry->n_samples * sizeof(si4));
+			if (entry != shard->lru_head) {  // move to front
+				entry->lru_prev->lru_next = entry->lru_next;
+				if (entry->lru_next)
+					entry->lru_next->lru_prev = entry->lru_prev;
+				else
+					shard->lru_tail = entry->lru_prev;
+				entry->lru_prev = NULL;
+				entry->lru_next = shard->lru_head;
+				shard->lru_head->lru_prev = entry;
+				shard->lru_head = entry;
+			}
+			hit = TRUE_m13;
+		}
+		pthread_mutex_unlock_m13(&shard->mutex);
+	}
+	if (hit == FALSE_m13) {
+		if (CMP_shm_cache_fetch_m13(file_UID, block_number, cps->decompressed_ptr, bh->number_of_samples) == FALSE_m13)
+			return_m13(FALSE_m13);
+		CMP_block_cache_insert_m13(file_UID, block_number, cps->decompressed_ptr, bh->number_of_samples);
+	}
+	
+	// block state, as CMP_decode_block_m13() leaves it
+	if (bh->block_flags & CMP_BF_DISCONTINUITY_m13)
+		cps->params.discontinuity = TRUE_m13;
+	else
+		cps->params.discontinuity = FALSE_m13;
+	cps->params.block_end_index = 0xFFFFFFFF;
+	if (cps->params.block_start_index) {
+		cps->decompressed_data = cps->params.cache + cps->params.block_start_index;
+		cps->params.block_start_index = 0;
+	}
+
+	return_m13(TRUE_m13);
+}
+
+
+static ui8	CMP_block_cache_hash_m13(ui8 file_UID, si8 block_number)
+{
+	ui8	h;
+	
+	// block cache key hash (splitmix64 finalizer), shared by the process & shared memory caches
+	// no FT frame: called per block, & with cache locks held
+	h = file_UID ^ ((ui8) block_number * (ui8) 0x9E3779B97F4A7C15);
+	h = (h ^ (h >> 30)) * (ui8) 0xBF58476D1CE4E5B9;
+	h = (h ^ (h >> 27)) * (ui8) 0x94D049BB133111EB;
+	
+	return(h ^ (h >> 31));
+}
+
+
+static tern	CMP_block_cache_insert_m13(ui8 file_UID, si8 block_number, si4 *samples, ui4 n_samples)
+{
+	si4				i, bucket;
+	si8				entry_bytes, shard_budget;
+	CMP_BLOCK_CACHE_m13		*cache;
+	CMP_BLOCK_CACHE_SHARD_m13	*shard;
+	CMP_BLOCK_CACHE_ENTRY_m13	*entry, *new_entry;
+	
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// inserts a fully decoded block into the process cache (samples before native units conversion), evicting
+	// least recently used entries to stay within the shard's share of the budget; an existing entry for the key is kept
+	
+	shard_budget = globals_m13->miscellaneous.block_cache_bytes / CMP_BLOCK_CACHE_SHARDS_m13;
+	if (shard_budget <= 0 || file_UID == UID_NO_ENTRY_m13 || n_samples == 0)
+		return_m13(FALSE_m13);
+	entry_bytes = (si8) sizeof(CMP_BLOCK_CACHE_ENTRY_m13) + ((si8) n_samples * (si8) sizeof(si4));
+	if (entry_bytes > shard_budget)
+		return_m13(FALSE_m13);
+
+	// lazy-create the cache (guarded by the globals mutex; the atomic store publishes it only after its shard mutexes are initialized)
+	if (globals_m13->CMP_block_cache == NULL) {
+		pthread_mutex_lock_m13(&globals_m13->mutex);
+		if (globals_m13->CMP_block_cache == NULL) {
+			cache = (CMP_BLOCK_CACHE_m13 *) calloc_m13((size_t) 1, sizeof(CMP_BLOCK_CACHE_m13));
+			if (cache == NULL) {
+				pthread_mutex_unlock_m13(&globals_m13->mutex);
+				return_m13(FALSE_m13);
+			}
+			for (i = 0; i < CMP_BLOCK_CACHE_SHARDS_m13; ++i)
+				pthread_mutex_init_m13(&cache->shards[i].mutex, NULL);
+			globals_m13->CMP_block_cache = cache;
+		}
+		pthread_mutex_unlock_m13(&globals_m13->mutex);
+	}
+	
+	// build the entry outside the lock
+	new_entry = (CMP_BLOCK_CACHE_ENTRY_m13 *) malloc_m13((size_t) entry_bytes);
+	if (new_entry == NULL)
+		return_m13(FALSE_m13);
+	new_entry->file_UID = file_UID;
+	new_entry->block_number = block_number;
+	new_entry->bytes = entry_bytes;
+	new_entry->n_samples = n_samples;
+	new_entry->samples = (si4 *) (new_entry + 1);
+	memcpy((void *) new_entry->samples, (void *) samples, (size_t) n_samples * sizeof(si4));
+	
+	shard = CMP_block_cache_shard_m13(file_UID, block_number, &bucket);
+	pthread_mutex_lock_m13(&shard->mutex);
+	for (entry = shard->buckets[bucket]; entry; entry = entry->hash_next)
+		if (entry->file_UID == file_UID && entry->block_number == block_number)
+			break;
+	if (entry) {  // another thread decoded the same block
+		pthread_mutex_unlock_m13(&shard->mutex);
+		free_m13((void *) new_entry);
+		return_m13(TRUE_m13);
+	}
+	CMP_block_cache_evict_m13(shard, shard_budget - entry_bytes);
+	new_entry->hash_next = shard->buckets[bucket];
+	shard->buckets[bucket] = new_entry;
+	new_entry->lru_prev = NULL;
+	new_entry->lru_next = shard->lru_head;
+	if (shard->lru_head)
+		shard->lru_head->lru_prev = new_entry;
+	else
+		shard->lru_tail = new_entry;
+	shard->lru_head = new_entry;
+	shard->bytes += entry_bytes;
+	pthread_mutex_unlock_m13(&shard->mutex);
+
+	return_m13(TRUE_m13);
+}
+
+
+static CMP_BLOCK_CACHE_SHARD_m13	*CMP_block_cache_shard_m13(ui8 file_UID, si8 block_number, si4 *bucket)
+{
+	ui8	h;
+	
+	// high hash bits pick the shard, low bits the bucket
+	// no FT frame: called per block, & with shard locks held
+	h = CMP_block_cache_hash_m13(file_UID, block_number);
+	*bucket = (si4) (h & (CMP_BLOCK_CACHE_BUCKETS_m13 - 1));
+	
+	return(globals_m13->CMP_block_cache->shards + ((h >> 32) & (CMP_BLOCK_CACHE_SHARDS_m13 - 1)));
+}
+
+
+tern	CMP_block_cache_store_m13(ui8 file_UID, si8 block_number, si4 *samples, ui4 n_samples)
+{
+	tern	stored;
+	
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// inserts a fully decoded block (samples before native units conversion) into the process cache & the shared
+	// memory cache behind it; returns TRUE_m13 if either took it
+	
+	stored = CMP_block_cache_insert_m13(file_UID, block_number, samples, n_samples);
+	if (CMP_shm_cache_store_m13(file_UID, block_number, samples, n_samples) == TRUE_m13)
+		stored = TRUE_m13;
+
+	return_m13(stored);
+}
+
+
 tern	CMP_byte_to_hex_m13(ui1 byte, si1 *hex)
 {
 	ui1	hi_val, lo_val;
@@ -23182,11 +26733,6 @@ si4 CMP_compare_si8_m13(const void *a, const void * b)
 
 tern	CMP_decode_m13(FPS_m13 *fps)
 {
-	ui4			offset;
-	si4			*si4_p;
-	sf4			*sf4_p;
-	sf8			intercept, gradient, amplitude_scale, frequency_scale;
-	tern			(*decompression_f)(CPS_m13 *cps);
 	CMP_FIXED_BH_m13	*bh;
 	CPS_m13			*cps;
 
@@ -23204,9 +26750,30 @@ tern	CMP_decode_m13(FPS_m13 *fps)
 	if (cps->params.allocated_block_samples < bh->number_of_samples) {
 		if (CMP_realloc_CPS_m13(fps, CMP_DECOMPRESSION_MODE_m13, (si8) bh->number_of_samples, bh->number_of_samples) == NULL)
 			return_m13(FALSE_m13);
-		bh = cps->block_header;
 	}
 	
+	return_m13(CMP_decode_block_m13(cps));
+}
+
+
+tern	CMP_decode_block_m13(CPS_m13 *cps)
+{
+	ui4			offset;
+	si4			*si4_p;
+	sf4			*sf4_p;
+	sf8			intercept, gradient, amplitude_scale, frequency_scale;
+	tern			(*decompression_f)(CPS_m13 *cps);
+	CMP_FIXED_BH_m13	*bh;
+
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// decodes the block at cps->block_header to cps->decompressed_ptr
+	// no FPS => no reallocation: caller guarantees cps scratch fits the block (CMP_decode_m13() does this for an FPS owned CPS)
+	
+	bh = cps->block_header;
+	
 	// discontinuity
 	if (bh->block_flags & CMP_BF_DISCONTINUITY_m13)
 		cps->params.discontinuity = TRUE_m13;
@@ -23297,6 +26864,222 @@ tern	CMP_decode_m13(FPS_m13 *fps)
 }
 
 
+pthread_rval_m13	CMP_decode_run_thread_m13(void *ptr)
+{
+	ui4				cached_block_samples, block_samples;
+	si8				i, j, k, n;
+	ui8				**cumulative_count, **minimum_range;
+	PROC_JOB_m13			*job;
+	CMP_DECODE_RUN_m13		*run;
+	CMP_CACHE_BLOCK_INFO_m13	*cached_block;
+	CMP_FIXED_BH_m13		*bh;
+	CPS_m13				*cps;
+
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// form required by PROC_jobs_distribute_m13()
+	// sets PROC_THREAD_RUNNING_m13, PROC_THREAD_SUCCEEDED_m13 or PROC_THREAD_FAILED_m13
+	// decodes a run of blocks exactly as the serial loop in G_read_time_series_data_m13(), but with the run's own CPS
+
+	job = (PROC_JOB_m13 *) ptr;
+	job->status = PROC_THREAD_RUNNING_m13;
+
+	run = (CMP_DECODE_RUN_m13 *) job->function_arg;
+	cps = &run->cps;
+	cumulative_count = (ui8 **) cps->params.cumulative_count;
+	minimum_range = (ui8 **) cps->params.minimum_range;
+	for (i = run->start_idx, j = run->start_block_number, n = run->n_blocks; n--; ++i, ++j) {
+		if (run->skip_cached == TRUE_m13) {
+			cached_block = run->cached_blocks + i;
+			if ((cached_block_samples = cached_block->block_samples)) {
+				cps->decompressed_ptr += cached_block_samples;
+				if (cached_block->data_read == TRUE_m13)  // data read because in middle, but block is still cached
+					cps->block_header = (CMP_FIXED_BH_m13 *) ((ui1 *) cps->block_header + cps->block_header->total_block_bytes);
+				cached_block->cache_offset = run->cache_offset;
+				run->cache_offset += cached_block_samples;
+				continue;
+			}
+		}
+		bh = cps->block_header;
+		if (bh->number_of_samples > cps->params.allocated_block_samples) {  // sized from these headers in CMP_decode_runs_m13() => corrupt
+			G_set_error_m13(E_CMP_m13, "block %ld samples exceed run scratch", j);
+			job->status = PROC_THREAD_FAILED_m13;
+			return_m13(PROC_JOB_STATUS_SET_m13);
+		}
+
+		// RED decoders use these as flat arrays => restore the PRED row pointers
+		for (k = 0; k < CMP_PRED_CATS_m13; ++k) {
+			cumulative_count[k] = (ui8 *) (cumulative_count + CMP_PRED_CATS_m13) + (k * (CMP_RED_MAX_STATS_BINS_m13 + 1));
+			minimum_range[k] = (ui8 *) (minimum_range + CMP_PRED_CATS_m13) + (k * CMP_RED_MAX_STATS_BINS_m13);
+		}
+		
+		// set limit on last block
+		if (n == 0)
+			cps->params.block_end_index = run->block_end_index;
+		if (CMP_block_cache_fetch_m13(cps, run->file_UID, j) == FALSE_m13) {
+			block_samples = bh->number_of_samples;
+			if (CMP_decode_block_m13(cps) == FALSE_m13) {
+				job->status = PROC_THREAD_FAILED_m13;
+				return_m13(PROC_JOB_STATUS_SET_m13);
+			}
+			if (run->file_UID != UID_NO_ENTRY_m13 && bh->number_of_samples == block_samples)  // whole block decoded (VDS may trim the slice end)
+				CMP_block_cache_store_m13(run->file_UID, j, cps->decompressed_ptr, block_samples);
+		}
+
+		if (run->cached_blocks) {
+			cached_block = run->cached_blocks + i;
+			cached_block->cache_offset = run->cache_offset;
+			cached_block->block_samples = bh->number_of_samples;
+			run->cache_offset += cached_block->block_samples;
+			cached_block->block_number = (si4) j;
+		}
+		if (run->scale == TRUE_m13)  // scale to native units
+			CMP_si4_to_type_m13(cps->decompressed_ptr, cps->decompressed_ptr, (si8) bh->number_of_samples, CMP_SI4_TYPE_m13, run->scale_factor);
+		cps->block_header = (CMP_FIXED_BH_m13 *) ((ui1 *) bh + bh->total_block_bytes);
+		cps->decompressed_ptr += bh->number_of_samples;
+	}
+
+	job->status = PROC_THREAD_SUCCEEDED_m13;
+	
+	return_m13(PROC_JOB_STATUS_SET_m13);
+}
+
+
+tern	CMP_decode_runs_m13(FPS_m13 *fps, CMP_DECODE_RUN_m13 *range, si4 n_runs)
+{
+	tern				r_val;
+	ui4				cached_block_samples, max_block_samples;
+	si4				i;
+	si8				j, k, run_blocks, extra_blocks, keysample_bytes, scratch_bytes;
+	si4				*decompressed_ptr;
+	CMP_FIXED_BH_m13		*bh;
+	CMP_DECODE_RUN_m13		*runs, *run;
+	PROC_JOB_m13			*jobs;
+	CPS_m13				*cps;
+	
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// decodes the blocks described by range (its cps member is not used) in n_runs concurrent runs, starting at the
+	// current FPS CPS block header & decompressed pointers. Every block is self-contained, & its output offset is fixed
+	// by the sample counts of the blocks before it, so each run decodes straight into decompressed_data with its own
+	// scratch. The FPS CPS is left as the serial loop in G_read_time_series_data_m13() would leave it.
+	// range->block_end_index applies to the last block of the range; block_start_index must already be consumed.
+	
+	cps = fps->params.cps;
+	if (n_runs > range->n_blocks)
+		n_runs = (si4) range->n_blocks;
+	runs = (CMP_DECODE_RUN_m13 *) calloc_m13((size_t) n_runs, sizeof(CMP_DECODE_RUN_m13));
+	jobs = (PROC_JOB_m13 *) calloc_m13((size_t) n_runs, sizeof(PROC_JOB_m13));
+	if (runs == NULL || jobs == NULL) {  // error set by calloc_m13()
+		if (runs)
+			free_m13((void *) runs);
+		if (jobs)
+			free_m13((void *) jobs);
+		return_m13(FALSE_m13);
+	}
+
+	// walk block headers: set run starts & find largest block
+	run_blocks = range->n_blocks / n_runs;
+	extra_blocks = range->n_blocks % n_runs;
+	bh = cps->block_header;
+	decompressed_ptr = cps->decompressed_ptr;
+	max_block_samples = 0;
+	for (i = 0, j = range->start_idx; i < n_runs; ++i) {
+		run = runs + i;
+		*run = *range;
+		run->start_idx = j;
+		run->start_block_number = range->start_block_number + (si4) (j - range->start_idx);
+		run->n_blocks = (i < extra_blocks) ? run_blocks + 1 : run_blocks;
+		run->block_end_index = (i == n_runs - 1) ? range->block_end_index : 0xFFFFFFFF;
+		run->cps.block_header = bh;
+		run->cps.decompressed_ptr = decompressed_ptr;
+		for (k = run->n_blocks; k--; ++j) {
+			if (range->skip_cached == TRUE_m13) {
+				if ((cached_block_samples = range->cached_blocks[j].block_samples)) {
+					decompressed_ptr += cached_block_samples;
+					range->cache_offset += cached_block_samples;
+					if (range->cached_blocks[j].data_read == TRUE_m13)
+						bh = (CMP_FIXED_BH_m13 *) ((ui1 *) bh + bh->total_block_bytes);
+					continue;
+				}
+			}
+			if (bh->number_of_samples > max_block_samples)
+				max_block_samples = bh->number_of_samples;
+			decompressed_ptr += bh->number_of_samples;
+			range->cache_offset += bh->number_of_samples;
+			bh = (CMP_FIXED_BH_m13 *) ((ui1 *) bh + bh->total_block_bytes);
+		}
+	}
+	
+	// scratch size: largest of block buffers & PRED statistics arrays (row pointers + rows)
+	keysample_bytes = CMP_MAX_KEYSAMPLE_BYTES_m13((si8) max_block_samples);
+	if (keysample_bytes < cps->params.allocated_keysample_bytes)
+		keysample_bytes = cps->params.allocated_keysample_bytes;
+	scratch_bytes = (si8) max_block_samples * (si8) sizeof(si4);
+	if (scratch_bytes < keysample_bytes)
+		scratch_bytes = keysample_bytes;
+	if (scratch_bytes < (si8) (CMP_PRED_CATS_m13 * (sizeof(ui8 *) + ((CMP_RED_MAX_STATS_BINS_m13 + 1) * sizeof(ui8)))))
+		scratch_bytes = (si8) (CMP_PRED_CATS_m13 * (sizeof(ui8 *) + ((CMP_RED_MAX_STATS_BINS_m13 + 1) * sizeof(ui8))));
+
+	// set up run CPSs & jobs
+	r_val = TRUE_m13;
+	for (i = 0; i < n_runs; ++i) {
+		run = runs + i;
+		bh = run->cps.block_header;
+		decompressed_ptr = run->cps.decompressed_ptr;
+		run->cps = *cps;  // directives, parameters & shared arrays
+		run->cps.block_header = bh;
+		run->cps.decompressed_data = run->cps.decompressed_ptr = decompressed_ptr;
+		run->scratch = CMP_checkout_buffers_m13(CMP_DECODE_RUN_BUFFERS_m13, scratch_bytes, 1);
+		if (run->scratch == NULL) {  // error set by CMP_checkout_buffers_m13()
+			r_val = FALSE_m13;
+			break;
+		}
+		run->cps.params.keysample_buffer = (si1 *) run->scratch->buffer[CMP_DECODE_RUN_KEYSAMPLE_BUF_m13];
+		run->cps.params.allocated_keysample_bytes = keysample_bytes;
+		run->cps.params.residuals_buffer = (si4 *) run->scratch->buffer[CMP_DECODE_RUN_RESIDUALS_BUF_m13];
+		run->cps.params.PRED_base_cumulative_count = run->cps.params.cumulative_count = run->scratch->buffer[CMP_DECODE_RUN_CUMULATIVE_BUF_m13];
+		run->cps.params.PRED_base_minimum_range = run->cps.params.minimum_range = run->scratch->buffer[CMP_DECODE_RUN_MINIMUM_RANGE_BUF_m13];
+		run->cps.params.allocated_block_samples = (si8) max_block_samples;
+		run->cps.params.VDS_input_buffers = run->cps.params.VDS_output_buffers = NULL;  // borrowed per block from the depot
+		run->cps.params.scrap_buffers = NULL;
+		run->cps.params.block_start_index = 0;
+		run->cps.params.block_end_index = 0xFFFFFFFF;
+		jobs[i].name = "CMP_decode_run_thread_m13";
+		jobs[i].function = CMP_decode_run_thread_m13;
+		jobs[i].function_arg = (void *) run;
+		jobs[i].priority = PROC_HIGH_PRIORITY_m13;
+		jobs[i].skip = FALSE_m13;
+	}
+
+	// decode is cpu bound => one job per core (& leave the session-adaptive tuning to the I/O mixed jobs)
+	if (r_val == TRUE_m13)
+		r_val = PROC_jobs_distribute_m13(jobs, n_runs, 0, 1, TRUE_m13, TRUE_m13);
+
+	// leave FPS CPS as the serial loop would (last block's pointers & block state)
+	if (r_val == TRUE_m13) {
+		run = runs + (n_runs - 1);
+		cps->block_header = run->cps.block_header;
+		cps->decompressed_ptr = run->cps.decompressed_ptr;
+		cps->params.discontinuity = run->cps.params.discontinuity;
+		cps->params.derivative_level = run->cps.params.derivative_level;
+		cps->direcs.flags = (cps->direcs.flags & ~CPS_DF_ALGORITHM_MASK_m13) | (run->cps.direcs.flags & CPS_DF_ALGORITHM_MASK_m13);
+	}
+	
+	for (i = 0; i < n_runs; ++i)
+		if (runs[i].scratch)
+			CMP_return_buffers_m13(runs[i].scratch);
+	free_m13((void *) runs);
+	free_m13((void *) jobs);
+
+	return_m13(r_val);
+}
+
+
 tern	CMP_decrypt_m13(FPS_m13 *fps)
 {
 	si1			enc_level;
@@ -23654,6 +27437,7 @@ tern	CMP_encode_m13(FPS_m13 *fps, si8 start_time, si4 acquisition_channel_number
 	tern			(*compression_f)(CPS_m13 *cps);
 	CPS_m13			*cps;
 	CMP_FIXED_BH_m13	*bh;
+	ZMAP_BLOCK_m13		*zm_blk;
 	
 #ifdef FT_DEBUG_m13
 	G_push_function_m13();
@@ -23694,6 +27478,15 @@ tern	CMP_encode_m13(FPS_m13 *fps, si8 start_time, si4 acquisition_channel_number
 	// set up variable region
 	CMP_set_variable_region_m13(cps);
 	
+	// zone map (statistics of the samples as passed, before any detrending or lossy step)
+	if (cps->direcs.flags & CPS_DF_ZONE_MAP_m13) {
+		zm_blk = G_zone_map_add_block_m13(&cps->zone_map);
+		G_zone_map_block_stats_m13(cps->input_buffer, (si8) n_samples, zm_blk);
+		zm_blk->start_time = start_time;
+		if (cps->params.discontinuity == TRUE_m13)
+			zm_blk->flags |= ZMAP_BF_DISCONTINUITY_m13;
+	}
+
 	// discontinuity
 	if (cps->params.discontinuity == TRUE_m13) {
 		bh->block_flags |= CMP_BF_DISCONTINUITY_m13;
@@ -24184,6 +27977,26 @@ tern	CMP_find_frequency_scale_m13(CPS_m13 *cps, tern (*compression_f)(CPS_m13 *c
 }
 
 
+void	CMP_free_block_cache_m13(void)
+{
+	si4				i;
+	CMP_BLOCK_CACHE_m13		*cache;
+	CMP_BLOCK_CACHE_SHARD_m13	*shard;
+	
+	// teardown: free every cached block & the cache itself (no FT frame - called from G_free_globals_m13())
+	cache = globals_m13->CMP_block_cache;
+	if (cache == NULL)
+		return;
+	for (i = 0; i < CMP_BLOCK_CACHE_SHARDS_m13; ++i) {
+		shard = cache->shards + i;
+		CMP_block_cache_evict_m13(shard, 0);
+		pthread_mutex_destroy_m13(&shard->mutex);
+	}
+	free_m13(cache);
+	globals_m13->CMP_block_cache = NULL;
+}
+
+
 void	CMP_free_buffer_depot_m13(void)
 {
 	si8			i;
@@ -24335,6 +28148,11 @@ tern	CMP_free_CPS_m13(CPS_m13 *cps, tern free_structure)
 	if (cps->params.VDS_output_buffers)
 		CMP_free_buffers_m13(&cps->params.VDS_output_buffers);
 	
+	if (cps->zone_map) {
+		G_free_zone_map_m13(cps->zone_map);
+		cps->zone_map = NULL;
+	}
+	
 	if (free_structure == TRUE_m13)
 		free_m13(cps);
 	
@@ -24342,6 +28160,24 @@ tern	CMP_free_CPS_m13(CPS_m13 *cps, tern free_structure)
 }
 
 
+void	CMP_free_shm_cache_m13(void)
+{
+	CMP_SHM_CACHE_m13	*cache;
+	
+	// teardown: detach from the shared block cache; the segment itself persists for other processes
+	// (no FT frame - called from G_free_globals_m13())
+	cache = globals_m13->CMP_shm_cache;
+	if (cache == NULL)
+		return;
+#ifdef LINUX_m13
+	if (cache->attached == TRUE_m13)
+		munmap((void *) cache->hdr, (size_t) cache->hdr->segment_bytes);
+#endif
+	free_m13(cache);
+	globals_m13->CMP_shm_cache = NULL;
+}
+
+
 sf8	CMP_gamma_cdf_m13(sf8 x, sf8 k, sf8 theta, sf8 offset)
 {
 	sf8  p;
@@ -25057,6 +28893,7 @@ CPS_PARAMS_m13	*CMP_init_params_m13(CPS_PARAMS_m13 *params)
 	params->cached_blocks = NULL;
 	params->cached_block_cnt = 0;
 	params->cached_block_list_len = 0;
+	params->decode_deferred = FALSE_m13;
 	params->block_start_index = 0;
 	params->block_end_index = 0xFFFFFFFF;
 	params->allocated_block_samples = 0;
@@ -29152,6 +32989,284 @@ tern	CMP_sf8_to_si4_m13(sf8 *sf8_arr, si4 *si4_arr, si8 len, tern round)
 }
 
 
+static CMP_SHM_CACHE_m13	*CMP_shm_cache_attach_m13(void)
+{
+	CMP_SHM_CACHE_m13	*cache;
+#ifdef LINUX_m13
+	si1			name[CMP_SHM_CACHE_NAME_BYTES_m13];
+	si4			fd, i, j;
+	tern			created;
+	ui4			n_sets, slot_samples;
+	si8			segment_bytes, set_bytes;
+	ui1			*seg;
+	struct stat		sb;
+	pthread_mutexattr_t	attr;
+	CMP_SHM_CACHE_HDR_m13	*hdr;
+	CMP_SHM_CACHE_SET_m13	*set;
+#endif
+	
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// returns the attached shared memory cache, or NULL (cache off, unsupported, or attach failed - not retried)
+	// the first process to attach creates & sizes the segment; later processes take its geometry from the header
+
+	cache = globals_m13->CMP_shm_cache;
+	if (cache)
+		return_m13((cache->attached == TRUE_m13) ? cache : NULL);
+	
+#ifdef LINUX_m13
+	if (globals_m13->miscellaneous.shared_block_cache_bytes <= 0)
+		return_m13(NULL);
+
+	pthread_mutex_lock_m13(&globals_m13->mutex);
+	if (globals_m13->CMP_shm_cache) {  // another thread attached first
+		cache = globals_m13->CMP_shm_cache;
+		pthread_mutex_unlock_m13(&globals_m13->mutex);
+		return_m13((cache->attached == TRUE_m13) ? cache : NULL);
+	}
+	cache = (CMP_SHM_CACHE_m13 *) calloc_m13((size_t) 1, sizeof(CMP_SHM_CACHE_m13));
+	cache->attached = FALSE_m13;
+	hdr = NULL;
+	
+	// geometry (used only if this process creates the segment)
+	slot_samples = CMP_SHM_CACHE_SLOT_SAMPLES_m13;
+	set_bytes = (si8) sizeof(CMP_SHM_CACHE_SET_m13) + ((si8) CMP_SHM_CACHE_WAYS_m13 * (si8) slot_samples * (si8) sizeof(si4));
+	n_sets = (ui4) (globals_m13->miscellaneous.shared_block_cache_bytes / set_bytes);
+	if (n_sets == 0)
+		n_sets = 1;
+	segment_bytes = (si8) sizeof(CMP_SHM_CACHE_HDR_m13) + ((si8) n_sets * set_bytes);
+
+	created = TRUE_m13;
+	CMP_shm_cache_name_m13(name);
+	fd = shm_open(name, O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);  // owner only: holds decrypted samples
+	if (fd == -1 && errno == EEXIST) {
+		created = FALSE_m13;
+		fd = shm_open(name, O_RDWR | O_NOFOLLOW, 0);
+	}
+	if (fd == -1)
+		goto CMP_SHM_ATTACH_DONE_m13;
+
+	if (created == TRUE_m13) {
+		if (ftruncate(fd, (off_t) segment_bytes) == -1) {
+			shm_unlink(name);
+			goto CMP_SHM_ATTACH_DONE_m13;
+		}
+		seg = (ui1 *) mmap(NULL, (size_t) segment_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+		if (seg == (ui1 *) MAP_FAILED) {
+			shm_unlink(name);
+			goto CMP_SHM_ATTACH_DONE_m13;
+		}
+		hdr = (CMP_SHM_CACHE_HDR_m13 *) seg;
+		hdr->n_sets = n_sets;
+		hdr->slot_samples = slot_samples;
+		hdr->segment_bytes = segment_bytes;
+		set = (CMP_SHM_CACHE_SET_m13 *) (seg + sizeof(CMP_SHM_CACHE_HDR_m13));
+		pthread_mutexattr_init(&attr);
+		pthread_mutexattr_setpshared(&attr, PTHREAD_PROCESS_SHARED);
+		pthread_mutexattr_setrobust(&attr, PTHREAD_MUTEX_ROBUST);
+		for (i = 0; i < (si4) n_sets; ++i, ++set) {  // ftruncate() zeroed the segment: slots are empty
+			pthread_mutex_init(&set->mutex, &attr);
+			set->clock_hand = 0;
+			for (j = 0; j < CMP_SHM_CACHE_WAYS_m13; ++j)
+				set->slots[j].file_UID = UID_NO_ENTRY_m13;
+		}
+		pthread_mutexattr_destroy(&attr);
+		atomic_store(&hdr->magic, CMP_SHM_CACHE_MAGIC_m13);  // publish (release): everything above is visible before this
+	} else {
+		// a concurrent creator may not have sized or initialized the segment yet
+		for (i = 0; i < CMP_SHM_CACHE_ATTACH_TRIES_m13; ++i) {
+			if (fstat(fd, &sb) == 0 && sb.st_size >= (off_t) sizeof(CMP_SHM_CACHE_HDR_m13))
+				break;
+			nap_m13(CMP_SHM_CACHE_ATTACH_NAP_m13);
+		}
+		if (i == CMP_SHM_CACHE_ATTACH_TRIES_m13)
+			goto CMP_SHM_ATTACH_DONE_m13;
+		if (sb.st_uid != geteuid() || (sb.st_mode & 077))  // not ours, or readable/writable by others: never trust its contents
+			goto CMP_SHM_ATTACH_DONE_m13;
+		seg = (ui1 *) mmap(NULL, (size_t) sb.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+		if (seg == (ui1 *) MAP_FAILED)
+			goto CMP_SHM_ATTACH_DONE_m13;
+		hdr = (CMP_SHM_CACHE_HDR_m13 *) seg;
+		for (i = 0; i < CMP_SHM_CACHE_ATTACH_TRIES_m13; ++i) {
+			if (atomic_load(&hdr->magic) == CMP_SHM_CACHE_MAGIC_m13)
+				break;
+			nap_m13(CMP_SHM_CACHE_ATTACH_NAP_m13);
+		}
+		// the geometry must be this layout's & account for the whole segment exactly: fetch & store index with it
+		n_sets = hdr->n_sets;
+		slot_samples = hdr->slot_samples;
+		segment_bytes = (si8) sizeof(CMP_SHM_CACHE_HDR_m13) + ((si8) n_sets * set_bytes);
+		if (i == CMP_SHM_CACHE_ATTACH_TRIES_m13 || n_sets == 0 || slot_samples != CMP_SHM_CACHE_SLOT_SAMPLES_m13 || hdr->segment_bytes != segment_bytes || (si8) sb.st_size != segment_bytes) {  // not initialized, other layout, or corrupt
+			munmap((void *) seg, (size_t) sb.st_size);
+			hdr = NULL;
+			goto CMP_SHM_ATTACH_DONE_m13;
+		}
+	}
+	cache->hdr = hdr;
+	cache->sets = (CMP_SHM_CACHE_SET_m13 *) ((ui1 *) hdr + sizeof(CMP_SHM_CACHE_HDR_m13));
+	cache->arena = (si4 *) (cache->sets + n_sets);
+	cache->attached = TRUE_m13;
+
+CMP_SHM_ATTACH_DONE_m13:
+	if (fd != -1)
+		close(fd);  // mapping persists
+	globals_m13->CMP_shm_cache = cache;
+	pthread_mutex_unlock_m13(&globals_m13->mutex);
+	
+	return_m13((cache->attached == TRUE_m13) ? cache : NULL);
+#else
+	return_m13(NULL);  // shared block cache is Linux only
+#endif
+}
+
+
+tern	CMP_shm_cache_fetch_m13(ui8 file_UID, si8 block_number, si4 *samples, ui4 n_samples)
+{
+	ui4			i;
+	tern			hit;
+	CMP_SHM_CACHE_m13	*cache;
+	CMP_SHM_CACHE_SET_m13	*set;
+	CMP_SHM_CACHE_SLOT_m13	*slot;
+	
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// on a hit copies the block's decoded samples to "samples"; the entry must hold exactly n_samples
+	
+	if (globals_m13->miscellaneous.shared_block_cache_bytes <= 0 || file_UID == UID_NO_ENTRY_m13)
+		return_m13(FALSE_m13);
+	if ((cache = CMP_shm_cache_attach_m13()) == NULL)
+		return_m13(FALSE_m13);
+	
+	set = cache->sets + (CMP_block_cache_hash_m13(file_UID, block_number) % cache->hdr->n_sets);
+	if (CMP_shm_cache_lock_m13(set) == FALSE_m13)
+		return_m13(FALSE_m13);
+	hit = FALSE_m13;
+	for (i = 0, slot = set->slots; i < CMP_SHM_CACHE_WAYS_m13; ++i, ++slot) {
+		if (slot->file_UID == file_UID && slot->block_number == block_number) {
+			if (slot->n_samples == n_samples) {  // copy out under the lock: the slot can't be reused mid-copy
+				memcpy((void *) samples, (void *) (cache->arena + (((si8) (set - cache->sets) * CMP_SHM_CACHE_WAYS_m13 + i) * (si8) cache->hdr->slot_samples)), (size_t) n_samples * sizeof(si4));
+				slot->referenced = 1;
+				hit = TRUE_m13;
+			}
+			break;
+		}
+	}
+	pthread_mutex_unlock(&set->mutex);
+
+	return_m13(hit);
+}
+
+
+static tern	CMP_shm_cache_lock_m13(CMP_SHM_CACHE_SET_m13 *set)
+{
+#ifdef LINUX_m13
+	si4	i, ret;
+	
+	// no FT frame: called per block
+	ret = pthread_mutex_lock(&set->mutex);
+	if (ret == EOWNERDEAD) {  // holder died: the set may be half written - empty it
+		for (i = 0; i < CMP_SHM_CACHE_WAYS_m13; ++i) {
+			set->slots[i].file_UID = UID_NO_ENTRY_m13;
+			set->slots[i].referenced = 0;
+		}
+		set->clock_hand = 0;
+		pthread_mutex_consistent(&set->mutex);
+		ret = 0;
+	}
+	
+	return((ret == 0) ? TRUE_m13 : FALSE_m13);
+#else
+	return(FALSE_m13);
+#endif
+}
+
+
+static void	CMP_shm_cache_name_m13(si1 *name)
+{
+	// segment name for this user: processes of other users neither share nor can substitute the segment
+	snprintf_m13(name, CMP_SHM_CACHE_NAME_BYTES_m13, CMP_SHM_CACHE_NAME_m13, (ui4) geteuid());
+	
+	return;
+}
+
+
+tern	CMP_shm_cache_store_m13(ui8 file_UID, si8 block_number, si4 *samples, ui4 n_samples)
+{
+	ui4			i, victim;
+	CMP_SHM_CACHE_m13	*cache;
+	CMP_SHM_CACHE_SET_m13	*set;
+	CMP_SHM_CACHE_SLOT_m13	*slot;
+	
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// inserts a fully decoded block into its set: an existing entry for the key is kept, then an empty slot is taken,
+	// then CLOCK picks the victim (sweep clears referenced bits until it finds a clear one)
+	
+	if (globals_m13->miscellaneous.shared_block_cache_bytes <= 0 || file_UID == UID_NO_ENTRY_m13 || n_samples == 0)
+		return_m13(FALSE_m13);
+	if ((cache = CMP_shm_cache_attach_m13()) == NULL)
+		return_m13(FALSE_m13);
+	if (n_samples > cache->hdr->slot_samples)
+		return_m13(FALSE_m13);
+	
+	set = cache->sets + (CMP_block_cache_hash_m13(file_UID, block_number) % cache->hdr->n_sets);
+	if (CMP_shm_cache_lock_m13(set) == FALSE_m13)
+		return_m13(FALSE_m13);
+	victim = CMP_SHM_CACHE_WAYS_m13;
+	for (i = 0, slot = set->slots; i < CMP_SHM_CACHE_WAYS_m13; ++i, ++slot) {
+		if (slot->file_UID == file_UID && slot->block_number == block_number) {  // already cached
+			pthread_mutex_unlock(&set->mutex);
+			return_m13(TRUE_m13);
+		}
+		if (slot->file_UID == UID_NO_ENTRY_m13 && victim == CMP_SHM_CACHE_WAYS_m13)
+			victim = i;
+	}
+	if (victim == CMP_SHM_CACHE_WAYS_m13) {  // CLOCK sweep (terminates within two passes)
+		while (set->slots[set->clock_hand].referenced) {
+			set->slots[set->clock_hand].referenced = 0;
+			set->clock_hand = (set->clock_hand + 1) % CMP_SHM_CACHE_WAYS_m13;
+		}
+		victim = set->clock_hand;
+		set->clock_hand = (set->clock_hand + 1) % CMP_SHM_CACHE_WAYS_m13;
+	}
+	slot = set->slots + victim;
+	memcpy((void *) (cache->arena + (((si8) (set - cache->sets) * CMP_SHM_CACHE_WAYS_m13 + victim) * (si8) cache->hdr->slot_samples)), (void *) samples, (size_t) n_samples * sizeof(si4));
+	slot->file_UID = file_UID;
+	slot->block_number = block_number;
+	slot->n_samples = n_samples;
+	slot->referenced = 1;
+	pthread_mutex_unlock(&set->mutex);
+
+	return_m13(TRUE_m13);
+}
+
+
+tern	CMP_shm_cache_unlink_m13(void)
+{
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// removes the segment name: attached processes keep their mappings, the next attach creates a fresh segment
+	// (the segment otherwise outlives every process until reboot)
+	
+#ifdef LINUX_m13
+	si1	name[CMP_SHM_CACHE_NAME_BYTES_m13];
+	
+	CMP_shm_cache_name_m13(name);
+	if (shm_unlink(name) == 0)
+		return_m13(TRUE_m13);
+#endif
+	return_m13(FALSE_m13);
+}
+
+
 tern	CMP_show_block_header_m13(void *level_header, CMP_FIXED_BH_m13 *bh)
 {
 	si1	hex_str[HEX_STR_BYTES_m13(UID_BYTES_m13, 0)], time_str[TIME_STRING_BYTES_m13], bin_str[BIN_STR_BYTES_m13(sizeof(ui4), 3)];
@@ -29524,6 +33639,196 @@ tern	CMP_si4_to_sf8_m13(si4 *si4_arr, sf8 *sf8_arr, si8 len)
 }
 
 
+#ifdef HW_SIMD_m13
+#if defined __x86_64__ || defined __i386__
+
+HW_SIMD_FN_ATTR_m13
+static si8	CMP_si4_to_type_hw_m13(si4 *si4_arr, void *out_arr, si8 len, ui1 out_type, sf8 scale)
+{
+	si8	i, n_vec;
+	__m128i	x, lo_i, hi_i;
+	__m256d	v, scale_v, zero_v, pos_half_v, neg_half_v, lo_v, hi_v;
+	
+	// AVX2 body of CMP_si4_to_type_m13(): 4 samples per pass, returns samples converted (caller does the tail)
+	// rounds exactly as CMP_round_si2_m13() / CMP_round_si4_m13(): +-0.5 by sign, clamp to the +-inf codes, truncate
+	// no FT frame: called per block
+	
+	n_vec = len & ~((si8) 3);
+	if (out_type == CMP_SI2_TYPE_m13) {
+		lo_i = _mm_set1_epi32((si4) NEG_INF_SI2_m13);
+		hi_i = _mm_set1_epi32((si4) POS_INF_SI2_m13);
+		lo_v = _mm256_set1_pd((sf8) NEG_INF_SI2_m13);
+		hi_v = _mm256_set1_pd((sf8) POS_INF_SI2_m13);
+	} else {
+		lo_i = _mm_set1_epi32(NEG_INF_SI4_m13);
+		hi_i = _mm_set1_epi32(POS_INF_SI4_m13);
+		lo_v = _mm256_set1_pd((sf8) NEG_INF_SI4_m13);
+		hi_v = _mm256_set1_pd((sf8) POS_INF_SI4_m13);
+	}
+	scale_v = _mm256_set1_pd(scale);
+	zero_v = _mm256_setzero_pd();
+	pos_half_v = _mm256_set1_pd((sf8) 0.5);
+	neg_half_v = _mm256_set1_pd((sf8) -0.5);
+	
+	for (i = 0; i < n_vec; i += 4) {
+		x = _mm_loadu_si128((__m128i *) (si4_arr + i));
+		if (scale == (sf8) 1.0) {  // integers round to themselves => clamp only
+			if (out_type == CMP_SI2_TYPE_m13 || out_type == CMP_SI4_TYPE_m13)
+				x = _mm_min_epi32(_mm_max_epi32(x, lo_i), hi_i);
+		} else {
+			v = _mm256_mul_pd(_mm256_cvtepi32_pd(x), scale_v);
+			v = _mm256_add_pd(v, _mm256_blendv_pd(neg_half_v, pos_half_v, _mm256_cmp_pd(v, zero_v, _CMP_GE_OQ)));
+			x = _mm256_cvttpd_epi32(_mm256_min_pd(_mm256_max_pd(v, lo_v), hi_v));
+		}
+		switch (out_type) {
+			case CMP_SI2_TYPE_m13:
+				_mm_storel_epi64((__m128i *) ((si2 *) out_arr + i), _mm_packs_epi32(x, x));
+				break;
+			case CMP_SI4_TYPE_m13:
+				_mm_storeu_si128((__m128i *) ((si4 *) out_arr + i), x);
+				break;
+			case CMP_SF4_TYPE_m13:
+				_mm_storeu_ps((sf4 *) out_arr + i, _mm_cvtepi32_ps(x));
+				break;
+			case CMP_SF8_TYPE_m13:
+				_mm256_storeu_pd((sf8 *) out_arr + i, _mm256_cvtepi32_pd(x));
+				break;
+		}
+	}
+	
+	return(n_vec);
+}
+
+#endif  // __x86_64__ || __i386__
+#ifdef __aarch64__
+
+// UNVERIFIED (no ARM test machine)
+HW_SIMD_FN_ATTR_m13
+static si8	CMP_si4_to_type_hw_m13(si4 *si4_arr, void *out_arr, si8 len, ui1 out_type, sf8 scale)
+{
+	si8		i, n_vec;
+	int32x4_t	x, lo_i, hi_i;
+	float64x2_t	v0, v1, scale_v, zero_v, pos_half_v, neg_half_v, lo_v, hi_v;
+	
+	// NEON body of CMP_si4_to_type_m13(): 4 samples per pass, returns samples converted (caller does the tail)
+	// rounds exactly as CMP_round_si2_m13() / CMP_round_si4_m13(): +-0.5 by sign, clamp to the +-inf codes, truncate
+	// no FT frame: called per block
+	
+	n_vec = len & ~((si8) 3);
+	if (out_type == CMP_SI2_TYPE_m13) {
+		lo_i = vdupq_n_s32((si4) NEG_INF_SI2_m13);
+		hi_i = vdupq_n_s32((si4) POS_INF_SI2_m13);
+		lo_v = vdupq_n_f64((sf8) NEG_INF_SI2_m13);
+		hi_v = vdupq_n_f64((sf8) POS_INF_SI2_m13);
+	} else {
+		lo_i = vdupq_n_s32(NEG_INF_SI4_m13);
+		hi_i = vdupq_n_s32(POS_INF_SI4_m13);
+		lo_v = vdupq_n_f64((sf8) NEG_INF_SI4_m13);
+		hi_v = vdupq_n_f64((sf8) POS_INF_SI4_m13);
+	}
+	scale_v = vdupq_n_f64(scale);
+	zero_v = vdupq_n_f64((sf8) 0.0);
+	pos_half_v = vdupq_n_f64((sf8) 0.5);
+	neg_half_v = vdupq_n_f64((sf8) -0.5);
+	
+	for (i = 0; i < n_vec; i += 4) {
+		x = vld1q_s32(si4_arr + i);
+		if (scale == (sf8) 1.0) {  // integers round to themselves => clamp only
+			if (out_type == CMP_SI2_TYPE_m13 || out_type == CMP_SI4_TYPE_m13)
+				x = vminq_s32(vmaxq_s32(x, lo_i), hi_i);
+		} else {
+			v0 = vmulq_f64(vcvtq_f64_s64(vmovl_s32(vget_low_s32(x))), scale_v);
+			v1 = vmulq_f64(vcvtq_f64_s64(vmovl_s32(vget_high_s32(x))), scale_v);
+			v0 = vaddq_f64(v0, vbslq_f64(vcgeq_f64(v0, zero_v), pos_half_v, neg_half_v));
+			v1 = vaddq_f64(v1, vbslq_f64(vcgeq_f64(v1, zero_v), pos_half_v, neg_half_v));
+			v0 = vminq_f64(vmaxq_f64(v0, lo_v), hi_v);
+			v1 = vminq_f64(vmaxq_f64(v1, lo_v), hi_v);
+			x = vcombine_s32(vmovn_s64(vcvtq_s64_f64(v0)), vmovn_s64(vcvtq_s64_f64(v1)));  // vcvtq truncates
+		}
+		switch (out_type) {
+			case CMP_SI2_TYPE_m13:
+				vst1_s16((si2 *) out_arr + i, vmovn_s32(x));
+				break;
+			case CMP_SI4_TYPE_m13:
+				vst1q_s32((si4 *) out_arr + i, x);
+				break;
+			case CMP_SF4_TYPE_m13:
+				vst1q_f32((sf4 *) out_arr + i, vcvtq_f32_s32(x));
+				break;
+			case CMP_SF8_TYPE_m13:
+				vst1q_f64((sf8 *) out_arr + i, vcvtq_f64_s64(vmovl_s32(vget_low_s32(x))));
+				vst1q_f64((sf8 *) out_arr + i + 2, vcvtq_f64_s64(vmovl_s32(vget_high_s32(x))));
+				break;
+		}
+	}
+	
+	return(n_vec);
+}
+
+#endif  // __aarch64__
+#endif  // HW_SIMD_m13
+
+
+tern	CMP_si4_to_type_m13(si4 *si4_arr, void *out_arr, si8 len, ui1 out_type, sf8 scale)
+{
+	si2	*si2_p;
+	si4	*si4_p;
+	sf4	*sf4_p;
+	sf8	*sf8_p;
+	si8	done;
+	
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// converts si4_arr to out_type, scaling first if scale != 1.0, in one pass (si4_arr may be out_arr)
+	// matches the scalar pipeline it replaces: integer outputs are CMP_round_si2_m13() / CMP_round_si4_m13() of the (scaled) value;
+	// float outputs are casts of the value, which is CMP_round_si4_m13() of the scaled value when scaling (native units are si4)
+	
+	// an unusable scale (not finite, or the 0.0 "no entry" factor) converts unscaled, as the native units path does
+	if (isfinite(scale) == 0 || scale == (sf8) 0.0)
+		scale = (sf8) 1.0;
+	
+	done = 0;
+#ifdef HW_SIMD_m13
+	if (globals_m13->tables->HW_params.SIMD_accel == UNKNOWN_m13)  // lazy init (as AES_hw_ready_m13())
+		HW_get_crypto_accel_m13();
+	if (globals_m13->tables->HW_params.SIMD_accel == TRUE_m13)
+		done = CMP_si4_to_type_hw_m13(si4_arr, out_arr, len, out_type, scale);
+#endif
+	si4_arr += done;
+	len -= done;
+	
+	switch (out_type) {
+		case CMP_SI2_TYPE_m13:
+			si2_p = (si2 *) out_arr + done;
+			while (len--)
+				*si2_p++ = CMP_round_si2_m13((scale == (sf8) 1.0) ? (sf8) *si4_arr++ : (sf8) *si4_arr++ * scale);
+			break;
+		case CMP_SI4_TYPE_m13:
+			si4_p = (si4 *) out_arr + done;
+			while (len--)
+				*si4_p++ = CMP_round_si4_m13((scale == (sf8) 1.0) ? (sf8) *si4_arr++ : (sf8) *si4_arr++ * scale);
+			break;
+		case CMP_SF4_TYPE_m13:
+			sf4_p = (sf4 *) out_arr + done;
+			while (len--)
+				*sf4_p++ = (sf4) ((scale == (sf8) 1.0) ? *si4_arr++ : CMP_round_si4_m13((sf8) *si4_arr++ * scale));
+			break;
+		case CMP_SF8_TYPE_m13:
+			sf8_p = (sf8 *) out_arr + done;
+			while (len--)
+				*sf8_p++ = (sf8) ((scale == (sf8) 1.0) ? *si4_arr++ : CMP_round_si4_m13((sf8) *si4_arr++ * scale));
+			break;
+		default:
+			G_set_error_m13(E_GEN_m13, "invalid output type (%hhu)", out_type);
+			return_m13(FALSE_m13);
+	}
+
+	return_m13(TRUE_m13);
+}
+
+
 // Code adapted from Numerical Recipes in C. Public domain.
 sf8	*CMP_spline_interp_sf8_m13(sf8 *in_arr, si8 in_arr_len, sf8 *out_arr, si8 out_arr_len, CMP_BUFFERS_m13 *spline_bufs)
 {
@@ -32136,6 +36441,20 @@ crc4	CRC_calculate_m13(const ui1 *block_ptr, si8 block_bytes)
 }
 
 
+crc4	CRC_calculate_parallel_m13(const ui1 *block_ptr, si8 block_bytes)
+{
+	crc4	crc;
+	
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	crc = CRC_update_parallel_m13(block_ptr, block_bytes, CRC_START_VALUE_m13);
+
+	return_m13(crc);
+}
+
+
 crc4	CRC_combine_m13(crc4 block_1_crc, crc4 block_2_crc, si8 block_2_bytes)
 {
 	ui4	n, col;
@@ -32189,6 +36508,188 @@ crc4	CRC_combine_m13(crc4 block_1_crc, crc4 block_2_crc, si8 block_2_bytes)
 }
 
 
+#ifdef HW_CRYPTO_m13
+
+// CRC-32 (reflected 0xEDB88320) by carry-less multiply folding: Gopal et al., "Fast CRC Computation for Generic Polynomials Using
+// PCLMULQDQ Instruction" (Intel, 2009).  Four 128-bit lanes fold 64 bytes per step, collapse to one lane, fold any further 16 byte
+// blocks, then reduce 128 => 64 => 32 bits (Barrett).  Constants are x^n mod P in the bit-reflected domain (k1/k2: 512 bit fold,
+// k3/k4: 128 bit fold, k5: 64 bit fold; P' & mu: Barrett).  c & the result are the inverted CRC state, as in CRC_update_m13().
+// Caller guarantees len >= CRC_HW_MIN_BYTES_m13 & len a multiple of 16.
+static const ui8	CRC_fold_k1k2_m13[2] __attribute__((aligned(16))) = { (ui8) 0x0154442bd4, (ui8) 0x01c6e41596 };
+static const ui8	CRC_fold_k3k4_m13[2] __attribute__((aligned(16))) = { (ui8) 0x01751997d0, (ui8) 0x00ccaa009e };
+static const ui8	CRC_fold_k5k0_m13[2] __attribute__((aligned(16))) = { (ui8) 0x0163cd6124, (ui8) 0x0000000000 };
+static const ui8	CRC_fold_poly_m13[2] __attribute__((aligned(16))) = { (ui8) 0x01db710641, (ui8) 0x01f7011641 };  // P', mu
+
+#if defined __x86_64__ || defined __i386__
+HW_CLMUL_FN_ATTR_m13
+static crc4	CRC_fold_hw_m13(const ui1 *buf, si8 len, crc4 c)
+{
+	__m128i	x0, x1, x2, x3, x4, x5, x6, x7, x8, y5, y6, y7, y8;
+
+	x1 = _mm_loadu_si128((const __m128i *) (buf + 0x00));
+	x2 = _mm_loadu_si128((const __m128i *) (buf + 0x10));
+	x3 = _mm_loadu_si128((const __m128i *) (buf + 0x20));
+	x4 = _mm_loadu_si128((const __m128i *) (buf + 0x30));
+	x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128((si4) c));
+	x0 = _mm_load_si128((const __m128i *) CRC_fold_k1k2_m13);
+	buf += 64;
+	len -= 64;
+
+	// fold 64 bytes per step
+	while (len >= 64) {
+		x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+		x6 = _mm_clmulepi64_si128(x2, x0, 0x00);
+		x7 = _mm_clmulepi64_si128(x3, x0, 0x00);
+		x8 = _mm_clmulepi64_si128(x4, x0, 0x00);
+		x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+		x2 = _mm_clmulepi64_si128(x2, x0, 0x11);
+		x3 = _mm_clmulepi64_si128(x3, x0, 0x11);
+		x4 = _mm_clmulepi64_si128(x4, x0, 0x11);
+		y5 = _mm_loadu_si128((const __m128i *) (buf + 0x00));
+		y6 = _mm_loadu_si128((const __m128i *) (buf + 0x10));
+		y7 = _mm_loadu_si128((const __m128i *) (buf + 0x20));
+		y8 = _mm_loadu_si128((const __m128i *) (buf + 0x30));
+		x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), y5);
+		x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), y6);
+		x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), y7);
+		x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), y8);
+		buf += 64;
+		len -= 64;
+	}
+
+	// fold the four lanes into one
+	x0 = _mm_load_si128((const __m128i *) CRC_fold_k3k4_m13);
+	x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+	x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+	x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+	x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+	x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+	x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), x5);
+	x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+	x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+	x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), x5);
+
+	// fold 16 bytes per step
+	while (len >= 16) {
+		x2 = _mm_loadu_si128((const __m128i *) buf);
+		x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+		x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+		x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+		buf += 16;
+		len -= 16;
+	}
+
+	// 128 => 64 bits
+	x2 = _mm_clmulepi64_si128(x1, x0, 0x10);
+	x3 = _mm_setr_epi32(~0, 0, ~0, 0);
+	x1 = _mm_srli_si128(x1, 8);
+	x1 = _mm_xor_si128(x1, x2);
+	x0 = _mm_loadl_epi64((const __m128i *) CRC_fold_k5k0_m13);
+	x2 = _mm_srli_si128(x1, 4);
+	x1 = _mm_and_si128(x1, x3);
+	x1 = _mm_clmulepi64_si128(x1, x0, 0x00);
+	x1 = _mm_xor_si128(x1, x2);
+
+	// Barrett reduction => 32 bits
+	x0 = _mm_load_si128((const __m128i *) CRC_fold_poly_m13);
+	x2 = _mm_and_si128(x1, x3);
+	x2 = _mm_clmulepi64_si128(x2, x0, 0x10);
+	x2 = _mm_and_si128(x2, x3);
+	x2 = _mm_clmulepi64_si128(x2, x0, 0x00);
+	x1 = _mm_xor_si128(x1, x2);
+
+	return((crc4) _mm_extract_epi32(x1, 1));
+}
+#endif  // __x86_64__ || __i386__
+
+#ifdef __aarch64__
+// UNVERIFIED (no ARM test machine): the x86 routine above with PMULL for PCLMULQDQ; lane selectors as the PCLMULQDQ immediates
+#define CRC_PMULL_m13(a, a_lane, b, b_lane)	vreinterpretq_u64_p128(vmull_p64((poly64_t) vgetq_lane_u64((a), (a_lane)), (poly64_t) vgetq_lane_u64((b), (b_lane))))
+#define CRC_LOAD_m13(p)				vreinterpretq_u64_u8(vld1q_u8((const uint8_t *) (p)))
+#define CRC_SHIFT_BYTES_m13(a, n)		vreinterpretq_u64_u8(vextq_u8(vreinterpretq_u8_u64(a), vdupq_n_u8(0), (n)))  // as _mm_srli_si128()
+
+HW_CLMUL_FN_ATTR_m13
+static crc4	CRC_fold_hw_m13(const ui1 *buf, si8 len, crc4 c)
+{
+	uint64x2_t	x0, x1, x2, x3, x4, x5, x6, x7, x8;
+
+	x1 = CRC_LOAD_m13(buf + 0x00);
+	x2 = CRC_LOAD_m13(buf + 0x10);
+	x3 = CRC_LOAD_m13(buf + 0x20);
+	x4 = CRC_LOAD_m13(buf + 0x30);
+	x1 = veorq_u64(x1, vcombine_u64(vcreate_u64((ui8) c), vcreate_u64((ui8) 0)));
+	x0 = vld1q_u64((const uint64_t *) CRC_fold_k1k2_m13);
+	buf += 64;
+	len -= 64;
+
+	// fold 64 bytes per step
+	while (len >= 64) {
+		x5 = CRC_PMULL_m13(x1, 0, x0, 0);
+		x6 = CRC_PMULL_m13(x2, 0, x0, 0);
+		x7 = CRC_PMULL_m13(x3, 0, x0, 0);
+		x8 = CRC_PMULL_m13(x4, 0, x0, 0);
+		x1 = CRC_PMULL_m13(x1, 1, x0, 1);
+		x2 = CRC_PMULL_m13(x2, 1, x0, 1);
+		x3 = CRC_PMULL_m13(x3, 1, x0, 1);
+		x4 = CRC_PMULL_m13(x4, 1, x0, 1);
+		x1 = veorq_u64(veorq_u64(x1, x5), CRC_LOAD_m13(buf + 0x00));
+		x2 = veorq_u64(veorq_u64(x2, x6), CRC_LOAD_m13(buf + 0x10));
+		x3 = veorq_u64(veorq_u64(x3, x7), CRC_LOAD_m13(buf + 0x20));
+		x4 = veorq_u64(veorq_u64(x4, x8), CRC_LOAD_m13(buf + 0x30));
+		buf += 64;
+		len -= 64;
+	}
+
+	// fold the four lanes into one
+	x0 = vld1q_u64((const uint64_t *) CRC_fold_k3k4_m13);
+	x5 = CRC_PMULL_m13(x1, 0, x0, 0);
+	x1 = CRC_PMULL_m13(x1, 1, x0, 1);
+	x1 = veorq_u64(veorq_u64(x1, x2), x5);
+	x5 = CRC_PMULL_m13(x1, 0, x0, 0);
+	x1 = CRC_PMULL_m13(x1, 1, x0, 1);
+	x1 = veorq_u64(veorq_u64(x1, x3), x5);
+	x5 = CRC_PMULL_m13(x1, 0, x0, 0);
+	x1 = CRC_PMULL_m13(x1, 1, x0, 1);
+	x1 = veorq_u64(veorq_u64(x1, x4), x5);
+
+	// fold 16 bytes per step
+	while (len >= 16) {
+		x5 = CRC_PMULL_m13(x1, 0, x0, 0);
+		x1 = CRC_PMULL_m13(x1, 1, x0, 1);
+		x1 = veorq_u64(veorq_u64(x1, CRC_LOAD_m13(buf)), x5);
+		buf += 16;
+		len -= 16;
+	}
+
+	// 128 => 64 bits
+	x2 = CRC_PMULL_m13(x1, 0, x0, 1);
+	x3 = vdupq_n_u64((ui8) 0xFFFFFFFF);
+	x1 = CRC_SHIFT_BYTES_m13(x1, 8);
+	x1 = veorq_u64(x1, x2);
+	x0 = vld1q_u64((const uint64_t *) CRC_fold_k5k0_m13);
+	x2 = CRC_SHIFT_BYTES_m13(x1, 4);
+	x1 = vandq_u64(x1, x3);
+	x1 = CRC_PMULL_m13(x1, 0, x0, 0);
+	x1 = veorq_u64(x1, x2);
+
+	// Barrett reduction => 32 bits
+	x0 = vld1q_u64((const uint64_t *) CRC_fold_poly_m13);
+	x2 = vandq_u64(x1, x3);
+	x2 = CRC_PMULL_m13(x2, 0, x0, 1);
+	x2 = vandq_u64(x2, x3);
+	x2 = CRC_PMULL_m13(x2, 0, x0, 0);
+	x1 = veorq_u64(x1, x2);
+
+	return((crc4) vgetq_lane_u32(vreinterpretq_u32_u64(x1), 1));
+}
+#undef CRC_PMULL_m13
+#undef CRC_LOAD_m13
+#undef CRC_SHIFT_BYTES_m13
+#endif  // __aarch64__
+
+#endif  // HW_CRYPTO_m13
+
+
 tern	CRC_init_tables_m13(void)
 {
 	crc4			**crc_tables, c, n, k;
@@ -32200,6 +36701,11 @@ tern	CRC_init_tables_m13(void)
 	if (tables->CRC_tables)
 		return(TRUE_m13);
 	
+	// detect carry-less multiply before the lock (detection takes it; CRC_update_m13() reads CRC32_accel once the tables exist,
+	// & may run with the table mutex held - e.g. HW_get_machine_code_m13() - so it must not detect there)
+	if (tables->HW_params.CRC32_accel == UNKNOWN_m13)
+		HW_get_crypto_accel_m13();
+
 	pthread_mutex_lock_m13(&tables->mutex);
 	if (tables->CRC_tables) {  // may have been done by another thread while waiting
 		pthread_mutex_unlock_m13(&tables->mutex);
@@ -32287,10 +36793,61 @@ crc4	CRC_matrix_times_m13(const crc4 *mat, crc4 vec)
 }
 
 
+si4	CRC_parallel_spans_m13(si8 n_bytes)
+{
+	si4	n_spans;
+	
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// one span per logical core, none shorter than CRC_PAR_SPAN_BYTES_m13
+	// short runs, threading off, or a single core => 1 (calling thread)
+	
+	if (n_bytes < CRC_PAR_MIN_BYTES_m13)
+		return_m13(1);
+	if (PROC_default_threading_m13(NULL) != TRUE_m13)
+		return_m13(1);
+	
+	n_spans = globals_m13->tables->HW_params.logical_cores;
+	if ((si8) n_spans > n_bytes / CRC_PAR_SPAN_BYTES_m13)
+		n_spans = (si4) (n_bytes / CRC_PAR_SPAN_BYTES_m13);
+	if (n_spans < 1)
+		n_spans = 1;
+
+	return_m13(n_spans);
+}
+
+
+static pthread_rval_m13	CRC_span_thread_m13(void *ptr)
+{
+	PROC_JOB_m13	*job;
+	CRC_SPAN_m13	*span;
+
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// form required by PROC_jobs_distribute_m13(): job->function_arg is the CRC_SPAN_m13 *
+
+	job = (PROC_JOB_m13 *) ptr;
+	job->status = PROC_THREAD_RUNNING_m13;
+
+	span = (CRC_SPAN_m13 *) job->function_arg;
+	span->crc = CRC_calculate_m13(span->ptr, span->n_bytes);
+	job->status = PROC_THREAD_SUCCEEDED_m13;
+	
+	return_m13(PROC_JOB_STATUS_SET_m13);
+}
+
+
 crc4	CRC_update_m13(const ui1 *block_ptr, si8 block_bytes, crc4 current_crc)
 {
 	const crc4	**crc_tables, *ui4_buf;
 	crc4  		c;
+#ifdef HW_CRYPTO_m13
+	si8		hw_bytes;
+#endif
 	
 #ifdef FT_DEBUG_m13
 	G_push_function_m13();
@@ -32304,6 +36861,16 @@ crc4	CRC_update_m13(const ui1 *block_ptr, si8 block_bytes, crc4 current_crc)
 
 	c = ~current_crc;
 	
+#ifdef HW_CRYPTO_m13
+	// fold the whole 16 byte blocks of a long run with carry-less multiplies; the table code below finishes the tail
+	if (block_bytes >= CRC_HW_MIN_BYTES_m13 && globals_m13->tables->HW_params.CRC32_accel == TRUE_m13) {
+		hw_bytes = block_bytes & ~((si8) 15);
+		c = CRC_fold_hw_m13(block_ptr, hw_bytes, c);
+		block_ptr += hw_bytes;
+		block_bytes -= hw_bytes;
+	}
+#endif
+
 	// bring block_ptr to 4 byte alignment
 	while (block_bytes && ((ui8) block_ptr & (ui8) 3)) {
 		c = crc_tables[0][(c ^ (ui4) *block_ptr++) & (ui4) 0xff] ^ (c >> 8);
@@ -32326,6 +36893,62 @@ crc4	CRC_update_m13(const ui1 *block_ptr, si8 block_bytes, crc4 current_crc)
 }
 
 
+crc4	CRC_update_parallel_m13(const ui1 *block_ptr, si8 block_bytes, crc4 current_crc)
+{
+	tern		r_val;
+	si4		i, n_spans;
+	si8		span_bytes;
+	crc4		crc;
+	PROC_JOB_m13	*jobs;
+	CRC_SPAN_m13	*spans;
+	
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// same result as CRC_update_m13(): the run is cut into spans CRC'd on worker threads, & the span CRCs are combined in order
+	// (CRC_combine_m13() costs O(log n), so the combining is negligible against the spans)
+
+	n_spans = CRC_parallel_spans_m13(block_bytes);
+	jobs = NULL;
+	if (n_spans > 1)
+		jobs = (PROC_JOB_m13 *) calloc((size_t) n_spans, sizeof(PROC_JOB_m13) + sizeof(CRC_SPAN_m13));
+	if (jobs == NULL) {  // one span (or allocation failed): this thread
+		crc = CRC_update_m13(block_ptr, block_bytes, current_crc);
+		return_m13(crc);
+	}
+	spans = (CRC_SPAN_m13 *) (jobs + n_spans);
+
+	// spans start on 64 byte multiples (keeps the carry-less multiply folding on whole blocks); last span takes the remainder
+	span_bytes = (block_bytes / (si8) n_spans) & ~((si8) 63);
+	for (i = 0; i < n_spans; ++i) {
+		spans[i].ptr = block_ptr + ((si8) i * span_bytes);
+		spans[i].n_bytes = (i == n_spans - 1) ? block_bytes - ((si8) i * span_bytes) : span_bytes;
+		jobs[i].name = "CRC_span_thread_m13";
+		jobs[i].function = CRC_span_thread_m13;
+		jobs[i].function_arg = (void *) (spans + i);
+		jobs[i].priority = PROC_HIGH_PRIORITY_m13;
+		jobs[i].skip = FALSE_m13;
+	}
+	
+	// spans share the jobs allocation: every span job must be done with it before it's freed, launch failed or not
+	// (distribution waits, running queued spans itself meanwhile)
+	r_val = PROC_jobs_distribute_m13(jobs, n_spans, 0, PROC_JOBS_PER_CORE_DEFAULT_m13, TRUE_m13, TRUE_m13);
+	if (r_val == FALSE_m13) {  // launch failed: this thread
+		free(jobs);
+		crc = CRC_update_m13(block_ptr, block_bytes, current_crc);
+		return_m13(crc);
+	}
+
+	crc = current_crc;
+	for (i = 0; i < n_spans; ++i)
+		crc = CRC_combine_m13(crc, spans[i].crc, spans[i].n_bytes);
+	free(jobs);
+	
+	return_m13(crc);
+}
+
+
 tern	CRC_validate_m13(const ui1 *block_ptr, si8 block_bytes, crc4 crc_to_validate)
 {
 	ui4	crc;
@@ -32343,6 +36966,23 @@ tern	CRC_validate_m13(const ui1 *block_ptr, si8 block_bytes, crc4 crc_to_validat
 }
 
 
+tern	CRC_validate_parallel_m13(const ui1 *block_ptr, si8 block_bytes, crc4 crc_to_validate)
+{
+	crc4	crc;
+	
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	crc = CRC_calculate_parallel_m13(block_ptr, block_bytes);
+	
+	if (crc == crc_to_validate)
+		return_m13(TRUE_m13);
+	
+	return_m13(FALSE_m13);
+}
+
+
 //*******************************//
 // MARK: DATABASE FUNCTIONS  (DB)
 //*******************************//
@@ -32491,6 +37131,110 @@ static void	DGST_absorb_m13(DGST_STREAM_m13 *dg, const ui1 *ptr, si8 n_bytes)
 }
 
 
+static pthread_rval_m13	DGST_batch_thread_m13(void *ptr)
+{
+	PROC_JOB_m13	*job;
+
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// form required by PROC_jobs_distribute_m13(): job->function_arg is the shared DGST_BATCH_m13 *
+
+	job = (PROC_JOB_m13 *) ptr;
+	job->status = PROC_THREAD_RUNNING_m13;
+
+	DGST_batch_worker_m13((DGST_BATCH_m13 *) job->function_arg);
+	job->status = PROC_THREAD_SUCCEEDED_m13;
+
+	return_m13(PROC_JOB_STATUS_SET_m13);
+}
+
+
+static void	DGST_batch_worker_m13(DGST_BATCH_m13 *batch)
+{
+	ui1		*buffers;
+	si4		i, l, n_active, idx;
+	si8		n_blocks, lane_blocks;
+	const ui1	*data[SHA_LANES_m13];
+	SHA_CTX_m13	*ctx[SHA_LANES_m13];
+	DGST_LANE_m13	lanes[SHA_LANES_m13], *lane, *active[SHA_LANES_m13];
+
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// multi-buffer digest worker: up to SHA_LANES_m13 files in flight, each read sequentially in DGST_BATCH_CHUNK_BYTES_m13
+	// chunks; every pass absorbs the whole blocks all lanes have buffered in one SHA_update_blocks_m13() call, then
+	// refills (or finishes) the lanes that ran dry. Idle lanes claim the next unclaimed file of the batch.
+
+	if (atomic_load(&batch->next_file) >= batch->n_files)
+		return_void_m13;
+	buffers = (ui1 *) malloc_m13((size_t) (SHA_LANES_m13 * DGST_BATCH_CHUNK_BYTES_m13));
+	if (buffers == NULL)
+		return_void_m13;  // claims nothing: remaining files go to other workers or the caller's drain
+	for (l = 0; l < SHA_LANES_m13; ++l) {
+		lanes[l].buffer = buffers + ((si8) l * DGST_BATCH_CHUNK_BYTES_m13);
+		lanes[l].fp = NULL;
+		lanes[l].file_idx = -1;
+	}
+
+	while (1) {
+		// idle lanes claim files
+		for (l = 0; l < SHA_LANES_m13; ++l) {
+			lane = lanes + l;
+			while (lane->file_idx < 0) {
+				idx = atomic_fetch_add(&batch->next_file, 1);
+				if (idx >= batch->n_files)
+					break;
+				lane->file_idx = idx;
+				if (DGST_lane_open_m13(lane, batch->paths[idx]) == FALSE_m13)
+					DGST_lane_close_m13(batch, lane, FALSE_m13);
+			}
+		}
+
+		// whole blocks every active lane has buffered
+		n_blocks = DGST_BATCH_CHUNK_BYTES_m13 >> 6;
+		for (n_active = l = 0; l < SHA_LANES_m13; ++l) {
+			lane = lanes + l;
+			if (lane->file_idx < 0)
+				continue;
+			active[n_active++] = lane;
+			lane_blocks = (lane->buf_bytes - lane->buf_pos) >> 6;
+			if (lane_blocks < n_blocks)
+				n_blocks = lane_blocks;
+		}
+		if (n_active == 0)
+			break;
+		if (n_blocks) {
+			for (i = 0; i < n_active; ++i) {
+				ctx[i] = &active[i]->ctx;
+				data[i] = active[i]->buffer + active[i]->buf_pos;
+				active[i]->buf_pos += n_blocks << 6;
+			}
+			SHA_update_blocks_m13(ctx, data, n_active, n_blocks);
+		}
+
+		// refill or finish lanes holding less than a block
+		for (i = 0; i < n_active; ++i) {
+			lane = active[i];
+			if (lane->buf_bytes - lane->buf_pos >= 64)
+				continue;
+			if (lane->remaining) {
+				if (DGST_lane_fill_m13(lane) == FALSE_m13)
+					DGST_lane_close_m13(batch, lane, FALSE_m13);
+			} else {
+				SHA_update_m13(&lane->ctx, lane->buffer + lane->buf_pos, lane->buf_bytes - lane->buf_pos);
+				DGST_lane_close_m13(batch, lane, DGST_finish_m13(&lane->ctx, lane->fp, lane->uh_offset, lane->buffer, batch->results + lane->file_idx));
+			}
+		}
+	}
+	free_m13(buffers);
+
+	return_void_m13;
+}
+
+
 tern	DGST_begin_m13(FILE_m13 *fp)
 {
 	ui1		*buffer;
@@ -32590,9 +37334,10 @@ static void	DGST_deserialize_state_m13(SHA_CTX_m13 *ctx, const ui1 *resume)
 tern	DGST_file_m13(const si1 *path, DGST_RESULT_m13 *result)
 {
 	ui1		*buffer;
-	si8		flen, nr, pcrc_offset, uh_offset, data_start, data_len, remaining;
+	si8		nr, uh_offset, data_start, data_len, remaining;
+	tern		r_val;
 	FILE_m13	*fp;
-	SHA_CTX_m13	ctx, body_ctx;
+	SHA_CTX_m13	ctx;
 
 #ifdef FT_DEBUG_m13
 	G_push_function_m13();
@@ -32614,26 +37359,7 @@ tern	DGST_file_m13(const si1 *path, DGST_RESULT_m13 *result)
 	fp = fopen_m13(path, "r");
 	if (fp == NULL)
 		return_m13(FALSE_m13);
-	flen = flen_m13(fp);
-
-	// region boundaries
-	uh_offset = 0;
-	data_start = (si8) UH_BYTES_m13;
-	data_len = 0;
-	pcrc_offset = PCRC_offset_m13(fp, path, NULL);  // == end of covered data (flen if no pcrcs)
-	if (pcrc_offset <= 0 || pcrc_offset > flen)
-		pcrc_offset = flen;
-	if (flen < (si8) UH_BYTES_m13) {  // degenerate: no universal header region => whole file, file order
-		uh_offset = -1;
-		data_start = 0;
-		data_len = flen;
-	} else if (G_is_video_data_m13(path) == TRUE_m13) {  // UH at file END (video stays playable: native container extensions)
-		uh_offset = pcrc_offset - (si8) UH_BYTES_m13;
-		data_start = 0;
-		data_len = uh_offset;
-	} else {
-		data_len = pcrc_offset - (si8) UH_BYTES_m13;
-	}
+	DGST_regions_m13(fp, path, &uh_offset, &data_start, &data_len);
 
 	// stream the body
 	SHA_init_tables_m13();  // self-guarding (SHA_init_m13() alone does not initialize the tables)
@@ -32651,29 +37377,68 @@ tern	DGST_file_m13(const si1 *path, DGST_RESULT_m13 *result)
 		SHA_update_m13(&ctx, buffer, nr);
 	}
 
-	// pre-UH state => resume & body
-	DGST_serialize_state_m13(&ctx, result->resume);
-	body_ctx = ctx;
-	SHA_finalize_m13(&body_ctx, result->body);
-
-	// universal header absorbed last => full
-	if (uh_offset >= 0) {
-		fseek_m13(fp, uh_offset, SEEK_SET);
-		if (fread_m13(buffer, sizeof(ui1), (size_t) UH_BYTES_m13, fp) != (si8) UH_BYTES_m13) {
-			free_m13(buffer);
-			fclose_m13(fp);
-			G_set_error_m13(E_FREAD_m13, "digest could not read target file \"%s\"", path);
-			return_m13(FALSE_m13);
-		}
-		SHA_update_m13(&ctx, buffer, (si8) UH_BYTES_m13);
-		SHA_finalize_m13(&ctx, result->full);
-	} else {  // degenerate: no UH region
-		memcpy(result->full, result->body, DGST_BYTES_m13);
-	}
+	r_val = DGST_finish_m13(&ctx, fp, uh_offset, buffer, result);
 	free_m13(buffer);
 	fclose_m13(fp);
 
-	return_m13(TRUE_m13);
+	return_m13(r_val);
+}
+
+
+tern	DGST_files_m13(si1 **paths, si4 n_files, DGST_RESULT_m13 *results, tern *file_ok)
+{
+	si4		i, n_workers;
+	PROC_JOB_m13	*jobs;
+	DGST_BATCH_m13	batch;
+
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// DGST_file_m13() for a list of files (e.g. every file of a session at archive or transfer); results[i] is
+	// identical to DGST_file_m13(paths[i]). One worker per logical core pulls files from the list; each worker keeps
+	// SHA_LANES_m13 files in flight with large sequential reads & hashes them together (DGST_batch_worker_m13()),
+	// so a session costs about its read time rather than the sum of single-stream digests.
+	// file_ok (may be NULL) gets TRUE_m13 / FALSE_m13 per file (a failed file's result is zeroed); returns FALSE_m13 if any file failed
+
+	if (paths == NULL || results == NULL) {
+		G_set_error_m13(E_GEN_m13, "NULL argument");
+		return_m13(FALSE_m13);
+	}
+	if (n_files < 1)
+		return_m13(TRUE_m13);
+
+	SHA_init_tables_m13();  // before the workers start (self-guarding)
+	batch.paths = paths;
+	batch.results = results;
+	batch.file_ok = file_ok;
+	batch.n_files = n_files;
+	atomic_init(&batch.next_file, 0);
+	atomic_init(&batch.n_failed, 0);
+
+	n_workers = 1;
+	if (n_files > 1 && PROC_default_threading_m13(NULL) == TRUE_m13) {
+		n_workers = globals_m13->tables->HW_params.logical_cores;
+		if (n_workers > n_files)
+			n_workers = n_files;
+	}
+	jobs = NULL;
+	if (n_workers > 1)
+		jobs = (PROC_JOB_m13 *) calloc((size_t) n_workers, sizeof(PROC_JOB_m13));
+	if (jobs) {
+		for (i = 0; i < n_workers; ++i) {
+			jobs[i].name = "DGST_batch_thread_m13";
+			jobs[i].function = DGST_batch_thread_m13;
+			jobs[i].function_arg = (void *) &batch;
+			jobs[i].priority = PROC_HIGH_PRIORITY_m13;
+			jobs[i].skip = FALSE_m13;
+		}
+		PROC_jobs_distribute_m13(jobs, n_workers, 0, PROC_JOBS_PER_CORE_DEFAULT_m13, TRUE_m13, TRUE_m13);  // waits for all (batch lives on this stack), running queued workers itself meanwhile
+		free(jobs);
+	}
+	DGST_batch_worker_m13(&batch);  // single worker, or drain whatever failed launches left unclaimed
+
+	return_m13((atomic_load(&batch.n_failed) == 0) ? TRUE_m13 : FALSE_m13);
 }
 
 
@@ -32748,6 +37513,37 @@ tern	DGST_finalize_m13(FILE_m13 *fp, DGST_RESULT_m13 *result)
 }
 
 
+static tern	DGST_finish_m13(SHA_CTX_m13 *ctx, FILE_m13 *fp, si8 uh_offset, ui1 *buffer, DGST_RESULT_m13 *result)
+{
+	SHA_CTX_m13	body_ctx;
+
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// ctx has absorbed the whole data region: pre-UH state => resume & body; universal header (read at uh_offset
+	// into buffer, >= UH_BYTES_m13) absorbed last => full
+
+	DGST_serialize_state_m13(ctx, result->resume);
+	body_ctx = *ctx;
+	SHA_finalize_m13(&body_ctx, result->body);
+
+	if (uh_offset >= 0) {
+		fseek_m13(fp, uh_offset, SEEK_SET);
+		if (fread_m13(buffer, sizeof(ui1), (size_t) UH_BYTES_m13, fp) != (si8) UH_BYTES_m13) {
+			G_set_error_m13(E_FREAD_m13, "digest could not read target file \"%s\"", fp->path);
+			return_m13(FALSE_m13);
+		}
+		SHA_update_m13(ctx, buffer, (si8) UH_BYTES_m13);
+		SHA_finalize_m13(ctx, result->full);
+	} else {  // degenerate: no UH region
+		memcpy(result->full, result->body, DGST_BYTES_m13);
+	}
+
+	return_m13(TRUE_m13);
+}
+
+
 void	DGST_free_m13(FILE_m13 *fp)
 {
 #ifdef FT_DEBUG_m13
@@ -32791,6 +37587,119 @@ tern	DGST_full_from_resume_m13(const ui1 *resume, const ui1 *uh_bytes, ui1 *full
 }
 
 
+static void	DGST_lane_close_m13(DGST_BATCH_m13 *batch, DGST_LANE_m13 *lane, tern ok)
+{
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// retire a DGST_batch_worker_m13() lane's file (result already written if ok) & idle the lane
+
+	if (lane->fp != NULL) {
+		fclose_m13(lane->fp);
+		lane->fp = NULL;
+	}
+	if (batch->file_ok != NULL)
+		batch->file_ok[lane->file_idx] = (ok == TRUE_m13) ? TRUE_m13 : FALSE_m13;
+	if (ok != TRUE_m13) {
+		memset((void *) (batch->results + lane->file_idx), 0, sizeof(DGST_RESULT_m13));  // (may be partly written)
+		atomic_fetch_add(&batch->n_failed, 1);
+	}
+	lane->file_idx = -1;
+
+	return_void_m13;
+}
+
+
+static tern	DGST_lane_fill_m13(DGST_LANE_m13 *lane)
+{
+	si8	left, nr;
+
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// next sequential chunk of the lane's data region, behind the (< one block) bytes not yet absorbed
+
+	left = lane->buf_bytes - lane->buf_pos;
+	if (left)
+		memmove(lane->buffer, lane->buffer + lane->buf_pos, (size_t) left);
+	nr = DGST_BATCH_CHUNK_BYTES_m13 - left;
+	if (nr > lane->remaining)
+		nr = lane->remaining;
+	if (fread_m13(lane->buffer + left, sizeof(ui1), (size_t) nr, lane->fp) != nr) {
+		G_set_error_m13(E_FREAD_m13, "digest could not read target file \"%s\"", lane->fp->path);
+		return_m13(FALSE_m13);
+	}
+	lane->buf_bytes = left + nr;
+	lane->buf_pos = 0;
+	lane->remaining -= nr;
+
+	return_m13(TRUE_m13);
+}
+
+
+static tern	DGST_lane_open_m13(DGST_LANE_m13 *lane, const si1 *path)
+{
+	si8	data_start;
+
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// start a DGST_batch_worker_m13() lane on a file (as DGST_file_m13() does) & read its first chunk
+
+	if (G_exists_m13(path) != FILE_EXISTS_m13) {
+		G_set_error_m13(E_GEN_m13, "digest target file \"%s\" does not exist", path);
+		return_m13(FALSE_m13);
+	}
+	lane->fp = fopen_m13(path, "r");
+	if (lane->fp == NULL)
+		return_m13(FALSE_m13);
+	DGST_regions_m13(lane->fp, path, &lane->uh_offset, &data_start, &lane->remaining);
+	fseek_m13(lane->fp, data_start, SEEK_SET);
+	SHA_init_m13(&lane->ctx);
+	lane->buf_bytes = lane->buf_pos = 0;
+	if (lane->remaining)
+		return_m13(DGST_lane_fill_m13(lane));
+
+	return_m13(TRUE_m13);
+}
+
+
+static void	DGST_regions_m13(FILE_m13 *fp, const si1 *path, si8 *uh_offset, si8 *data_start, si8 *data_len)
+{
+	si8	flen, pcrc_offset;
+
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// canonical regions of an open file: data region [data_start, data_start + data_len) & the universal header at
+	// uh_offset (< 0: degenerate file smaller than one universal header => whole file, file order)
+
+	flen = flen_m13(fp);
+	*uh_offset = 0;
+	*data_start = (si8) UH_BYTES_m13;
+	pcrc_offset = PCRC_offset_m13(fp, path, NULL);  // == end of covered data (flen if no pcrcs)
+	if (pcrc_offset <= 0 || pcrc_offset > flen)
+		pcrc_offset = flen;
+	if (flen < (si8) UH_BYTES_m13) {  // degenerate: no universal header region => whole file, file order
+		*uh_offset = -1;
+		*data_start = 0;
+		*data_len = flen;
+	} else if (G_is_video_data_m13(path) == TRUE_m13) {  // UH at file END (video stays playable: native container extensions)
+		*uh_offset = pcrc_offset - (si8) UH_BYTES_m13;
+		*data_start = 0;
+		*data_len = *uh_offset;
+	} else {
+		*data_len = pcrc_offset - (si8) UH_BYTES_m13;
+	}
+
+	return_void_m13;
+}
+
+
 tern	DGST_resume_valid_m13(const ui1 *resume, const ui1 *body_digest)
 {
 	ui1		check[DGST_BYTES_m13];
@@ -32984,31 +37893,35 @@ pthread_rval_m13	DM_channel_thread_m13(void *ptr)
 		if (dm->sample_count >= n_raw_samps)  // upsampling - no need to antialias
 			filter = FALSE_m13;
 
-	// FAST PATH: output geometry equals input (ratio 1) and no per-sample processing is requested => copy the decompressed
-	// samples straight into the caller's matrix, skipping the sf8 conversion, (identity) interpolation, & restore.  Converting
-	// as CONV((sf8) sample) reproduces the general path bit-for-bit (si4->sf8 is exact; ratio-1 interpolation is identity).
+	// FAST PATH: output geometry equals input (ratio 1) and no per-sample processing is requested => decode the samples
+	// straight into the caller's matrix (deferred reads), or copy them from the CPS, skipping the sf8 conversion, (identity)
+	// interpolation, & restore.  Converting as CONV((sf8) sample) reproduces the general path bit-for-bit (si4->sf8 is exact;
+	// ratio-1 interpolation is identity).
 	if (dm->valid_sample_count == n_raw_samps && filter == FALSE_m13 && trace_ranges == FALSE_m13 &&
 	    (dm->flags & (DM_TRACE_EXTREMA_m13 | DM_DETREND_m13)) == 0 &&
 	    ((dm->flags & DM_SCALE_m13) == 0 || dm->scale_factor == (sf8) 1.0)) {
 		ui1	*pt_base = (ui1 *) dm->data;
 		if (dm->flags & DM_2D_INDEXING_m13)
 			pt_base += dm->maj_dim * sizeof(void *);
-		if (dm->flags & DM_FMT_CHANNEL_MAJOR_m13)
-			chan_offset = chan_idx * dm->sample_count;
-		else  // DM_FMT_SAMPLE_MAJOR_m13
+		if (dm->flags & DM_FMT_CHANNEL_MAJOR_m13) {  // contiguous per channel
+			pt_base += (chan_idx * dm->sample_count) * dm->el_size;
+			samp_offset = 1;
+		} else {  // DM_FMT_SAMPLE_MAJOR_m13: stride by channel_count
+			pt_base += chan_idx * dm->el_size;
 			samp_offset = dm->channel_count;
-		switch (dm->flags & DM_TYPE_MASK_m13) {
-			case DM_TYPE_SI2_m13: DM_PASSTHRU_m13(si2, CMP_round_si2_m13); break;
-			case DM_TYPE_SI4_m13: DM_PASSTHRU_m13(si4, CMP_round_si4_m13); break;
-			case DM_TYPE_SF4_m13: DM_PASSTHRU_m13(sf4, (sf4)); break;
-			case DM_TYPE_SF8_m13: DM_PASSTHRU_m13(sf8, (sf8)); break;
+		}
+		for (i = 0, j = seg_idx; i < slice->n_segs; ++i, ++j) {
+			if ((k = G_decode_time_series_data_m13(chan->segs[j], (void *) pt_base, dm->flags & DM_TYPE_MASK_m13, samp_offset)) == FALSE_m13) {
+				job->status = PROC_THREAD_FAILED_m13;
+				goto DM_CHANNEL_THREAD_RETURN_m13;
+			}
+			pt_base += (k * samp_offset) * dm->el_size;
 		}
 		job->status = PROC_THREAD_SUCCEEDED_m13;
 		goto DM_CHANNEL_THREAD_RETURN_m13;
 	}
 
-	// allocate processing buffers
-	dm->in_bufs[chan_idx] = CMP_allocate_buffers_m13(dm->in_bufs[chan_idx], 3, required_in_buf_len, sizeof(sf8), FALSE_m13, FALSE_m13);
+	// allocate output buffers
 	// out_bufs hold the interpolated sf8 result; the channel-major sf8 case writes straight into dm->data (& its range arrays),
 	// so it needs no separate output buffers (one per channel, each the full output length - real memory on a large fetch)
 	if ((dm->flags & (DM_FMT_CHANNEL_MAJOR_m13 | DM_TYPE_SF8_m13)) != (DM_FMT_CHANNEL_MAJOR_m13 | DM_TYPE_SF8_m13)) {
@@ -33016,6 +37929,41 @@ pthread_rval_m13	DM_channel_thread_m13(void *ptr)
 		dm->out_bufs[chan_idx] = CMP_allocate_buffers_m13(dm->out_bufs[chan_idx], n_out_bufs, dm->valid_sample_count, sizeof(sf8), FALSE_m13, FALSE_m13);
 	}
 
+	// set up output buffers
+	if ((dm->flags & DM_FMT_CHANNEL_MAJOR_m13) && (dm->flags & DM_TYPE_SF8_m13)) {
+		// special case - put results directly in output array
+		chan_offset = chan_idx * dm->sample_count;
+		if (dm->flags & DM_2D_INDEXING_m13) {
+			out_buf = *((sf8 **) dm->data) + chan_offset;
+			if (trace_ranges == TRUE_m13) {
+				out_mins =  *((sf8 **) dm->range_minima) + chan_offset;
+				out_maxs =  *((sf8 **) dm->range_maxima) + chan_offset;
+			}
+		} else {
+			out_buf = (sf8 *) dm->data + chan_offset;
+			if (trace_ranges == TRUE_m13) {
+				out_mins = (sf8 *) dm->range_minima + chan_offset;
+				out_maxs = (sf8 *) dm->range_maxima + chan_offset;
+			}
+		}
+	} else {
+		out_buf = dm->out_bufs[chan_idx]->buffer[0];
+		if (trace_ranges == TRUE_m13) {
+			out_mins = dm->out_bufs[chan_idx]->buffer[1];
+			out_maxs = dm->out_bufs[chan_idx]->buffer[2];
+		}
+	}
+	
+	// trace ranges from segment overviews: no segment data decoded, & no input buffers needed
+	if (trace_ranges == TRUE_m13 && filter == FALSE_m13 && globals_m13->miscellaneous.segment_overviews == TRUE_m13) {
+		if ((sf8) n_raw_samps / (sf8) dm->valid_sample_count >= OVW_MIN_DECIMATION_m13)
+			if (DM_overview_ranges_m13(chan, n_raw_samps, dm->valid_sample_count, out_buf, out_mins, out_maxs) == TRUE_m13)
+				goto DM_CHANNEL_THREAD_OVERVIEW_DONE_m13;
+	}
+
+	// allocate processing buffers
+	dm->in_bufs[chan_idx] = CMP_allocate_buffers_m13(dm->in_bufs[chan_idx], 3, required_in_buf_len, sizeof(sf8), FALSE_m13, FALSE_m13);
+
 	// initialize filter - cached per channel: reuse the existing filter unless a design parameter changed (a viewer paging at a
 	// fixed timescale keeps them identical call to call; a timescale/cutoff change rebuilds).  FILT_filtfilt_m13() treats the
 	// coefficients & initial conditions as read-only, so the cached filter stays valid.  A no-filter call leaves the cache intact.
@@ -33052,6 +38000,11 @@ pthread_rval_m13	DM_channel_thread_m13(void *ptr)
 	for (i = 0, j = seg_idx; i < slice->n_segs; ++i, ++j) {
 		seg = chan->segs[j];
 		cps = seg->ts_data_fps->params.cps;
+		if (cps->params.decode_deferred == TRUE_m13)  // fast path mispredicted: decode into the CPS
+			if (G_decode_time_series_data_m13(seg, NULL, 0, 0) == FALSE_m13) {
+				job->status = PROC_THREAD_FAILED_m13;
+				goto DM_CHANNEL_THREAD_RETURN_m13;
+			}
 		seg_samps = cps->decompressed_data;
 		n_seg_samps = SLICE_IDX_COUNT_S_m13(seg->slice);
 		for (k = n_seg_samps; k--;)
@@ -33064,31 +38017,6 @@ pthread_rval_m13	DM_channel_thread_m13(void *ptr)
 		raw_samps = filtps->filt_data;
 	}
 
-	// set up output buffers
-	if ((dm->flags & DM_FMT_CHANNEL_MAJOR_m13) && (dm->flags & DM_TYPE_SF8_m13)) {
-		// special case - put results directly in output array
-		chan_offset = chan_idx * dm->sample_count;
-		if (dm->flags & DM_2D_INDEXING_m13) {
-			out_buf = *((sf8 **) dm->data) + chan_offset;
-			if (trace_ranges == TRUE_m13) {
-				out_mins =  *((sf8 **) dm->range_minima) + chan_offset;
-				out_maxs =  *((sf8 **) dm->range_maxima) + chan_offset;
-			}
-		} else {
-			out_buf = (sf8 *) dm->data + chan_offset;
-			if (trace_ranges == TRUE_m13) {
-				out_mins = (sf8 *) dm->range_minima + chan_offset;
-				out_maxs = (sf8 *) dm->range_maxima + chan_offset;
-			}
-		}
-	} else {
-		out_buf = dm->out_bufs[chan_idx]->buffer[0];
-		if (trace_ranges == TRUE_m13) {
-			out_mins = dm->out_bufs[chan_idx]->buffer[1];
-			out_maxs = dm->out_bufs[chan_idx]->buffer[2];
-		}
-	}
-	
 	// binterpolate
 	switch (dm->flags & DM_INTRP_BINTRP_MASK_d1) {
 		case DM_INTRP_BINTRP_MDPT_m13:
@@ -33178,6 +38106,8 @@ pthread_rval_m13	DM_channel_thread_m13(void *ptr)
 				CMP_binterpolate_sf8_m13(unfiltered_raw_samps, n_raw_samps, NULL, dm->valid_sample_count, CMP_CENT_MODE_NONE_m13, trace_ranges, out_mins, out_maxs);
 			break;
 	}
+
+DM_CHANNEL_THREAD_OVERVIEW_DONE_m13:
 	
 	// scale
 	scale = dm->scale_factor;
@@ -33293,7 +38223,205 @@ pthread_rval_m13	DM_channel_thread_m13(void *ptr)
 
 DM_CHANNEL_THREAD_RETURN_m13:
 	
-	return_m13((pthread_rval_m13) 0);
+	return_m13(PROC_JOB_STATUS_SET_m13);
+}
+
+
+pthread_rval_m13	DM_epochs_thread_m13(void *ptr)
+{
+	tern				filter;
+	ui1				*out_base;
+	si4				*row, filt_type, n_cutoffs, order;
+	si8				i, k, row_idx, n_in, n_out, n_rows, n_valid, start, end, out_start, out_end;
+	sf8				*in_buf, *out_buf, *src, *dst, fc1, fc2, cutoff_ratio, cr2, scale, nan_sf8;
+	FILTPS_m13			*filtps;
+	DM_EPOCHS_m13			*dme;
+	EPOCHS_m13			*epochs;
+	PROC_JOB_m13			*job;
+	DM_EPOCHS_THREAD_INFO_m13	*ti;
+
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+	
+	// processes one channel's row in every epoch (same steps as DM_channel_thread_m13(), on rows read by G_read_epochs_m13())
+	// form required by PROC_jobs_distribute_m13()
+
+	job = (PROC_JOB_m13 *) ptr;
+	job->status = PROC_THREAD_RUNNING_m13;
+
+	ti = (DM_EPOCHS_THREAD_INFO_m13 *) (job->function_arg);
+	dme = ti->dme;
+	epochs = ti->epochs;
+	n_rows = dme->epoch_count;
+
+	// set up for filtering (design is the same for every epoch: built once)
+	filter = FALSE_m13;
+	filtps = NULL;
+	order = 3;
+	filt_type = FILT_LOWPASS_TYPE_m13;
+	n_cutoffs = 1;
+	fc1 = fc2 = (sf8) 0.0;
+	if (dme->flags & DM_FILT_MASK_m13) {
+		switch (dme->flags & DM_FILT_MASK_m13) {
+			case DM_FILT_ANTIALIAS_m13:
+			case DM_FILT_LOWPASS_m13:
+				filt_type = FILT_LOWPASS_TYPE_m13;
+				fc1 = dme->filter_high_fc;
+				n_cutoffs = 1;
+				break;
+			case DM_FILT_HIGHPASS_m13:
+				filt_type = FILT_HIGHPASS_TYPE_m13;
+				fc1 = dme->filter_low_fc;
+				n_cutoffs = 1;
+				break;
+			case DM_FILT_BANDPASS_m13:
+				filt_type = FILT_BANDPASS_TYPE_m13;
+				fc1 = dme->filter_low_fc;
+				fc2 = dme->filter_high_fc;
+				n_cutoffs = 2;
+				break;
+			case DM_FILT_BANDSTOP_m13:
+				filt_type = FILT_BANDSTOP_TYPE_m13;
+				fc1 = dme->filter_low_fc;
+				fc2 = dme->filter_high_fc;
+				n_cutoffs = 2;
+				break;
+		}
+		cutoff_ratio = fc1 / ti->samp_freq;
+		cr2 = (n_cutoffs == 2) ? fc2 / ti->samp_freq : (sf8) 0.0;
+		if (cutoff_ratio < (sf8) 0.5 && cr2 < (sf8) 0.5) {  // can't filter above Nyquist
+			filter = TRUE_m13;
+			if (cutoff_ratio >= (sf8) 3.14e-05)  // empirically determined
+				order = 4;
+		}
+	}
+	if ((dme->flags & DM_FILT_ANTIALIAS_m13) && dme->sampling_frequency >= ti->samp_freq)  // upsampling - no need to antialias
+		filter = FALSE_m13;
+	if (filter == TRUE_m13) {
+		filtps = FILT_init_m13(order, filt_type, ti->samp_freq, epochs->epoch_samples, TRUE_m13, TRUE_m13, TRUE_m13, (SUPPRESS_OUTPUT_m13 | RETURN_ON_FAIL_m13), fc1, fc2);
+		if (filtps == NULL) {
+			G_warning_message_m13("%s(): filter error => not filtering\n", __FUNCTION__);
+			filter = FALSE_m13;
+		}
+	}
+	in_buf = (filter == TRUE_m13) ? filtps->orig_data : (sf8 *) malloc_m13((size_t) epochs->epoch_samples * sizeof(sf8));
+	out_buf = (sf8 *) malloc_m13((size_t) dme->sample_count * sizeof(sf8));
+	scale = ((dme->flags & DM_SCALE_m13) && dme->scale_factor != (sf8) 0.0) ? dme->scale_factor : (sf8) 1.0;
+	nan_sf8 = (dme->flags & DM_DSCNT_NAN_m13) ? NAN : (sf8) 0.0;
+
+	for (k = 0; k < n_rows; ++k) {
+		row_idx = (k * dme->channel_count) + ti->chan_idx;
+		row = epochs->samples + (row_idx * epochs->epoch_samples);
+		
+		// si4 -> sf8, filter, resample
+		// the row is padded with NAN_SI4_m13 where the window reaches no data (before or after the recording, between segments), & its
+		// samples are placed where they fall => each contiguous run is filtered & resampled into the span it maps to in the output row,
+		// keeping the row time-locked to the event (padding & NaN coded samples come out as nan_sf8)
+		for (i = 0; i < dme->sample_count; ++i)
+			out_buf[i] = nan_sf8;
+		n_valid = 0;
+		for (start = 0; start < epochs->epoch_samples; start = end) {
+			if (row[start] == NAN_SI4_m13) {
+				end = start + 1;
+				continue;
+			}
+			for (end = start + 1; end < epochs->epoch_samples; ++end)
+				if (row[end] == NAN_SI4_m13)
+					break;
+			n_in = end - start;
+			for (i = 0; i < n_in; ++i)
+				in_buf[i] = (sf8) row[start + i];
+			src = in_buf;
+			if (filter == TRUE_m13) {
+				filtps->data_length = n_in;
+				FILT_filtfilt_m13(filtps);  // (too few samples: copied through unfiltered)
+				src = filtps->filt_data;
+			}
+			out_start = (si8) round(((sf8) start * dme->sampling_frequency) / ti->samp_freq);
+			out_end = (si8) round(((sf8) end * dme->sampling_frequency) / ti->samp_freq);
+			if (out_end > dme->sample_count)
+				out_end = dme->sample_count;
+			n_out = out_end - out_start;
+			if (n_out <= 0)
+				continue;
+			dst = out_buf + out_start;
+			if (n_out != n_in && n_in > 1 && n_out > 1) {
+				CMP_lin_interp_sf8_m13(src, n_in, dst, n_out);
+			} else {
+				if (n_out > n_in)
+					n_out = n_in;
+				memcpy((void *) dst, (void *) src, (size_t) n_out * sizeof(sf8));
+			}
+			if (scale != (sf8) 1.0)
+				for (i = 0; i < n_out; ++i)
+					dst[i] *= scale;
+			n_valid += n_out;
+		}
+		dme->valid_sample_counts[row_idx] = n_valid;
+		
+		// store (nan_sf8 rounds to the NaN code of integer types)
+		out_base = (ui1 *) dme->data + ((row_idx * dme->sample_count) * dme->el_size);
+		switch (dme->flags & DM_TYPE_MASK_m13) {
+			case DM_TYPE_SI2_m13:
+				for (i = 0; i < dme->sample_count; ++i)
+					((si2 *) out_base)[i] = CMP_round_si2_m13(out_buf[i]);
+				break;
+			case DM_TYPE_SI4_m13:
+				for (i = 0; i < dme->sample_count; ++i)
+					((si4 *) out_base)[i] = CMP_round_si4_m13(out_buf[i]);
+				break;
+			case DM_TYPE_SF4_m13:
+				for (i = 0; i < dme->sample_count; ++i)
+					((sf4 *) out_base)[i] = (sf4) out_buf[i];
+				break;
+			case DM_TYPE_SF8_m13:
+				memcpy((void *) out_base, (void *) out_buf, (size_t) dme->sample_count * sizeof(sf8));
+				break;
+		}
+	}
+	
+	if (filtps)
+		FILT_free_m13(&filtps, TRUE_m13, TRUE_m13, TRUE_m13);
+	else
+		free_m13(in_buf);
+	free_m13(out_buf);
+
+	job->status = PROC_THREAD_SUCCEEDED_m13;
+	
+	return_m13(PROC_JOB_STATUS_SET_m13);
+}
+
+
+tern	DM_free_epochs_m13(DM_EPOCHS_m13 **epochs_ptr)
+{
+	DM_EPOCHS_m13	*dme;
+	
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	if (epochs_ptr == NULL) {
+		G_set_error_m13(E_GEN_m13, "pointer is null");
+		return_m13(FALSE_m13);
+	}
+	if ((dme = *epochs_ptr) == NULL)
+		return_m13(TRUE_m13);
+	
+	if (dme->data)
+		free_m13(dme->data);
+	if (dme->valid_sample_counts)
+		free_m13(dme->valid_sample_counts);
+	if (dme->epoch_times)
+		free_m13(dme->epoch_times);
+	if (dme->record_type_codes)
+		free_m13(dme->record_type_codes);
+	if (dme->chans)
+		free_m13(dme->chans);
+	free_m13(dme);
+	*epochs_ptr = NULL;
+
+	return_m13(TRUE_m13);
 }
 
 
@@ -33368,9 +38496,335 @@ tern	DM_free_matrix_m13(DATA_MATRIX_m13 **matrix_ptr)
 }
 
 
+static si8	DM_gather_records_m13(FPS_m13 *ri_fps, si4 *record_filters, si8 start_time, si8 end_time, EPOCH_SORT_m13 **recs, si8 *n_recs, si8 *max_recs)
+{
+	si8		i, n_entries;
+	REC_IDX_m13	*ri;
+	
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// appends the locking records of one record indices file to recs (start_time == record time, epoch_idx == gather order)
+	// only the indices are needed (no record data read); records outside [start_time, end_time] are dropped
+	
+	if (ri_fps == NULL)
+		return_m13(*n_recs);
+	if (ri_fps->params.full_file_read == FALSE_m13)
+		if ((ri_fps = FPS_read_m13(ri_fps, FPS_FULL_FILE_m13, 0, 0)) == NULL)
+			return_m13(*n_recs);
+	
+	ri = ri_fps->rec_inds;
+	n_entries = ri_fps->uh->n_entries - 1;  // last entry is the terminal index
+	for (i = 0; i < n_entries; ++i, ++ri) {
+		if (ri->start_time < start_time || ri->start_time > end_time)
+			continue;
+		if (G_include_record_m13(ri->type_code, record_filters) == FALSE_m13)
+			continue;
+		if (*n_recs == *max_recs) {
+			*max_recs = (*max_recs) ? (*max_recs << 1) : (si8) 256;
+			if (*recs == NULL)
+				*recs = (EPOCH_SORT_m13 *) malloc_m13((size_t) *max_recs * sizeof(EPOCH_SORT_m13));
+			else
+				*recs = (EPOCH_SORT_m13 *) realloc_m13((void *) *recs, (size_t) *max_recs * sizeof(EPOCH_SORT_m13));
+		}
+		(*recs)[*n_recs].start_time = ri->start_time;
+		(*recs)[*n_recs].end_time = ri->start_time;
+		(*recs)[*n_recs].epoch_idx = *n_recs;  // (sort tie-break)
+		(*recs)[*n_recs].type_code = ri->type_code;
+		++(*n_recs);
+	}
+	
+	return_m13(*n_recs);
+}
+
+
+DM_EPOCHS_m13	*DM_get_epochs_m13(SESS_m13 *sess, si4 *record_filters, si8 pre_time, si8 post_time, const si1 **chan_names, si4 n_chan_names, DATA_MATRIX_m13 *params)
+{
+	tern				threading, r_val;
+	si4				i, j, n_chans, seg_idx;
+	si8				k, n_recs, max_recs, n_rows, rec_start, rec_end;
+	ui8				*saved_chan_flags;
+	sf8				win_secs, samp_freq;
+	EPOCH_SORT_m13			*recs;
+	SLICE_m13			*windows;
+	EPOCHS_m13			*epochs;
+	DM_EPOCHS_m13			*dme;
+	PROC_JOB_m13			*jobs;
+	DM_EPOCHS_THREAD_INFO_m13	*tis;
+	PROC_GLOBS_m13			*pg;
+	CHAN_m13			*chan;
+	SEG_m13				*seg;
+	
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// one epoch per record passing record_filters (NULL: globals_m13->record_filters, see G_include_record_m13()) in the session
+	// & segmented session records, windowed [record time - pre_time, record time + post_time] (µs)
+	// chan_names selects the channels (NULL: the active channels); channel activation is restored on return
+	// all epochs are read in one coalesced pass (G_read_epochs_m13()) - not one session read per epoch
+	
+	if (sess == NULL) {
+		G_set_error_m13(E_GEN_m13, "session is null");
+		return_m13(NULL);
+	}
+	if (pre_time < 0 || post_time < 0) {
+		G_set_error_m13(E_GEN_m13, "negative window");
+		return_m13(NULL);
+	}
+	pg = G_proc_globs_m13((LH_m13 *) sess);
+
+	// locking records, in time order (records whose window leaves the session are dropped)
+	recs = NULL;
+	n_recs = max_recs = 0;
+	rec_start = pg->current_session.start_time + pre_time;
+	rec_end = pg->current_session.end_time - post_time;
+	DM_gather_records_m13(sess->rec_inds_fps, record_filters, rec_start, rec_end, &recs, &n_recs, &max_recs);
+	if (sess->ssr && sess->ssr->rec_inds_fps)
+		for (i = 0; i < pg->current_session.n_segments; ++i)
+			DM_gather_records_m13(sess->ssr->rec_inds_fps[i], record_filters, rec_start, rec_end, &recs, &n_recs, &max_recs);
+	if (n_recs == 0) {
+		G_set_error_m13(E_GEN_m13, "no matching records");
+		if (recs)
+			free_m13(recs);
+		return_m13(NULL);
+	}
+	qsort((void *) recs, (size_t) n_recs, sizeof(EPOCH_SORT_m13), G_epoch_compare_m13);
+	windows = (SLICE_m13 *) malloc_m13((size_t) n_recs * sizeof(SLICE_m13));
+	for (k = 0; k < n_recs; ++k) {
+		G_init_slice_m13(windows + k);
+		windows[k].start_time = recs[k].start_time - pre_time;
+		windows[k].end_time = recs[k].start_time + post_time;
+	}
+	
+	// select channels
+	saved_chan_flags = (ui8 *) malloc_m13((size_t) sess->n_ts_chans * sizeof(ui8));
+	for (n_chans = i = 0; i < sess->n_ts_chans; ++i) {
+		chan = sess->ts_chans[i];
+		saved_chan_flags[i] = chan->flags & LH_CHAN_ACTIVE_m13;
+		if (chan_names) {
+			chan->flags &= ~LH_CHAN_ACTIVE_m13;
+			for (j = 0; j < n_chan_names; ++j) {
+				if (strcmp(chan->name, chan_names[j]) == 0) {
+					chan->flags |= LH_CHAN_ACTIVE_m13;
+					break;
+				}
+			}
+		}
+		if (chan->flags & LH_CHAN_ACTIVE_m13)
+			++n_chans;
+	}
+	if (chan_names)
+		G_rates_vary_m13(sess);  // active set changed
+	
+	// read
+	epochs = NULL;
+	if (n_chans)
+		epochs = G_read_epochs_m13(sess, windows, n_recs);
+	free_m13(windows);
+	if (epochs == NULL) {
+		if (n_chans == 0)
+			G_set_error_m13(E_GEN_m13, "no matching channels");
+		dme = NULL;
+		goto DM_GET_EPOCHS_RETURN_m13;
+	}
+	
+	// output geometry
+	dme = (DM_EPOCHS_m13 *) calloc_m13((size_t) 1, sizeof(DM_EPOCHS_m13));
+	dme->epoch_count = n_recs;
+	dme->channel_count = n_chans;
+	dme->pre_time = pre_time;
+	dme->post_time = post_time;
+	dme->chans = epochs->chans;
+	epochs->chans = NULL;  // ownership to dme
+	win_secs = (sf8) ((pre_time + post_time) + 1) / (sf8) 1.0e6;
+	dme->flags = (params) ? params->flags : DM_TYPE_SI4_m13;
+	if ((dme->flags & DM_TYPE_MASK_m13) == 0)
+		dme->flags |= DM_TYPE_SI4_m13;
+	if ((dme->flags & DM_EXTMD_SAMP_COUNT_m13) && params->sample_count > 0) {
+		dme->sample_count = params->sample_count;
+		dme->sampling_frequency = (sf8) dme->sample_count / win_secs;
+	} else {
+		if ((dme->flags & DM_EXTMD_SAMP_FREQ_m13) && params->sampling_frequency > (sf8) 0.0)
+			dme->sampling_frequency = params->sampling_frequency;
+		else
+			dme->sampling_frequency = pg->active_channels.maximum_sampling_frequency;
+		dme->sample_count = (si8) round(dme->sampling_frequency * win_secs);
+	}
+	if (params) {
+		dme->scale_factor = params->scale_factor;
+		dme->filter_low_fc = params->filter_low_fc;
+		dme->filter_high_fc = params->filter_high_fc;
+	}
+	if (dme->scale_factor == (sf8) 0.0)
+		dme->scale_factor = (sf8) 1.0;
+	if ((dme->flags & DM_FILT_MASK_m13) == DM_FILT_ANTIALIAS_m13)
+		dme->filter_high_fc = dme->sampling_frequency / FILT_ANTIALIAS_FREQ_DIVISOR_DEFAULT_m13;
+	switch (dme->flags & DM_TYPE_MASK_m13) {
+		case DM_TYPE_SI2_m13:
+			dme->el_size = sizeof(si2);
+			break;
+		case DM_TYPE_SI4_m13:
+		case DM_TYPE_SF4_m13:
+			dme->el_size = 4;
+			break;
+		case DM_TYPE_SF8_m13:
+			dme->el_size = sizeof(sf8);
+			break;
+	}
+	n_rows = n_recs * (si8) n_chans;
+	dme->data = calloc_m13((size_t) (n_rows * dme->sample_count), (si8) dme->el_size);
+	dme->valid_sample_counts = (si8 *) calloc_m13((size_t) n_rows, sizeof(si8));
+	dme->epoch_times = (si8 *) malloc_m13((size_t) n_recs * sizeof(si8));
+	dme->record_type_codes = (ui4 *) malloc_m13((size_t) n_recs * sizeof(ui4));
+	for (k = 0; k < n_recs; ++k) {
+		dme->epoch_times[k] = recs[k].start_time;
+		dme->record_type_codes[k] = recs[k].type_code;
+	}
+	
+	// process epochs: one job per channel
+	jobs = (PROC_JOB_m13 *) calloc((size_t) n_chans, sizeof(PROC_JOB_m13));
+	tis = (DM_EPOCHS_THREAD_INFO_m13 *) calloc((size_t) n_chans, sizeof(DM_EPOCHS_THREAD_INFO_m13));
+	if (jobs == NULL || tis == NULL) {
+		G_set_error_m13(E_ALLOC_m13, NULL);
+		free(jobs);
+		free(tis);
+		DM_free_epochs_m13(&dme);
+		goto DM_GET_EPOCHS_RETURN_m13;
+	}
+	seg_idx = G_first_open_segment_m13(sess);
+	for (i = 0; i < n_chans; ++i) {
+		samp_freq = pg->active_channels.maximum_sampling_frequency;  // if no open segment
+		if (seg_idx != FALSE_m13) {
+			seg = dme->chans[i]->segs[seg_idx];
+			if (seg && seg->metadata_fps)
+				samp_freq = seg->metadata_fps->metadata->time_series_section_2.sampling_frequency;
+		}
+		tis[i].dme = dme;
+		tis[i].epochs = epochs;
+		tis[i].samp_freq = samp_freq;
+		tis[i].chan_idx = i;
+		jobs[i].name = "DM_epochs_thread_m13";
+		jobs[i].function = DM_epochs_thread_m13;
+		jobs[i].function_arg = (void *) (tis + i);
+		jobs[i].priority = PROC_HIGH_PRIORITY_m13;
+		jobs[i].skip = FALSE_m13;
+	}
+	threading = (n_chans == 1) ? FALSE_m13 : PROC_default_threading_m13(sess);
+	r_val = PROC_jobs_distribute_m13(jobs, n_chans, 0, PROC_JOBS_PER_CORE_DEFAULT_m13, threading, TRUE_m13);  // waits for all: a failed launch mustn't free tis under running jobs
+	free(jobs);
+	free(tis);
+	if (r_val == FALSE_m13) {
+		G_set_error_m13(E_GEN_m13, "epochs thread error");
+		DM_free_epochs_m13(&dme);
+	}
+
+DM_GET_EPOCHS_RETURN_m13:
+	
+	// restore channel selection
+	if (chan_names) {
+		for (i = 0; i < sess->n_ts_chans; ++i) {
+			chan = sess->ts_chans[i];
+			chan->flags = (chan->flags & ~LH_CHAN_ACTIVE_m13) | saved_chan_flags[i];
+		}
+		G_rates_vary_m13(sess);
+	}
+	if (saved_chan_flags)
+		free_m13(saved_chan_flags);
+	free_m13(recs);
+	G_free_epochs_m13(&epochs);
+
+	return_m13(dme);
+}
+
+
+static tern	DM_overview_ranges_m13(CHAN_m13 *chan, si8 n_raw_samps, si8 n_out, sf8 *out_buf, sf8 *out_mins, sf8 *out_maxs)
+{
+	si4		i, seg_end, lev_idx, *mins, *maxs;
+	si8		k, o, r0, r1, pe, cum, n_s, rel0, b0, b1, bs, n_bins, n_ovw_samps, c;
+	sf8		w, sum, wt, b_min, b_max;
+	sf4		*means;
+	SEG_m13		*seg;
+	OVW_m13		*ovw;
+	OVW_LEVEL_m13	*lev;
+
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// fills the n_out trace ranges (& data values: the sample-weighted bin means) of a channel's current slice from its segment overviews
+	// returns FALSE_m13, having written nothing, if any segment in the slice lacks a current overview
+	// output bin o covers raw samples [o * w, (o + 1) * w), w = n_raw_samps / n_out, taken from the coarsest level whose bins are at most w / 2
+	// samples: the overview bins starting in an output bin make up its envelope, so an envelope edge is off by less than one overview bin
+	
+	seg_end = (chan->slice.start_seg_num - 1) + chan->slice.n_segs;
+	for (i = chan->slice.start_seg_num - 1; i < seg_end; ++i)
+		if (G_read_overview_m13(chan->segs[i]) == NULL)
+			return_m13(FALSE_m13);
+	
+	w = (sf8) n_raw_samps / (sf8) n_out;
+	i = chan->slice.start_seg_num - 2;
+	cum = n_s = rel0 = bs = n_bins = n_ovw_samps = 0;
+	mins = maxs = NULL;
+	means = NULL;
+	for (o = 0; o < n_out; ++o) {
+		r0 = (si8) ((sf8) o * w);
+		r1 = (o == n_out - 1) ? n_raw_samps : (si8) ((sf8) (o + 1) * w);
+		b_min = b_max = sum = wt = (sf8) 0.0;
+		while (r0 < r1) {
+			while (r0 >= cum + n_s) {  // next segment
+				if (++i == seg_end)
+					return_m13(FALSE_m13);
+				cum += n_s;
+				seg = chan->segs[i];
+				ovw = seg->overview;
+				n_s = SLICE_IDX_COUNT_S_m13(seg->slice);
+				rel0 = seg->slice.start_samp_num - seg->metadata_fps->metadata->time_series_section_2.session_start_sample_number;
+				for (lev_idx = ovw->header->n_levels - 1; lev_idx > 0; --lev_idx)
+					if ((sf8) (ovw->levels[lev_idx].bin_samples << 1) <= w)
+						break;
+				lev = ovw->levels + lev_idx;
+				bs = lev->bin_samples;
+				n_bins = lev->n_bins;
+				n_ovw_samps = ovw->header->number_of_samples;
+				mins = (si4 *) (ovw->data + lev->offset);
+				maxs = mins + n_bins;
+				means = (sf4 *) (maxs + n_bins);
+			}
+			pe = (r1 < cum + n_s) ? r1 : cum + n_s;
+			b0 = ((rel0 + (r0 - cum)) + (bs - 1)) / bs;
+			b1 = ((rel0 + (pe - cum)) - 1) / bs;
+			if (b0 > b1)  // piece too short to hold a bin start (segment edge): use the bin it is in
+				b0 = b1 = (rel0 + (r0 - cum)) / bs;
+			for (k = b0; k <= b1; ++k) {
+				if (wt == (sf8) 0.0) {
+					b_min = (sf8) mins[k];
+					b_max = (sf8) maxs[k];
+				} else {
+					if ((sf8) mins[k] < b_min)
+						b_min = (sf8) mins[k];
+					if ((sf8) maxs[k] > b_max)
+						b_max = (sf8) maxs[k];
+				}
+				c = (k == n_bins - 1) ? n_ovw_samps - (k * bs) : bs;
+				sum += (sf8) means[k] * (sf8) c;
+				wt += (sf8) c;
+			}
+			r0 = pe;
+		}
+		out_buf[o] = sum / wt;
+		out_mins[o] = b_min;
+		out_maxs[o] = b_max;
+	}
+
+	return_m13(TRUE_m13);
+}
+
+
 DATA_MATRIX_m13	*DM_get_matrix_m13(DATA_MATRIX_m13 *matrix, SESS_m13 *sess, SLICE_m13 *slice, si4 varargs, ...)  // varargs: si8 out_samp_count, sf8 out_sf, ui8 flags, sf8 scale, sf8 fc1, sf8 fc2
 {
-	tern				changed_to_absolute_time, padding_required, r_val, threading;
+	tern				changed_to_absolute_time, padding_required, r_val, threading, defer_decode;
 	ui1				*data_base, *minima_base, *maxima_base;
 	si2				si2_pad;
 	si4				search_mode, seg_idx, si4_pad;
@@ -33581,12 +39035,44 @@ DATA_MATRIX_m13	*DM_get_matrix_m13(DATA_MATRIX_m13 *matrix, SESS_m13 *sess, SLIC
 	// DM does not use ephemeral data (channel SF comes straight from the segment): clear the generate-ephemeral
 	// flag for our own read so we don't rebuild the (slice-independent) summary; restore only if the caller set it.
 	// G_propagate_flags_m13() reaches session + channels + segments (the segment flag is what drives the build).
+	// A plain copy (output samples == input samples, no per-sample processing) defers decoding to the channel threads, which
+	// decode straight into the matrix (G_decode_time_series_data_m13()). Only non-caching CPSs defer; a misprediction (e.g. a
+	// channel at another rate) decodes into the CPS in the thread as before.
+	defer_decode = FALSE_m13;
+	if ((matrix->flags & (DM_FILT_MASK_m13 | DM_TRACE_RANGES_m13 | DM_TRACE_EXTREMA_m13 | DM_DETREND_m13)) == 0) {
+		if ((matrix->flags & DM_SCALE_m13) == 0 || matrix->scale_factor == (sf8) 1.0 || matrix->scale_factor == (sf8) 0.0) {
+			switch (matrix->flags & DM_EXTMD_MASK_m13) {
+				case DM_EXTMD_SAMP_FREQ_m13:
+					if (matrix->sampling_frequency == ref_samp_freq)
+						defer_decode = TRUE_m13;
+					break;
+				case DM_EXTMD_SAMP_COUNT_m13:
+					if (search_mode == INDEX_SEARCH_m13 && matrix->sample_count == req_num_samps)
+						defer_decode = TRUE_m13;
+					break;
+			}
+		}
+	}
+	// Unfiltered trace ranges at a strong decimation can come from segment overviews (DM_overview_ranges_m13()) => nothing to decode
+	// unless a segment has no current overview, in which case its channel thread decodes the deferred blocks.
+	if (globals_m13->miscellaneous.segment_overviews == TRUE_m13 && (matrix->flags & DM_TRACE_RANGES_m13) && (matrix->flags & DM_FILT_MASK_m13) == 0) {
+		switch (matrix->flags & DM_EXTMD_MASK_m13) {
+			case DM_EXTMD_SAMP_FREQ_m13:
+				if (matrix->sampling_frequency > (sf8) 0.0 && ref_samp_freq / matrix->sampling_frequency >= OVW_MIN_DECIMATION_m13)
+					defer_decode = TRUE_m13;
+				break;
+			case DM_EXTMD_SAMP_COUNT_m13:
+				if (matrix->sample_count > 0 && ((ref_samp_freq * (sf8) SLICE_DUR_m13(req_slice)) / (sf8) 1000000.0) / (sf8) matrix->sample_count >= OVW_MIN_DECIMATION_m13)
+					defer_decode = TRUE_m13;
+				break;
+		}
+	}
 	saved_eph_flag = sess->flags & LH_GENERATE_EPHEMERAL_DATA_m13;
-	if (saved_eph_flag)
-		G_propagate_flags_m13(sess, sess->flags & ~LH_GENERATE_EPHEMERAL_DATA_m13);
+	if (saved_eph_flag || defer_decode == TRUE_m13)
+		G_propagate_flags_m13(sess, (sess->flags & ~LH_GENERATE_EPHEMERAL_DATA_m13) | ((defer_decode == TRUE_m13) ? LH_DEFER_TS_DECODE_m13 : 0));
 	tmp_si8 = (G_read_session_m13(sess, req_slice) == NULL) ? 0 : 1;
-	if (saved_eph_flag)
-		G_propagate_flags_m13(sess, sess->flags | LH_GENERATE_EPHEMERAL_DATA_m13);
+	if (saved_eph_flag || defer_decode == TRUE_m13)
+		G_propagate_flags_m13(sess, (sess->flags & ~LH_DEFER_TS_DECODE_m13) | saved_eph_flag);
 	if (tmp_si8 == 0)
 		return_m13(NULL);
 	sess_slice = &sess->slice;  // filled in with actual values
@@ -38072,6 +43558,8 @@ FPS_m13	*FPS_clone_m13(FPS_m13 *proto_fps, const si1 *path, si8 n_bytes, si8 cop
 	params->mmap_blocks_read = 0;
 	params->mmap_block_bytes = 0;
 	params->mmap_block_bitmap = NULL;
+	params->mmap_os = FALSE_m13;  // the clone gets its own heap buffer below; the prototype's mapping stays the prototype's
+	params->mmap_file_bytes = params->mmap_map_offset = 0;
 	fps->direcs.flags &= ~FPS_DF_MMAP_m13;
 	fps->path = fps->params.fp->path;
 	fps->name = fps->local_name;
@@ -38224,6 +43712,7 @@ tern	FPS_close_m13(FPS_m13 *fps)
 	si8		T;
 	ui8		saved_direcs;
 	FILE_TIMES_m13	ft;
+	PROC_GLOBS_m13	*pg;
 
 	if (fps == NULL)
 		return_m13(UNKNOWN_m13);
@@ -38257,6 +43746,14 @@ tern	FPS_close_m13(FPS_m13 *fps)
 		memset((void *) &ft, 0, sizeof(ft));
 		ft.modification = T;  // access left zero => preserved
 		G_file_times_m13(NULL, fps->path, &ft, TRUE_m13);
+		
+		// a loaded session manifest no longer matches: have it rebuilt when the session closes
+		if (globals_m13->miscellaneous.session_manifest == TRUE_m13) {
+			pg = G_proc_globs_find_m13(fps);
+			if (pg)
+				if (pg->current_session.manifest)
+					pg->current_session.manifest->stale = TRUE_m13;
+		}
 	}
 
 	if (globals_m13->miscellaneous.access_times == TRUE_m13)
@@ -38375,8 +43872,7 @@ tern	FPS_free_m13(void *ptr)
 		if (fps->params.cps)
 			CMP_free_CPS_m13(fps->params.cps, TRUE_m13);
 	
-	if (fps->params.raw_data)
-		free_m13(fps->params.raw_data);
+	FPS_free_raw_data_m13(&fps->params);
 
 	// delete process globals
 	if (fps->proc_globs)
@@ -38398,6 +43894,30 @@ tern	FPS_free_m13(void *ptr)
 }
 
 
+static void	FPS_free_raw_data_m13(FPS_PARAMS_m13 *params)
+{
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// raw_data is a heap buffer, or (mmap_os) an OS mapping of the file - each has its own release
+	if (params->raw_data) {
+	#ifdef LINUX_m13
+		if (params->mmap_os == TRUE_m13)
+			munmap((void *) params->raw_data, (size_t) params->raw_data_bytes);
+		else
+	#endif
+			free_m13(params->raw_data);
+	}
+	params->raw_data = NULL;
+	params->raw_data_bytes = 0;
+	params->mmap_os = FALSE_m13;
+	params->mmap_file_bytes = params->mmap_map_offset = 0;
+
+	return_void_m13;
+}
+
+
 si8	FPS_header_offset_m13(FPS_m13 *fps, const si1 *path)
 {
 	si8	offset;
@@ -38607,11 +44127,7 @@ FPS_PARAMS_m13	*FPS_init_params_m13(FPS_PARAMS_m13 *params)
 
 	if (params) {
 		// set zero default parameters
-		if (params->raw_data) {
-			free_m13(params->raw_data);
-			params->raw_data = NULL;
-		}
-		params->raw_data_bytes = 0;
+		FPS_free_raw_data_m13(params);
 		*params->mode_str = 0;
 		if (params->cps)
 			CMP_free_CPS_m13(params->cps, TRUE_m13);
@@ -38834,6 +44350,8 @@ tern	FPS_mmap_m13(FPS_m13 *fps, tern set)
 			free_m13(fps->params.mmap_block_bitmap);
 			fps->params.mmap_block_bitmap = NULL;
 		}
+		if (fps->params.mmap_os == TRUE_m13)  // OS mapping => heap copy (callers may hold the header or decrypted data)
+			FPS_munmap_os_m13(fps);
 		fps->params.mmap_n_blocks = 0;
 		fps->params.mmap_block_bytes = 0;
 		fps->direcs.flags &= ~FPS_DF_MMAP_m13;
@@ -38843,6 +44361,141 @@ tern	FPS_mmap_m13(FPS_m13 *fps, tern set)
 }
 
 
+// Map the file with mmap(2): raw_data, uh & data_ptrs then point into the page cache & reads copy nothing.
+// Used in place of the emulated (bitmap) mapping when the platform & open mode allow it; returns FALSE_m13
+// otherwise, & the caller falls back to the emulation.
+//
+// The layout is file-absolute (raw_data + file offset), so an anonymous reservation spans the whole file, but
+// only the header page & the pages from offset's page to the end of the file are mapped from it: reading a
+// late region of a large file does not map its prefix.  Reads below the mapped window (FPS_mmap_read_m13())
+// call here again to map the pages between; only reserved, never touched pages are replaced (if they can't be
+// mapped they are read into the reservation instead, & join the window all the same).  The reservation
+// also covers CMP_DECODE_SLACK_BYTES_m13, so the word-walk decoders can read past the last data byte as they
+// do with heap buffers.
+//
+// The mapping is MAP_PRIVATE & writable.  Nothing is written back to the file: pages the library modifies
+// in place - decrypted blocks & records, a corrected universal header - become private copy-on-write
+// copies, so decryption lands in private scratch pages while unencrypted data is never copied at all.
+//
+// Only read-only opens of files not being written are mapped: writers need a buffer they own & can grow, a
+// mapping can't follow a live file's growth (& a writer truncating the file would fault readers with SIGBUS).
+// The mapping describes the file as it was when mapped (mmap_file_bytes): it is never replaced, as pages
+// decrypted in place must not come back as ciphertext.
+static tern	FPS_mmap_os_m13(FPS_m13 *fps, si8 offset)
+{
+#ifdef LINUX_m13
+	ui1			*base, uh[UH_BYTES_m13];
+	tern			keep_uh, live;
+	ssize_t			n_read;
+	si8			len, page_bytes, map_bytes, map_offset, done;
+	CPS_m13			*cps;
+	FPS_PARAMS_m13		*params;
+	FILE_m13		*fp;
+#endif
+
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+#ifdef LINUX_m13
+	params = &fps->params;
+	fp = params->fp;
+	if (fisopen_m13(fp) == FALSE_m13)
+		return_m13(FALSE_m13);
+	if (fp->flags & (FILE_FLAGS_WRITE_m13 | FILE_FLAGS_APPEND_m13))
+		return_m13(FALSE_m13);
+
+	page_bytes = (si8) sysconf(_SC_PAGE_SIZE);
+	if (page_bytes <= 0)
+		return_m13(FALSE_m13);
+	if (offset < 0)
+		offset = 0;
+	map_offset = (offset / page_bytes) * page_bytes;
+	if (map_offset <= page_bytes)
+		map_offset = 0;  // range adjoins the header page: map it all
+
+	if (params->mmap_os == TRUE_m13) {
+		if (map_offset >= params->mmap_map_offset)
+			return_m13(TRUE_m13);  // already mapped
+		// extend the window down to map_offset (the header page is already mapped): only reserved pages lie below the window
+		if (map_offset == 0)
+			map_offset = page_bytes;
+		if (mmap((void *) (params->raw_data + map_offset), (size_t) (params->mmap_map_offset - map_offset), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fp->fd, (off_t) map_offset) == MAP_FAILED) {
+			// read the pages into the reservation instead (they join the window, so no later extension maps over them)
+			// (a failed MAP_FIXED may have unmapped the range: reserve it again first)
+			if (mmap((void *) (params->raw_data + map_offset), (size_t) (params->mmap_map_offset - map_offset), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0) == MAP_FAILED)
+				return_m13(FALSE_m13);
+			for (done = 0; done < params->mmap_map_offset - map_offset; done += (si8) n_read) {
+				n_read = pread(fp->fd, (void *) (params->raw_data + map_offset + done), (size_t) (params->mmap_map_offset - map_offset - done), (off_t) (map_offset + done));
+				if (n_read <= 0)
+					return_m13(FALSE_m13);
+			}
+		}
+		params->mmap_map_offset = (map_offset == page_bytes) ? 0 : map_offset;
+		return_m13(TRUE_m13);
+	}
+
+	// not while the file is being written (universal header live flag, read from the file: a header already read may be older)
+	if (pread(fp->fd, (void *) &live, (size_t) 1, (off_t) UH_LIVE_OFFSET_m13) != 1 || live == TRUE_m13)
+		return_m13(FALSE_m13);
+	len = flen_m13(fp);
+	if (len < UH_BYTES_m13)
+		return_m13(FALSE_m13);
+	if (map_offset >= len)
+		map_offset = ((len - 1) / page_bytes) * page_bytes;
+
+	map_bytes = ((len + CMP_DECODE_SLACK_BYTES_m13 + page_bytes - 1) / page_bytes) * page_bytes;
+	base = (ui1 *) mmap(NULL, (size_t) map_bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (base == (ui1 *) MAP_FAILED)
+		return_m13(FALSE_m13);
+	if (map_offset) {
+		if (mmap((void *) base, (size_t) page_bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fp->fd, 0) == MAP_FAILED ||
+		    mmap((void *) (base + map_offset), (size_t) (len - map_offset), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fp->fd, (off_t) map_offset) == MAP_FAILED) {
+			munmap((void *) base, (size_t) map_bytes);
+			return_m13(FALSE_m13);
+		}
+	} else if (mmap((void *) base, (size_t) len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fp->fd, 0) == MAP_FAILED) {
+		munmap((void *) base, (size_t) map_bytes);
+		return_m13(FALSE_m13);
+	}
+
+	// a header already read (heap buffer or previous mapping) may have been corrected (live files): keep it
+	keep_uh = (params->raw_data != NULL && params->header_read == TRUE_m13) ? TRUE_m13 : FALSE_m13;
+	if (keep_uh == TRUE_m13)
+		memcpy((void *) uh, (void *) params->raw_data, (size_t) UH_BYTES_m13);
+	FPS_free_raw_data_m13(params);
+	if (keep_uh == TRUE_m13)
+		memcpy((void *) base, (void *) uh, (size_t) UH_BYTES_m13);
+	params->raw_data = base;
+	params->raw_data_bytes = map_bytes;
+	params->mmap_os = TRUE_m13;
+	params->mmap_file_bytes = len;
+	params->mmap_map_offset = map_offset;
+
+	// the emulation is not needed
+	if (params->mmap_block_bitmap) {
+		free_m13(params->mmap_block_bitmap);
+		params->mmap_block_bitmap = NULL;
+	}
+	params->mmap_n_blocks = params->mmap_blocks_read = 0;
+
+	fps->uh = (UH_m13 *) base;
+	fps->data_ptrs = base + UH_BYTES_m13;
+	if (fps->type_code == TS_DATA_TYPE_CODE_m13) {
+		cps = params->cps;
+		if (cps) {
+			cps->params.allocated_compressed_bytes = params->raw_data_bytes - UH_BYTES_m13;
+			cps->block_header = (CMP_FIXED_BH_m13 *) fps->data_ptrs;
+		}
+	}
+
+	return_m13(TRUE_m13);
+#else
+	return_m13(FALSE_m13);
+#endif
+}
+
+
 si8	FPS_mmap_read_m13(FPS_m13 *fps, si8 n_bytes)
 {
 	ui1			mode;
@@ -38884,6 +44537,19 @@ si8	FPS_mmap_read_m13(FPS_m13 *fps, si8 n_bytes)
 	if (n_bytes > remaining_bytes)
 		n_bytes = remaining_bytes;
 
+	// OS mapping: the bytes are at raw_data + offset (paged in on first touch) once the window covers them
+	// (the file as mapped: bytes appended since are not part of it - see FPS_mmap_os_m13())
+	if (params->mmap_os == TRUE_m13) {
+		if (n_bytes > params->mmap_file_bytes - offset)
+			n_bytes = params->mmap_file_bytes - offset;
+		if (n_bytes <= 0)
+			return_m13(0);
+		if (offset < params->mmap_map_offset && offset + n_bytes > (si8) sysconf(_SC_PAGE_SIZE))
+			if (FPS_mmap_os_m13(fps, offset) == FALSE_m13)
+				return_m13(0);
+		return_m13(n_bytes);
+	}
+
 	// lazy allocation: the bitmap is built on first use, not at open.  If mmap is requested (flag set)
 	// but no bitmap exists yet, build it now - BEFORE reading block_bytes below, since the allocator sets
 	// params->mmap_block_bytes.  (FPS_mmap_alloc_m13 clears the flag if it cannot allocate.)
@@ -38969,6 +44635,54 @@ si8	FPS_mmap_read_m13(FPS_m13 *fps, si8 n_bytes)
 }
 
 
+// Replace an OS mapping (FPS_mmap_os_m13()) with a heap buffer holding the same bytes, so the FPS can be
+// grown, written, or switched to ordinary reads.  Layout stays file-absolute only if the caller keeps
+// full_file_read or the emulated mapping; FPS_set_pointers_m13() is the authority on that.
+static tern	FPS_munmap_os_m13(FPS_m13 *fps)
+{
+	ui1			*raw_data;
+	si8			raw_data_bytes, map_offset, page_bytes;
+	CPS_m13			*cps;
+	FPS_PARAMS_m13		*params;
+
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	params = &fps->params;
+	if (params->mmap_os != TRUE_m13)
+		return_m13(TRUE_m13);
+
+	raw_data_bytes = params->raw_data_bytes;
+	raw_data = (ui1 *) calloc_m13((size_t) raw_data_bytes, -sizeof(ui1));  // flag as level header
+	if (raw_data == NULL)
+		return_m13(FALSE_m13);
+	// copy the mapped pages only: reserved pages were never read (they stay zero, as unread blocks do in the emulation)
+	if ((map_offset = params->mmap_map_offset)) {
+		page_bytes = (si8) sysconf(_SC_PAGE_SIZE);
+		memcpy((void *) raw_data, (void *) params->raw_data, (size_t) page_bytes);
+	}
+	memcpy((void *) (raw_data + map_offset), (void *) (params->raw_data + map_offset), (size_t) (params->mmap_file_bytes - map_offset));
+	FPS_free_raw_data_m13(params);  // unmaps, clears mmap_os
+
+	params->raw_data = raw_data;
+	params->raw_data_bytes = malloc_size_m13(raw_data);
+	if (params->raw_data_bytes == 0)  // size query unavailable (e.g. MATLAB persistent allocation): use the requested size
+		params->raw_data_bytes = raw_data_bytes;
+	fps->uh = (UH_m13 *) raw_data;
+	fps->data_ptrs = raw_data + UH_BYTES_m13;
+	if (fps->type_code == TS_DATA_TYPE_CODE_m13) {
+		cps = params->cps;
+		if (cps) {
+			cps->params.allocated_compressed_bytes = params->raw_data_bytes - UH_BYTES_m13;
+			cps->block_header = (CMP_FIXED_BH_m13 *) fps->data_ptrs;
+		}
+	}
+
+	return_m13(TRUE_m13);
+}
+
+
 FPS_m13	*FPS_open_m13(const si1 *path, const si1 *mode_str, si8 n_bytes, void *parent, ...)  // vararg(mode_str empty): ui8 fd_flags
 {
 	si1			tmp_dir[PATH_BYTES_m13], tmp_name[MAX_NAME_BYTES_m13], tmp_ext[TYPE_BYTES_m13];
@@ -39062,6 +44776,76 @@ FPS_m13	*FPS_open_m13(const si1 *path, const si1 *mode_str, si8 n_bytes, void *p
 }
 
 
+tern	FPS_read_ahead_m13(FPS_m13 *fps, si8 offset, si8 n_bytes)
+{
+	si8		len;
+	FILE_m13	*fp;
+#ifdef LINUX_m13
+	si8		page_bytes, page_offset;
+#endif
+#ifdef MACOS_m13
+	struct radvisory	ra;
+#endif
+	
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// Ask the kernel to start reading a byte range of the file (offset is a file offset) into the page cache,
+	// & return without waiting: a later FPS_read_m13() of the range then copies from memory.  With an OS
+	// mapping (mmap_os) the mapped pages are advised instead.  Returns FALSE_m13 if no hint could be issued
+	// (file closed, or no advisory interface on this platform); that is never an error - reads still work.
+
+	if (fps == NULL || n_bytes <= 0 || offset < 0)
+		return_m13(FALSE_m13);
+	fp = fps->params.fp;
+
+#ifdef LINUX_m13
+	if (fps->params.mmap_os == TRUE_m13) {
+		len = fps->params.mmap_file_bytes;
+		if (offset >= len)
+			return_m13(FALSE_m13);
+		if (offset < fps->params.mmap_map_offset)  // map the range's pages first: advice on reserved pages reads nothing
+			if (FPS_mmap_os_m13(fps, offset) == FALSE_m13)
+				return_m13(FALSE_m13);
+		if (offset + n_bytes > len)
+			n_bytes = len - offset;
+		page_bytes = (si8) sysconf(_SC_PAGE_SIZE);
+		if (page_bytes <= 0)
+			return_m13(FALSE_m13);
+		page_offset = offset % page_bytes;  // madvise() requires a page-aligned address
+		if (madvise((void *) (fps->params.raw_data + (offset - page_offset)), (size_t) (n_bytes + page_offset), MADV_WILLNEED))
+			return_m13(FALSE_m13);
+		return_m13(TRUE_m13);
+	}
+#endif
+
+	if (fisopen_m13(fp) == FALSE_m13)
+		return_m13(FALSE_m13);
+	len = flen_m13(fp);
+	if (offset >= len)
+		return_m13(FALSE_m13);
+	if (offset + n_bytes > len)
+		n_bytes = len - offset;
+
+#ifdef LINUX_m13
+	if (posix_fadvise(fp->fd, (off_t) offset, (off_t) n_bytes, POSIX_FADV_WILLNEED))
+		return_m13(FALSE_m13);
+	return_m13(TRUE_m13);
+#endif
+#ifdef MACOS_m13
+	ra.ra_offset = (off_t) offset;
+	ra.ra_count = (n_bytes > (si8) 0x7FFFFFFF) ? (si4) 0x7FFFFFFF : (si4) n_bytes;
+	if (fcntl(fp->fd, F_RDADVISE, &ra) == -1)
+		return_m13(FALSE_m13);
+	return_m13(TRUE_m13);
+#endif
+#ifdef WINDOWS_m13
+	return_m13(FALSE_m13);  // no advisory read-ahead interface; reads are unaffected
+#endif
+}
+
+
 FPS_m13	*FPS_read_m13(FPS_m13 *fps, si8 offset, si8 n_bytes, si8 n_items, ...)  // varargs(fps invalid): si1 *path, si1 *mode_str, si1 *password, void *parent, ui8 lh_flags
 										// varargs(offset == FPS_REL_START/CURR/END): si8 rel_bytes
 {										// if both vararg modes set, rel_bytes is last argument
@@ -39071,7 +44855,8 @@ FPS_m13	*FPS_read_m13(FPS_m13 *fps, si8 offset, si8 n_bytes, si8 n_items, ...)
 	si1			*path, *mode_str, *password;
 	ui4			type_code;
 	ui8			lh_flags;
-	si8			len, rel_bytes, mem_bytes, header_offset, bytes_read, bytes_to_read, tmp_bytes;
+	ui1			*image;
+	si8			len, rel_bytes, mem_bytes, header_offset, bytes_read, bytes_to_read, tmp_bytes, image_len;
 	LH_m13			*parent;
 	FPS_m13			*tmp_fps;
 	PASSWORD_DATA_m13	*pwd;
@@ -39109,6 +44894,8 @@ FPS_m13	*FPS_read_m13(FPS_m13 *fps, si8 offset, si8 n_bytes, si8 n_items, ...)
 	// get varargs
 	path = password = mode_str = NULL;
 	parent = NULL;
+	image = NULL;
+	image_len = 0;
 	rel_offset = FPS_REL_OFFSET_m13(offset);
 	rel_bytes = (si8) 0;
 	lh_flags = (ui8) 0;
@@ -39154,9 +44941,25 @@ FPS_m13	*FPS_read_m13(FPS_m13 *fps, si8 offset, si8 n_bytes, si8 n_items, ...)
 				return_m13(NULL);
 			}
 		} else {
-			fps = FPS_open_m13(path, mode_str, FPS_NO_ALLOC_m13, parent);  // don't allocate here since will be done below
-			if (fps == NULL)
-				return_m13(NULL);
+			// full read-only reads of files imaged in a session manifest are served from the image (no file system open)
+			image = NULL;
+			if (globals_m13->miscellaneous.session_manifest == TRUE_m13 && parent && *mode_str == 'r' && mode_str[1] == 0) {
+				if (offset == FPS_FULL_FILE_m13 || n_bytes == FPS_FULL_FILE_m13) {
+					pg = G_proc_globs_find_m13(parent);
+					if (pg)
+						image = G_session_manifest_image_m13(pg->current_session.manifest, path, &image_len);
+				}
+			}
+			if (image) {
+				fps = FPS_init_m13(NULL, path, mode_str, FPS_NO_ALLOC_m13, parent);
+				if (fps == NULL)
+					return_m13(NULL);
+				fps->params.fp->len = image_len;
+			} else {
+				fps = FPS_open_m13(path, mode_str, FPS_NO_ALLOC_m13, parent);  // don't allocate here since will be done below
+				if (fps == NULL)
+					return_m13(NULL);
+			}
 		}
 		read_header = TRUE_m13;
 	} else if (!(fps->params.fp->flags & FILE_FLAGS_READ_m13)) {  // no read flag - add
@@ -39178,6 +44981,8 @@ FPS_m13	*FPS_read_m13(FPS_m13 *fps, si8 offset, si8 n_bytes, si8 n_items, ...)
 			full_file = TRUE_m13;
 
 	}
+	if (image)  // nothing to map
+		fps->direcs.flags &= ~((ui8) FPS_DF_MMAP_m13);
 	if (fps->direcs.flags & FPS_DF_MMAP_m13)
 		mem_map = TRUE_m13;
 	if (fps->params.header_read != TRUE_m13)
@@ -39241,17 +45046,23 @@ FPS_m13	*FPS_read_m13(FPS_m13 *fps, si8 offset, si8 n_bytes, si8 n_items, ...)
 		else
 			offset = UH_BYTES_m13;
 		n_bytes = len - UH_BYTES_m13;
-		if (mem_map == TRUE_m13) {  // no benefit to memory mapping in full file read - turn off
-			FPS_mmap_m13(fps, FALSE_m13);
-			mem_map = FALSE_m13;
+		if (mem_map == TRUE_m13) {  // no benefit to emulated memory mapping in full file read - turn off (an OS mapping is the whole file, uncopied)
+			if (FPS_mmap_os_m13(fps, offset) == FALSE_m13) {
+				FPS_mmap_m13(fps, FALSE_m13);
+				mem_map = FALSE_m13;
+			}
 		}
 		if ((fps->params.fp->flags & FILE_FLAGS_WRITE_m13) == 0)
 			fps->direcs.flags |= FPS_DF_CLOSE_AFTER_OP_m13;  // full file reads are closed to keep open file count down, unless write flag also set
 	}
 	
+	// OS memory mapping where possible (Linux read-only opens); otherwise the emulation allocates below
+	if (mem_map == TRUE_m13 && full_file == FALSE_m13)
+		FPS_mmap_os_m13(fps, offset);
+
 	// allocate memory  (FPS_realloc_m13 assumes universal header bytes)
 	mem_bytes = n_bytes + UH_BYTES_m13;
-	if (fps->params.raw_data_bytes < mem_bytes) {
+	if (fps->params.raw_data_bytes < mem_bytes && fps->params.mmap_os != TRUE_m13) {
 		if (mem_map == TRUE_m13)  // allocate full file for mmap, even though read will not be full
 			mem_bytes = len - UH_BYTES_m13;
 		else
@@ -39282,12 +45093,17 @@ FPS_m13	*FPS_read_m13(FPS_m13 *fps, si8 offset, si8 n_bytes, si8 n_items, ...)
 		}
 
 		// read header (& subsequent data if appropriate)
-		if (FPS_seek_m13(fps, header_offset) == FALSE_m13)  // set fp to start of universal header
-			goto FPS_READ_FAIL_m13;
-		if (mem_map == TRUE_m13)
-			bytes_read = FPS_mmap_read_m13(fps, bytes_to_read);
-		else
-			bytes_read = fread_m13(uh, sizeof(ui1), bytes_to_read, fps->params.fp);
+		if (image) {
+			memcpy((void *) uh, (void *) image, (size_t) bytes_to_read);
+			bytes_read = bytes_to_read;
+		} else {
+			if (FPS_seek_m13(fps, header_offset) == FALSE_m13)  // set fp to start of universal header
+				goto FPS_READ_FAIL_m13;
+			if (mem_map == TRUE_m13)
+				bytes_read = FPS_mmap_read_m13(fps, bytes_to_read);
+			else
+				bytes_read = fread_m13(uh, sizeof(ui1), bytes_to_read, fps->params.fp);
+		}
 		if (bytes_read != bytes_to_read)
 			goto FPS_READ_FAIL_m13;
 		
@@ -39341,7 +45157,9 @@ FPS_m13	*FPS_read_m13(FPS_m13 *fps, si8 offset, si8 n_bytes, si8 n_items, ...)
 	FPS_set_pointers_m13(fps, offset);
 
 	// read
-	if (data_read == FALSE_m13) {
+	if (data_read == FALSE_m13 && image) {
+		memcpy((void *) fps->data_ptrs, (void *) (image + offset), (size_t) n_bytes);
+	} else if (data_read == FALSE_m13) {
 		if (FPS_seek_m13(fps, offset) == FALSE_m13)
 			goto FPS_READ_FAIL_m13;
 		if (mem_map == TRUE_m13)
@@ -39383,19 +45201,19 @@ FPS_m13	*FPS_read_m13(FPS_m13 *fps, si8 offset, si8 n_bytes, si8 n_items, ...)
 				break;
 			case TS_INDS_TYPE_CODE_m13:
 				if (full_file == TRUE_m13)
-					CRC_valid = CRC_validate_m13(fps->data_ptrs, len - UH_BYTES_m13, uh->body_CRC);
+					CRC_valid = CRC_validate_parallel_m13(fps->data_ptrs, len - UH_BYTES_m13, uh->body_CRC);
 				break;
 			case REC_DATA_TYPE_CODE_m13:
 				CRC_valid = G_validate_record_data_CRCs_m13(fps);
 				break;
 			case REC_INDS_TYPE_CODE_m13:
 				if (full_file == TRUE_m13)
-					CRC_valid = CRC_validate_m13(fps->data_ptrs, len - UH_BYTES_m13, uh->body_CRC);
+					CRC_valid = CRC_validate_parallel_m13(fps->data_ptrs, len - UH_BYTES_m13, uh->body_CRC);
 				break;
 			case TS_METADATA_TYPE_CODE_m13:
 			case VID_METADATA_TYPE_CODE_m13:
 				if (full_file == TRUE_m13)
-					CRC_valid = CRC_validate_m13(fps->data_ptrs, len - UH_BYTES_m13, uh->body_CRC);
+					CRC_valid = CRC_validate_parallel_m13(fps->data_ptrs, len - UH_BYTES_m13, uh->body_CRC);
 				break;
 		}
 		if (CRC_valid == FALSE_m13)
@@ -39489,6 +45307,10 @@ tern	FPS_realloc_m13(FPS_m13 *fps, si8 n_bytes)
 	if (n_bytes <= fps->params.raw_data_bytes)
 		return_m13(TRUE_m13);
 	
+	if (fps->params.mmap_os == TRUE_m13)  // an OS mapping cannot be grown in place: move it to the heap first
+		if (FPS_munmap_os_m13(fps) == FALSE_m13)
+			return_m13(FALSE_m13);
+
 	if (fps->params.raw_data)
 		raw_data = recalloc_m13(fps->params.raw_data, (size_t) fps->params.raw_data_bytes, (size_t) n_bytes, -sizeof(ui1));  // flag as level header
 	else
@@ -39994,8 +45816,8 @@ tern	FPS_set_pointers_m13(FPS_m13 *fps, si8 offset)
 	// FPS_clone_m13), & keying layout off it hands the caller raw_data + offset into a buffer that was
 	// only ever sized for a slice.  cps->block_header is set from data_ptrs immediately below, so that
 	// pointer propagates.  This distinction is also what makes lazy bitmap allocation safe: with it,
-	// "requested but not yet active" becomes an ordinary state.
-	if (fps->params.full_file_read == TRUE_m13 || fps->params.mmap_block_bitmap != NULL) {
+	// "requested but not yet active" becomes an ordinary state.  An OS mapping (mmap_os) reserves the whole file.
+	if (fps->params.full_file_read == TRUE_m13 || fps->params.mmap_block_bitmap != NULL || fps->params.mmap_os == TRUE_m13) {
 		if (offset > fps->params.raw_data_bytes) {  // file-absolute layout requires the buffer to reach
 			G_set_error_m13(E_GEN_m13, "offset (%ld) exceeds allocated raw data (%ld bytes)", offset, fps->params.raw_data_bytes);
 			return_m13(FALSE_m13);
@@ -40100,6 +45922,11 @@ tern	FPS_show_params_m13(FPS_m13 *fps)
 		printf_m13("MMAP Block Bitmap: allocated  (addr: %lu)\n", (ui8) params->mmap_block_bitmap);
 	else
 		printf_m13("MMAP Block Bitmap: null\n");
+	printf_m13("MMAP OS Mapping: %s\n", STR_tern_m13(params->mmap_os, FALSE_m13));
+	if (params->mmap_os == TRUE_m13) {
+		printf_m13("MMAP File Bytes: %ld\n", params->mmap_file_bytes);
+		printf_m13("MMAP Map Offset: %ld\n", params->mmap_map_offset);
+	}
 	printf_m13("----------------- FPS Parameters - END -----------------\n");
 
 	return_m13(TRUE_m13);
@@ -40803,9 +46630,10 @@ tern	HW_get_crypto_accel_m13(void)
 	G_push_function_m13();
 #endif
 
-	// detects hardware crypto instructions (cheap register/sysctl reads - done once at library launch)
-	// AES_accel: x86 AES-NI / ARMv8 AES; SHA256_accel: x86 SHA extensions / ARMv8 SHA-2
-	// encryption & hash routines read these globals to select hardware vs table implementations
+	// detects hardware crypto & vector instructions (cheap register/sysctl reads - done once at library launch)
+	// AES_accel: x86 AES-NI / ARMv8 AES; SHA256_accel: x86 SHA extensions / ARMv8 SHA-2; SIMD_accel: x86 AVX2 / ARMv8 NEON
+	// CRC32_accel: x86 PCLMULQDQ (with SSE4.1) / ARMv8 PMULL
+	// encryption & hash routines read these globals to select hardware vs table implementations, sample conversion (CMP_si4_to_type_m13()) vector vs scalar
 
 	hw_params = &globals_m13->tables->HW_params;
 
@@ -40818,7 +46646,7 @@ tern	HW_get_crypto_accel_m13(void)
 		return_m13(TRUE_m13);
 	}
 
-	hw_params->AES_accel = hw_params->SHA256_accel = FALSE_m13;
+	hw_params->AES_accel = hw_params->SHA256_accel = hw_params->SIMD_accel = hw_params->CRC32_accel = FALSE_m13;
 
 	// probes are deterministic within a process (register/sysctl/auxv reads - no transient failure modes) => no retries
 	// an inconclusive probe leaves FALSE_m13 (safe software path), & warns once (this function only executes once per process -
@@ -40842,8 +46670,19 @@ tern	HW_get_crypto_accel_m13(void)
 	} else {
 		G_warning_message_m13("%s(): hardware SHA-256 detection inconclusive => using software implementation\n", __FUNCTION__);
 	}
+	len = sizeof(si4); val = 0;
+	if (sysctlbyname("hw.optional.arm.FEAT_PMULL", &val, &len, NULL, 0) == 0) {
+		if (val)
+			hw_params->CRC32_accel = TRUE_m13;
+	} else {
+		G_warning_message_m13("%s(): hardware CRC detection inconclusive => using software implementation\n", __FUNCTION__);
+	}
 #endif  // MACOS_m13 && __aarch64__
 
+#if (defined MACOS_m13 || defined LINUX_m13) && defined __aarch64__
+	hw_params->SIMD_accel = TRUE_m13;  // NEON (Advanced SIMD) is mandatory in ARMv8-A
+#endif  // (MACOS_m13 || LINUX_m13) && __aarch64__
+
 #if defined LINUX_m13 && defined __aarch64__
 	ui8	hwcaps;
 
@@ -40855,30 +46694,46 @@ tern	HW_get_crypto_accel_m13(void)
 			hw_params->AES_accel = TRUE_m13;
 		if (hwcaps & ((ui8) 1 << 6))  // HWCAP_SHA2
 			hw_params->SHA256_accel = TRUE_m13;
+		if (hwcaps & ((ui8) 1 << 4))  // HWCAP_PMULL
+			hw_params->CRC32_accel = TRUE_m13;
 	}
 #endif  // LINUX_m13 && __aarch64__
 
 #if (defined MACOS_m13 || defined LINUX_m13) && (defined __x86_64__ || defined __i386__)  // inline asm works in clang, gcc, & icc
 	ui4	eax, ebx, ecx, edx;
 
+	tern	os_avx;
+
 	__asm__ __volatile__ ("cpuid" : "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx) : "a" (1), "c" (0));
 	if (ecx & ((ui4) 1 << 25))  // CPUID.01H:ECX.AESNI
 		hw_params->AES_accel = TRUE_m13;
+	if ((ecx & (((ui4) 1 << 1) | ((ui4) 1 << 19))) == (((ui4) 1 << 1) | ((ui4) 1 << 19)))  // CPUID.01H:ECX.PCLMULQDQ & SSE4.1
+		hw_params->CRC32_accel = TRUE_m13;
+	os_avx = FALSE_m13;
+	if ((ecx & ((ui4) 3 << 27)) == ((ui4) 3 << 27)) {  // CPUID.01H:ECX.OSXSAVE & AVX => check the OS saves the YMM state
+		__asm__ __volatile__ ("xgetbv" : "=a" (eax), "=d" (edx) : "c" (0));
+		if ((eax & (ui4) 6) == (ui4) 6)  // XCR0.SSE & AVX
+			os_avx = TRUE_m13;
+	}
 	__asm__ __volatile__ ("cpuid" : "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx) : "a" (7), "c" (0));
 	if (ebx & ((ui4) 1 << 29))  // CPUID.07H.0:EBX.SHA
 		hw_params->SHA256_accel = TRUE_m13;
+	if (os_avx == TRUE_m13 && (ebx & ((ui4) 1 << 5)))  // CPUID.07H.0:EBX.AVX2
+		hw_params->SIMD_accel = TRUE_m13;
 #endif  // (MACOS_m13 || LINUX_m13) && (__x86_64__ || __i386__)
 
 #ifdef WINDOWS_m13  // UNVERIFIED
 	#ifdef _M_ARM64
-	if (IsProcessorFeaturePresent(PF_ARM_V8_CRYPTO_INSTRUCTIONS_AVAILABLE))  // covers AES & SHA-2 together
-		hw_params->AES_accel = hw_params->SHA256_accel = TRUE_m13;
+	if (IsProcessorFeaturePresent(PF_ARM_V8_CRYPTO_INSTRUCTIONS_AVAILABLE))  // covers AES, PMULL & SHA-2 together
+		hw_params->AES_accel = hw_params->SHA256_accel = hw_params->CRC32_accel = TRUE_m13;
 	#else
 	si4	regs[4];
 
 	__cpuid(regs, 1);
 	if (regs[2] & ((si4) 1 << 25))  // CPUID.01H:ECX.AESNI
 		hw_params->AES_accel = TRUE_m13;
+	if ((regs[2] & (((si4) 1 << 1) | ((si4) 1 << 19))) == (((si4) 1 << 1) | ((si4) 1 << 19)))  // CPUID.01H:ECX.PCLMULQDQ & SSE4.1
+		hw_params->CRC32_accel = TRUE_m13;
 	__cpuidex(regs, 7, 0);
 	if (regs[1] & ((si4) 1 << 29))  // CPUID.07H.0:EBX.SHA
 		hw_params->SHA256_accel = TRUE_m13;
@@ -41512,6 +47367,8 @@ tern	HW_show_info_m13(void)
 
 	printf_m13("AES_accel = %s\n", STR_tern_m13(hw_params->AES_accel, TRUE_m13));
 	printf_m13("SHA256_accel = %s\n", STR_tern_m13(hw_params->SHA256_accel, TRUE_m13));
+	printf_m13("SIMD_accel = %s\n", STR_tern_m13(hw_params->SIMD_accel, TRUE_m13));
+	printf_m13("CRC32_accel = %s\n", STR_tern_m13(hw_params->CRC32_accel, TRUE_m13));
 
 	if (hw_params->minimum_speed == 0.0)
 		printf_m13("minimum_speed = unknown\n");
@@ -43547,6 +49404,7 @@ tern	PAR_distribute_m13(PAR_INFO_m13 **par_infos, si4 n_infos, si4 reserved_core
 	si4			i, logical_cores, concurrent_cores, concurrent_jobs;
 	si4			total_jobs, currently_running, finished_jobs, ideal_jpc;
 	si8			start_uutc;
+	ui8			done_seq;
 	sf8			start_cpu, wall_secs, cpu_rate;
 	HW_PARAMS_m13		*hw_params;
 	PAR_INFO_m13		**pi_ptr, *pi;
@@ -43680,6 +49538,7 @@ tern	PAR_distribute_m13(PAR_INFO_m13 **par_infos, si4 n_infos, si4 reserved_core
 	// launch rest of jobs as others finish
 	r_val = TRUE_m13;
 	while (1) {
+		done_seq = proc_pool_m13.done_seq;  // before the scan: a completion after this point ends the wait below
 		for (currently_running = 0, pi_ptr = par_infos, i = n_infos; i--; ++pi_ptr) {
 			pi = *pi_ptr;
 			if (pi == NULL)
@@ -43715,7 +49574,9 @@ tern	PAR_distribute_m13(PAR_INFO_m13 **par_infos, si4 n_infos, si4 reserved_core
 
 		if (total_jobs <= (finished_jobs + currently_running))
 			break;
-		nap_m13("100 us");  // don't peg this cpu
+
+		// sleep until a job finishes (no polling)
+		PROC_pool_wait_m13(done_seq, 0);
 	}
 
 	// adapt session jobs_per_core (as in PROC_jobs_distribute_m13() - see the full derivation there)
@@ -43751,6 +49612,132 @@ tern	PAR_distribute_m13(PAR_INFO_m13 **par_infos, si4 n_infos, si4 reserved_core
 }
 
 
+si8	PAR_event_clear_m13(void)
+{
+	si8	n_events;
+#ifdef LINUX_m13
+	ui8	count;
+#endif
+#ifdef MACOS_m13
+	si8	n_read;
+	ui1	buf[256];
+#endif
+
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// drains the completion descriptor (see PAR_event_fd_m13()) - call on each wake, before collecting finished handles
+	// (a completion signaled after the clear leaves the descriptor readable, so none are missed)
+	// returns the number of completions signaled since the last clear (zero if none, or no descriptor)
+
+	n_events = 0;
+	if (par_event_rd_fd_m13 < 0)
+		return_m13(n_events);
+
+#ifdef LINUX_m13
+	if (read(par_event_rd_fd_m13, &count, sizeof(ui8)) == (ssize_t) sizeof(ui8))  // eventfd: one read returns & resets the counter
+		n_events = (si8) count;
+#endif
+#ifdef MACOS_m13
+	while ((n_read = (si8) read(par_event_rd_fd_m13, buf, sizeof(buf))) > 0)  // pipe: a byte per completion (non-blocking read end)
+		n_events += n_read;
+#endif
+
+	return_m13(n_events);
+}
+
+
+si4	PAR_event_fd_m13(void)
+{
+#if defined MACOS_m13 || defined LINUX_m13
+	si4	new_fds[2], expected_fd;
+#endif
+#ifdef MACOS_m13
+	si4	i;
+#endif
+
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// returns a descriptor that becomes readable when any PAR job finishes (threaded or not), for the caller's event loop
+	// process-wide, created on first call & never closed: caller must not close it (clear with PAR_event_clear_m13())
+	// Linux: eventfd; MacOS: pipe read end; Windows: not supported (returns -1 => use PAR_wait_any_m13())
+	// (completions before the first call are not signaled)
+	// a handle found finished on a wake may be freed at once (PAR_free_m13()): its job is not touched after its status is
+	// set - PAR_thread_m13() signals after the status without reading the handle, & PROC_job_init_m13() doesn't read a
+	// job whose function published its own status (PROC_JOB_STATUS_SET_m13)
+
+	if (par_event_rd_fd_m13 >= 0)
+		return_m13(par_event_rd_fd_m13);
+
+#if defined MACOS_m13 || defined LINUX_m13
+	#ifdef LINUX_m13
+	new_fds[0] = new_fds[1] = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+	if (new_fds[0] == -1) {
+		G_set_error_m13(E_PROC_m13, "could not create completion eventfd (%s)", strerror(errno));
+		return_m13(-1);
+	}
+	#endif
+	#ifdef MACOS_m13
+	if (pipe(new_fds) == -1) {
+		G_set_error_m13(E_PROC_m13, "could not create completion pipe (%s)", strerror(errno));
+		return_m13(-1);
+	}
+	for (i = 0; i < 2; ++i) {  // non-blocking both ends: a full pipe drops signals rather than stalling jobs
+		fcntl(new_fds[i], F_SETFL, fcntl(new_fds[i], F_GETFL) | O_NONBLOCK);
+		fcntl(new_fds[i], F_SETFD, FD_CLOEXEC);
+	}
+	#endif
+
+	// atomic claim (as G_is_level_header_m13()'s probe pipe): a racing thread's extra descriptor is closed
+	expected_fd = -1;
+	if (atomic_compare_exchange_strong(&par_event_wr_fd_m13, &expected_fd, new_fds[1])) {
+		par_event_rd_fd_m13 = new_fds[0];
+	} else {
+		close(new_fds[0]);
+		if (new_fds[1] != new_fds[0])
+			close(new_fds[1]);
+		while (par_event_rd_fd_m13 < 0)  // winner is publishing its read end
+			nap_m13("1 us");
+	}
+
+	return_m13(par_event_rd_fd_m13);
+#endif
+
+#ifdef WINDOWS_m13
+	return_m13(-1);
+#endif
+}
+
+
+static void	PAR_event_signal_m13(void)
+{
+#ifdef LINUX_m13
+	ui8	one;
+#endif
+#ifdef MACOS_m13
+	ui1	one;
+#endif
+
+
+	// a PAR job finished: make the completion descriptor readable, if one has been requested (see PAR_event_fd_m13())
+	// (write failures ignored: a full eventfd counter or pipe is already readable)
+
+	if (par_event_wr_fd_m13 < 0)
+		return;
+
+#if defined MACOS_m13 || defined LINUX_m13
+	one = 1;
+	if (write(par_event_wr_fd_m13, &one, sizeof(one)) == -1)
+		(void) 0;  // nothing useful to do
+#endif
+
+	return;
+}
+
+
 tern	PAR_free_m13(PAR_INFO_m13 **par_info_ptr)
 {
 	PAR_INFO_m13	*par_info;
@@ -44106,6 +50093,7 @@ tern	PAR_start_m13(PAR_INFO_m13 *par_info)
 pthread_rval_m13	PAR_thread_m13(void *arg)
 {
 	tern		error_captured;
+	ui4		status;
 	pid_t_m13	_id, own_id;
 	ERROR_m13	*err;
 	PROC_JOB_m13	*job;
@@ -44151,12 +50139,36 @@ pthread_rval_m13	PAR_thread_m13(void *arg)
 		pthread_mutex_unlock_m13(&err->mutex);
 		if (error_captured == TRUE_m13) // error info lives on in handle => error handled (releases isem so other threads can set errors)
 			G_clear_error_m13();
-		job->status = PROC_THREAD_FAILED_m13; // set after r_val & error info (job status signals completion)
+		status = PROC_THREAD_FAILED_m13;
 	} else {
-		job->status = PROC_THREAD_SUCCEEDED_m13;
+		status = PROC_THREAD_SUCCEEDED_m13;
 	}
 
-	return_m13((pthread_rval_m13) 0);
+	// completion callback: before the status is set - setting it releases waiters, who may free the handle
+	if (par_info->callback)
+		par_info->callback((void *) par_info, par_info->callback_arg);
+
+	job->status = status; // set after r_val, error info, & callback (job status signals completion): handle not touched after this
+	PAR_event_signal_m13();  // after the status: an event loop woken by the descriptor finds the handle finished
+
+	return_m13(PROC_JOB_STATUS_SET_m13);  // status published: PROC_job_init_m13() leaves the handle alone
+}
+
+
+static si8	PAR_usecs_m13(const si1 *time_str, si8 empty_usecs)
+{
+	struct timespec	ts;
+
+
+	// converts a nap_m13() string (e.g. "50 ms") to microseconds; returns empty_usecs for an empty string
+	// (invalid strings: error set by nap_timespec_m13() & empty_usecs returned)
+
+	if (STR_is_empty_m13(time_str) == TRUE_m13)
+		return(empty_usecs);
+	if (nap_timespec_m13(time_str, &ts) == NULL)
+		return(empty_usecs);
+
+	return(((si8) ts.tv_sec * (si8) 1000000) + ((si8) ts.tv_nsec / (si8) 1000));
 }
 
 
@@ -44164,6 +50176,8 @@ tern	PAR_wait_all_m13(PAR_INFO_m13 **par_infos, si4 n_infos, const si1 *interval
 {
 	tern		r_val;
 	si4		i, total_jobs, finished_jobs;
+	si8		backstop_usecs;
+	ui8		done_seq;
 	PAR_INFO_m13	**pi_ptr, *pi;
 
 #ifdef FT_DEBUG_m13
@@ -44172,16 +50186,18 @@ tern	PAR_wait_all_m13(PAR_INFO_m13 **par_infos, si4 n_infos, const si1 *interval
 
 	// returns FALSE_m13 if any job failed
 	// NULL & unlaunched entries skipped
+	// sleeps until jobs finish (woken by each completion - see PROC_pool_notify_m13()); interval is only the longest sleep
+	// between status checks (backstop for statuses set outside job init; default PROC_POOL_WAIT_BACKSTOP_US_m13)
 
-	if (STR_is_empty_m13(interval) == TRUE_m13)
-		interval = "100 us";
+	backstop_usecs = PAR_usecs_m13(interval, PROC_POOL_WAIT_BACKSTOP_US_m13);
 
-	// count waitable jobs & poll
+	// count waitable jobs & wait
 	// (waitable & finished counted in the same sweep: WAITING entries were never started - PAR_start_m13()
 	// does not return until status changes - so they will never finish & must not be waited on)
 	r_val = TRUE_m13;
 	while (1) {
 
+		done_seq = proc_pool_m13.done_seq;  // before the scan: a completion after this point ends the wait below
 		for (pi_ptr = par_infos, total_jobs = finished_jobs = 0, i = n_infos; i--; ++pi_ptr) {
 			pi = *pi_ptr;
 			if (pi == NULL)
@@ -44201,21 +50217,79 @@ tern	PAR_wait_all_m13(PAR_INFO_m13 **par_infos, si4 n_infos, const si1 *interval
 		if (finished_jobs == total_jobs)
 			break;
 
-		// don't peg this cpu
-		nap_m13(interval);
+		// sleep until a job finishes (no polling)
+		PROC_pool_wait_m13(done_seq, G_current_uutc_m13() + backstop_usecs);
 	}
 
 	return_m13(r_val);
 }
 
 
+si4	PAR_wait_any_m13(PAR_INFO_m13 **par_infos, si4 n_infos, const si1 *timeout)
+{
+	si4		i, started_jobs;
+	si8		timeout_usecs, deadline_uutc, now_uutc, wake_uutc;
+	ui8		done_seq;
+	PAR_INFO_m13	*pi;
+
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// returns the index of a finished handle (the lowest, if several), PAR_WAIT_TIMEOUT_m13 if none finished within timeout,
+	// or PAR_WAIT_NONE_m13 if the set holds no started handles (NULL, unprepped, & never started entries skipped)
+	// timeout: NULL (or empty) == wait indefinitely; "0 us" == check without sleeping
+	// a finished handle is returned on every call until the caller drops it from the set (see example in header)
+
+	timeout_usecs = PAR_usecs_m13(timeout, -1);  // -1: no timeout
+	deadline_uutc = 0;
+	if (timeout_usecs >= 0)
+		deadline_uutc = G_current_uutc_m13() + timeout_usecs;
+
+	while (1) {
+
+		done_seq = proc_pool_m13.done_seq;  // before the scan: a completion after this point ends the wait below
+		for (started_jobs = 0, i = 0; i < n_infos; ++i) {
+			pi = par_infos[i];
+			if (pi == NULL)
+				continue;
+			if (pi->fn == NULL)
+				continue;
+			if (pi->job.status == PROC_THREAD_WAITING_m13)  // never started
+				continue;
+			if (pi->job.status & PROC_THREAD_FINISHED_m13)
+				return_m13(i);
+			++started_jobs;
+		}
+
+		if (started_jobs == 0)
+			return_m13(PAR_WAIT_NONE_m13);
+
+		// sleep until a job finishes, or the deadline (no polling)
+		now_uutc = G_current_uutc_m13();
+		wake_uutc = now_uutc + PROC_POOL_WAIT_BACKSTOP_US_m13;
+		if (deadline_uutc) {
+			if (now_uutc >= deadline_uutc)
+				return_m13(PAR_WAIT_TIMEOUT_m13);
+			if (wake_uutc > deadline_uutc)
+				wake_uutc = deadline_uutc;
+		}
+		PROC_pool_wait_m13(done_seq, wake_uutc);
+	}
+}
+
+
 tern	PAR_wait_m13(PAR_INFO_m13 *par_info, const si1 *interval)
 {
+	si8	backstop_usecs;
+	ui8	done_seq;
+
 #ifdef FT_DEBUG_m13
 	G_push_function_m13();
 #endif
 
 	// returns TRUE_m13 if job succeeded, FALSE_m13 otherwise
+	// sleeps until the job finishes (see PAR_wait_all_m13() re interval)
 
 	if (par_info == NULL) {
 		G_warning_message_m13("%s(): NULL par_info => returning\n", __FUNCTION__);
@@ -44230,12 +50304,40 @@ tern	PAR_wait_m13(PAR_INFO_m13 *par_info, const si1 *interval)
 		return_m13(FALSE_m13);  // (PAR_start_m13() does not return until status changes, so WAITING here cannot be a launch in progress)
 	}
 
-	if (STR_is_empty_m13(interval) == TRUE_m13)
-		interval = "100 us";
+	backstop_usecs = PAR_usecs_m13(interval, PROC_POOL_WAIT_BACKSTOP_US_m13);
 
-	// poll job status at interval (don't peg this cpu)
-	while ((par_info->job.status & PROC_THREAD_FINISHED_m13) == 0)
-		nap_m13(interval);
+	// sleep until the job finishes (no polling)
+	while (1) {
+		done_seq = proc_pool_m13.done_seq;  // before the check: a completion after this point ends the wait below
+		if (par_info->job.status & PROC_THREAD_FINISHED_m13)
+			break;
+		PROC_pool_wait_m13(done_seq, G_current_uutc_m13() + backstop_usecs);
+	}
+
+	return_m13(PAR_SUCCEEDED_m13(par_info));
+}
+
+
+tern	PAR_wait_timed_m13(PAR_INFO_m13 *par_info, const si1 *timeout)
+{
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// returns TRUE_m13 if job succeeded, FALSE_m13 if it failed (or was never started), UNKNOWN_m13 if still running at timeout
+	// timeout: as in PAR_wait_any_m13() (NULL == wait indefinitely)
+
+	if (par_info == NULL) {
+		G_warning_message_m13("%s(): NULL par_info => returning\n", __FUNCTION__);
+		return_m13(FALSE_m13);
+	}
+	if (par_info->fn == NULL || par_info->job.status == PROC_THREAD_WAITING_m13) {
+		G_warning_message_m13("%s(): job \"%s\" was not started => returning\n", __FUNCTION__, par_info->label);
+		return_m13(FALSE_m13);
+	}
+
+	if (PAR_wait_any_m13(&par_info, 1, timeout) == PAR_WAIT_TIMEOUT_m13)
+		return_m13(UNKNOWN_m13);
 
 	return_m13(PAR_SUCCEEDED_m13(par_info));
 }
@@ -44748,6 +50850,7 @@ tern	PROC_increase_process_priority_m13(tern verbose_flag, si4 sudo_prompt_flag,
 
 pthread_rval_m13	PROC_job_init_m13(void *arg)
 {
+	tern			threaded;
 	pthread_t_m13		thread;
 	pthread_rval_m13	r_val;
 	PROC_JOB_m13		*job;
@@ -44756,18 +50859,22 @@ pthread_rval_m13	PROC_job_init_m13(void *arg)
 	// this thread is passed through on way to job->function by PROC_job_launch_m13()
 	// so it can enter itself into the thread list, & set name
 	// (also called directly - not as a thread - by the unthreaded paths of PROC_jobs_distribute_m13()
-	// & PAR_start_m13(), so the status contract below holds however a job runs)
+	// & PAR_start_m13(), so the status contract below holds however a job runs; & by pool workers
+	// (PROC_pool_worker_m13()), for which each job is a thread lifetime: list entry, behavior, & exit cleanup)
 
 	job = (PROC_JOB_m13 *) arg;
 
 	// status contract centralized here: RUNNING set before the job function runs & a finish status
 	// guaranteed after it returns - a job function that sets neither can no longer hang the launch
 	// spin in PROC_jobs_distribute_m13() (WAITING never changing) or PROC_jobs_wait_m13() (FINISHED
-	// never set); job functions may still set these themselves (redundant sets are harmless)
+	// never set); the finish status is published in exactly one place: a job function that sets it
+	// itself returns PROC_JOB_STATUS_SET_m13 (its waiter may free the job from then on), otherwise
+	// it is published here from the return value
 	job->status = PROC_THREAD_RUNNING_m13;
+	threaded = job->threaded;  // job may be released by its waiter once it finishes: nothing in it is read after that
 
 	// enter into thread list
-	if (job->threaded == TRUE_m13) {
+	if (threaded == TRUE_m13) {
 		G_push_behavior_m13(job->parent_behavior);  // inherit spawner's behavior (snapshot at launch) as this thread's base entry
 		job->_id = gettid_m13();
 		thread = pthread_self_m13();
@@ -44778,20 +50885,12 @@ pthread_rval_m13	PROC_job_init_m13(void *arg)
 		// tiers map to per-thread nice here (Linux nice is per-thread; a thread nices ITSELF - the only fully
 		// portable-within-Linux way). Raising priority (negative nice) needs CAP_SYS_NICE: attempted & silently
 		// left at 0 without it, matching the old (always no-op) behavior for unprivileged HIGH/MAX requests.
-		// (Threaded jobs only: the unthreaded path runs in the CALLER's thread - nice would outlive the job.)
-		if (job->priority != PROC_DEFAULT_PRIORITY_m13) {
+		// (Threaded jobs only: the unthreaded path runs in the CALLER's thread - nice would outlive the job.
+		// Pool workers outlive their jobs too: they apply & track priority themselves - see PROC_pool_priority_m13().)
+		if (job->priority != PROC_DEFAULT_PRIORITY_m13 && proc_pool_self_m13 == NULL) {
 			si4	nice_val;
 
-			switch (job->priority) {
-				case PROC_MIN_PRIORITY_m13:	nice_val = 19;   break;
-				case PROC_LOW_PRIORITY_m13:	nice_val = 5;    break;
-				case PROC_MEDIUM_PRIORITY_m13:	nice_val = 0;    break;
-				case PROC_HIGH_PRIORITY_m13:	nice_val = -5;   break;
-				case PROC_MAX_PRIORITY_m13:	nice_val = -10;  break;
-				default:  // caller passed a raw value: interpreted as a nice value on Linux
-					nice_val = (job->priority < -20) ? -20 : (job->priority > 19) ? 19 : job->priority;
-					break;
-			}
+			nice_val = PROC_os_priority_m13(job->priority);
 			if (nice_val)
 				setpriority(PRIO_PROCESS, (id_t) job->_id, nice_val);  // PRIO_PROCESS + tid == this thread only (Linux-specific semantics)
 		}
@@ -44819,13 +50918,14 @@ pthread_rval_m13	PROC_job_init_m13(void *arg)
 	// launch job
 	r_val = job->function(arg);
 
-	// backstop: job function returned without setting a finish status - infer from its return value
-	// (job functions return (pthread_rval_m13) 0 on success by convention)
-	if ((job->status & PROC_THREAD_FINISHED_m13) == 0)
+	// publish the finish status unless the job function did (decided by its return value alone: the job is not read)
+	if (r_val != PROC_JOB_STATUS_SET_m13)
 		job->status = (r_val == (pthread_rval_m13) 0) ? PROC_THREAD_SUCCEEDED_m13 : PROC_THREAD_FAILED_m13;
 
-	if (job->threaded == TRUE_m13)
+	if (threaded == TRUE_m13) {
 		G_thread_exit_m13();
+		PROC_pool_notify_m13();  // wake completion waiters (pooled or not)
+	}
 
 	return(r_val);
 }
@@ -44835,12 +50935,9 @@ pthread_rval_m13	PROC_job_init_m13(void *arg)
 tern	PROC_job_launch_m13(PROC_JOB_m13 *job)
 {
 	tern			launched;
-	sf8			f_min_priority, f_max_priority;
 	pthread_t		thread;
 	pthread_attr_t		attributes;
 	struct sched_param	sched_params;
-	static si4		min_priority = PROC_UNDEFINED_PRIORITY_m13;
-	static si4		low_priority, med_priority, high_priority, max_priority;
 
 #ifdef FT_DEBUG_m13
 	G_push_function_m13();
@@ -44852,35 +50949,7 @@ tern	PROC_job_launch_m13(PROC_JOB_m13 *job)
 	pthread_attr_init(&attributes);
 	if (job->priority != PROC_DEFAULT_PRIORITY_m13) {
 		pthread_attr_getschedparam(&attributes, &sched_params);
-		if (min_priority == PROC_UNDEFINED_PRIORITY_m13) {  // only do this once
-			f_max_priority = (sf8) sched_get_priority_max(SCHED_OTHER);
-			f_min_priority = (sf8) sched_get_priority_min(SCHED_OTHER);
-			low_priority = (si4) round((0.75 * f_min_priority) + (0.25 * f_max_priority));
-			med_priority = (si4) round(0.5 * (f_min_priority + f_max_priority));
-			high_priority = (si4) round((0.25 * f_min_priority) + (0.75 * f_max_priority));
-			max_priority = (si4) f_max_priority;
-			min_priority = (si4) f_min_priority;
-		}
-		switch (job->priority) {
-			case PROC_MIN_PRIORITY_m13:
-				sched_params.sched_priority = min_priority;
-				break;
-			case PROC_LOW_PRIORITY_m13:
-				sched_params.sched_priority = low_priority;
-				break;
-			case PROC_MEDIUM_PRIORITY_m13:
-				sched_params.sched_priority = med_priority;
-				break;
-			case PROC_HIGH_PRIORITY_m13:
-				sched_params.sched_priority = high_priority;
-				break;
-			case PROC_MAX_PRIORITY_m13:
-				sched_params.sched_priority = max_priority;
-				break;
-			default: // caller passed priority value
-				sched_params.sched_priority = job->priority;
-				break;
-		}
+		sched_params.sched_priority = PROC_os_priority_m13(job->priority);
 		pthread_attr_setschedparam(&attributes, &sched_params);
 	}
 
@@ -44989,28 +51058,8 @@ tern	PROC_job_launch_m13(PROC_JOB_m13 *job)
 	job->status = PROC_THREAD_WAITING_m13;
 	
 	// get priority
-	if (job->priority != PROC_DEFAULT_PRIORITY_m13) {
-		switch (job->priority) {
-			case PROC_MIN_PRIORITY_m13:
-				priority = THREAD_PRIORITY_LOWEST;
-				break;
-			case PROC_LOW_PRIORITY_m13:
-				priority = THREAD_PRIORITY_BELOW_NORMAL;
-				break;
-			case PROC_MEDIUM_PRIORITY_m13:
-				priority = THREAD_PRIORITY_NORMAL;
-				break;
-			case PROC_HIGH_PRIORITY_m13:
-				priority = THREAD_PRIORITY_ABOVE_NORMAL;
-				break;
-			case PROC_MAX_PRIORITY_m13:
-				priority = THREAD_PRIORITY_HIGHEST;
-				break;
-			default: // caller passed priority value
-				priority = job->priority;
-				break;
-		}
-	}
+	if (job->priority != PROC_DEFAULT_PRIORITY_m13)
+		priority = PROC_os_priority_m13(job->priority);
 
 	// get affinity
 	free_cpu_set = FALSE_m13;
@@ -45056,13 +51105,16 @@ tern	PROC_job_launch_m13(PROC_JOB_m13 *job)
 
 tern	PROC_jobs_distribute_m13(PROC_JOB_m13 *jobs, si4 n_jobs, si4 reserved_cores, si4 jobs_per_core, tern thread_jobs, tern wait_jobs)
 {
-	tern			r_val, adaptive;
+	tern			r_val, adaptive, nested;
 	si4			i, logical_cores, concurrent_cores, concurrent_jobs;
-	si4			total_jobs, currently_running, finished_jobs, ideal_jpc;
+	si4			total_jobs, finished_jobs, ideal_jpc, pool_limit;
+	ui4			fork_mark;
 	si8			start_uutc;
 	sf8			start_cpu, wall_secs, cpu_rate;
 	HW_PARAMS_m13		*hw_params;
 	PROC_JOB_m13		*job;
+	PROC_POOL_m13		*pool;
+	PROC_POOL_WORKER_m13	*slot, *self;
 	static _Atomic si4	tuned_jobs_per_core = 0;  // session-adaptive (see below); zero == not yet tuned
 	
 #ifdef FT_DEBUG_m13
@@ -45075,8 +51127,15 @@ tern	PROC_jobs_distribute_m13(PROC_JOB_m13 *jobs, si4 n_jobs, si4 reserved_cores
 	// if jobs can fully utilize a core, set jobs_per_core == 1, titrate to higher numbers for jobs that do a lot of waiting, set to 0 to launch all threads concurrently and let system distribute
 	// (pass PROC_JOBS_PER_CORE_DEFAULT_m13 for session-adaptive tuning, starting at PROC_JOBS_PER_CORE_BASE_m13 - recommended for the library's typical decode-dominant jobs)
 	// if thread_jobs == TRUE_m13 thread out the jobs, if FALSE_m13 run consecutively in this thread, if NOT_SET_m13 use default threading
-	// if wait_jobs == TRUE_m13 wait for jobs in this function
+	// if wait_jobs == TRUE_m13 wait for jobs in this function: it returns only once every job has finished, including jobs that failed to launch,
+	// so the caller may free the jobs (& anything they point to) on return. With wait_jobs == FALSE_m13 a FALSE_m13 return (a launch failure)
+	// does not mean the other jobs have stopped: PROC_jobs_wait_m13() on all of them before freeing any.
 	// returns FALSE_m13 on any error, UNKNOWN_m13 if jobs still running, but none have failed, TRUE_m13 if all jobs finished successfully
+	// threaded jobs run on the persistent pool with fork-join semantics: the outermost distribution's concurrency (cores x jobs per core)
+	// is one limit for everything beneath it - distributions from inside pool jobs (nested: session => channel => segment) fork their
+	// jobs into the same pool (their reserved_cores & jobs_per_core are ignored), & a caller waiting on its jobs runs those still queued itself
+	// concurrent outermost distributions share the pool under the largest of their limits, held until each one's jobs finish
+	// (jobs_per_core == 0: all of a call's jobs at once, but no fewer than one per core, & within PROC_POOL_WORKERS_MAX_m13)
 	
 	// check threading
 	if (thread_jobs == NOT_SET_m13)
@@ -45138,12 +51197,29 @@ tern	PROC_jobs_distribute_m13(PROC_JOB_m13 *jobs, si4 n_jobs, si4 reserved_cores
 		concurrent_jobs = concurrent_cores * jobs_per_core;
 	else
 		concurrent_jobs = n_jobs;
+
+	// global concurrency limit: requested by outermost distributions only (nested distributions run within it)
+	// each job carries its call's limit to the pool, which counts it while queued or running (see PROC_pool_limit_m13())
+	// the caller borrows a deque so it can run its own queued jobs while it waits (see PROC_pool_help_m13())
+	nested = (proc_pool_self_m13) ? TRUE_m13 : FALSE_m13;
+	pool_limit = 0;
+	if (nested == FALSE_m13) {
+		pool_limit = concurrent_jobs;
+		if (pool_limit < concurrent_cores)  // (jobs_per_core == 0)
+			pool_limit = concurrent_cores;
+		if (pool_limit > PROC_POOL_WORKERS_MAX_m13)
+			pool_limit = PROC_POOL_WORKERS_MAX_m13;
+	}
+	slot = NULL;
+	pool = PROC_pool_get_m13();  // (NULL: jobs get their own threads - see PROC_pool_submit_m13())
+	if (pool && nested == FALSE_m13 && wait_jobs == TRUE_m13)
+		slot = PROC_pool_enter_m13(pool);
 	
 	// initialize & count total jobs
 	// NOTE: no affinity masks (removed 2026-07-29): the goal was OS headroom, but a static range mask can't
 	// deliver it - affinity only constrains OUR threads (the kernel uses core 0 regardless), forbids migration
 	// to idle cores (pure throughput loss - the shared mask gave no per-thread cache locality), & the Windows
-	// mask covers only one 64-logical-processor group. Headroom comes from the concurrency throttle above
+	// mask covers only one 64-logical-processor group. Headroom comes from the concurrency limit above
 	// (reserved_cores) &, when the Background Processing RC field is YES, from low job priority below.
 	for (job = jobs, total_jobs = 0, i = n_jobs; i--; ++job) {
 		if (job->skip == TRUE_m13) {
@@ -45156,6 +51232,7 @@ tern	PROC_jobs_distribute_m13(PROC_JOB_m13 *jobs, si4 n_jobs, si4 reserved_cores
 		job->cpu_set_p = NULL;
 		job->affinity_str = NULL;
 		job->threaded = job->detached = TRUE_m13;
+		job->pool_limit = pool_limit;
 		if (globals_m13->miscellaneous.background_processing == TRUE_m13)
 			job->priority = PROC_LOW_PRIORITY_m13;  // machine-level politeness request: overrides per-job priorities
 	}
@@ -45167,61 +51244,46 @@ tern	PROC_jobs_distribute_m13(PROC_JOB_m13 *jobs, si4 n_jobs, si4 reserved_cores
 	start_uutc = G_current_uutc_m13();
 	start_cpu = PROC_cpu_time_m13();
 
-	// launch initial job set
-	for (currently_running = 0, job = jobs, i = concurrent_jobs; i--; ++job) {
+	// fork: all jobs to the pool at once (the global limit, not this call, paces them)
+	// a waiting caller with a deque marks its bottom: while waiting it helps only with jobs pushed above the mark (these)
+	self = (wait_jobs == TRUE_m13) ? proc_pool_self_m13 : NULL;
+	fork_mark = 0;
+	if (self) {
+		fork_mark = self->fork_mark;
+		self->fork_mark = self->bottom;
+	}
+	for (job = jobs, i = n_jobs; i--; ++job) {
 		if (job->skip == TRUE_m13)
 			continue;
-
-		// launch job
-		if (PROC_job_launch_m13(job) == TRUE_m13) {
-			while (job->status == PROC_THREAD_WAITING_m13)  // wait for status change in thread
-				nap_m13("1 us");  // don't peg cpu on this
-			if (++currently_running == concurrent_jobs)
-				break;
-		} else {  // launch failed
+		if (PROC_pool_submit_m13(job) == FALSE_m13)  // launch failed
 			job->status = PROC_THREAD_FAILED_m13;
-		}
 	}
 
-	// launch rest of jobs as others finish
-	r_val = TRUE_m13;
-	while (1) {
-		for (currently_running = 0, job = jobs, i = n_jobs; i--; ++job)
-			if (job->status == PROC_THREAD_RUNNING_m13)
-				++currently_running;
-
+	// join
+	if (wait_jobs == TRUE_m13) {
+		r_val = PROC_jobs_wait_m13(jobs, n_jobs);
+		if (self)
+			self->fork_mark = fork_mark;
+		if (slot)
+			PROC_pool_leave_m13(pool, slot);
+	} else {
+		r_val = TRUE_m13;
 		for (finished_jobs = 0, job = jobs, i = n_jobs; i--; ++job) {
-			if (currently_running == concurrent_jobs)
-				break;
-			if (job->status == PROC_THREAD_WAITING_m13) {
-
-				// launch job
-				if (PROC_job_launch_m13(job) == TRUE_m13) {
-					while (job->status == PROC_THREAD_WAITING_m13)  // wait for status change in thread
-						nap_m13("1 us");  // don't peg cpu on this
-					++currently_running;
-				} else {  // launch failed
-					job->status = PROC_THREAD_FAILED_m13;
-				}
-			} else if (job->skip == FALSE_m13 && (job->status & PROC_THREAD_FINISHED_m13)) {
-				// skip guard: SKIPPED status is in the FINISHED mask, but skipped jobs are not in
-				// total_jobs - counting them here breaks the loop early & strands WAITING jobs
+			if (job->skip == FALSE_m13 && (job->status & PROC_THREAD_FINISHED_m13)) {
 				++finished_jobs;
 				if (job->status == PROC_THREAD_FAILED_m13)
 					r_val = FALSE_m13;
 			}
 		}
-
-		if (total_jobs <= (finished_jobs + currently_running))
-			break;
-		nap_m13("100 us");  // don't peg this cpu
+		if (r_val == TRUE_m13 && finished_jobs < total_jobs)
+			r_val = UNKNOWN_m13;
 	}
 
 	// adapt session jobs_per_core: per-job busy fraction == cpu_rate / (jobs_per_core * concurrent_cores)
 	// => ideal jobs_per_core (busy fraction * ideal == 1) == (jobs_per_core * concurrent_cores) / cpu_rate
-	// measurement trusted only when: no other distribution ran concurrently, >= 2 waves of jobs, & window >= 100 ms
-	// (other busy threads in the process inflate cpu_rate => adaptation errs conservative)
-	if (adaptive == TRUE_m13 && distribute_calls_m13 == 1) {
+	// measurement trusted only when: jobs waited on here, no other distribution ran concurrently (nested ones included),
+	// >= 2 waves of jobs, & window >= 100 ms (other busy threads in the process inflate cpu_rate => adaptation errs conservative)
+	if (adaptive == TRUE_m13 && wait_jobs == TRUE_m13 && distribute_calls_m13 == 1) {
 		wall_secs = (sf8) (G_current_uutc_m13() - start_uutc) / (sf8) 1e6;
 		if (total_jobs >= (concurrent_jobs << 1) && wall_secs >= (sf8) 0.1) {
 			cpu_rate = (PROC_cpu_time_m13() - start_cpu) / wall_secs;
@@ -45240,16 +51302,7 @@ tern	PROC_jobs_distribute_m13(PROC_JOB_m13 *jobs, si4 n_jobs, si4 reserved_cores
 	}
 	--distribute_calls_m13;
 
-	if (wait_jobs == TRUE_m13)
-		return_m13(PROC_jobs_wait_m13(jobs, n_jobs));
-	
-	if (r_val == TRUE_m13) {
-		if (finished_jobs == total_jobs)
-			return_m13(TRUE_m13);
-		return_m13(UNKNOWN_m13);
-	}
-		
-	return_m13(FALSE_m13);
+	return_m13(r_val);
 }
 
 
@@ -45257,6 +51310,7 @@ tern	PROC_jobs_wait_m13(PROC_JOB_m13 *jobs, si4 n_jobs)
 {
 	tern		r_val;
 	si4		i, total_jobs, finished_jobs;
+	ui8		done_seq;
 	PROC_JOB_m13	*job;
 	
 #ifdef FT_DEBUG_m13
@@ -45264,6 +51318,7 @@ tern	PROC_jobs_wait_m13(PROC_JOB_m13 *jobs, si4 n_jobs)
 #endif
 	
 	// returns FALSE_m13 if any of the jobs failed
+	// (callers with a pool deque - pool jobs, & distribution callers - run their own queued jobs while waiting: see PROC_pool_wait_m13())
 
 	// count total jobs
 	for (job = jobs, total_jobs = 0, i = n_jobs; i--; ++job)
@@ -45272,7 +51327,7 @@ tern	PROC_jobs_wait_m13(PROC_JOB_m13 *jobs, si4 n_jobs)
 		
 	r_val = TRUE_m13;
 	while (1) {
-		
+		done_seq = proc_pool_m13.done_seq;  // before the scan: a completion after this point ends the wait below
 		for (job = jobs, finished_jobs = 0, i = n_jobs; i--; ++job) {
 			if (job->skip == FALSE_m13 && (job->status & PROC_THREAD_FINISHED_m13)) {
 				// skip guard: SKIPPED status is in the FINISHED mask, but skipped jobs are not in
@@ -45286,14 +51341,736 @@ tern	PROC_jobs_wait_m13(PROC_JOB_m13 *jobs, si4 n_jobs)
 		if (finished_jobs == total_jobs)
 			break;
 		
-		// don't peg this cpu
-		nap_m13("100 us");
+		// sleep until a job finishes (no polling)
+		PROC_pool_wait_m13(done_seq, 0);
 	}
 	
 	return_m13(r_val);
 }
 
 
+si4	PROC_open_file_limit_m13(void)
+{
+#if defined MACOS_m13 || defined LINUX_m13
+	struct rlimit	rlimit_struct;
+#endif
+
+	// returns the process's current open file limit (see PROC_adjust_open_file_limit_m13()), or -1 on error
+	
+	#if defined MACOS_m13 || defined LINUX_m13
+	if (getrlimit(RLIMIT_NOFILE, &rlimit_struct) == -1)
+		return(-1);
+	if (rlimit_struct.rlim_cur == RLIM_INFINITY || rlimit_struct.rlim_cur > (rlim_t) 0x7FFFFFFF)
+		return((si4) 0x7FFFFFFF);
+	return((si4) rlimit_struct.rlim_cur);
+	#endif
+
+	#ifdef WINDOWS_m13
+	return((si4) _getmaxstdio());
+	#endif
+}
+
+
+#ifdef MACOS_m13
+static si4	PROC_os_priority_m13(si4 priority)
+{
+	sf8		f_min_priority, f_max_priority;
+	static si4	min_priority = PROC_UNDEFINED_PRIORITY_m13;
+	static si4	low_priority, med_priority, high_priority, max_priority;
+
+
+	// maps a PROC priority tier to a SCHED_OTHER scheduling priority (five tiers spread across the range; raw values pass through)
+	// (not called for PROC_DEFAULT_PRIORITY_m13: default means leave the thread's priority alone)
+
+	if (min_priority == PROC_UNDEFINED_PRIORITY_m13) {  // only do this once
+		f_max_priority = (sf8) sched_get_priority_max(SCHED_OTHER);
+		f_min_priority = (sf8) sched_get_priority_min(SCHED_OTHER);
+		low_priority = (si4) round((0.75 * f_min_priority) + (0.25 * f_max_priority));
+		med_priority = (si4) round(0.5 * (f_min_priority + f_max_priority));
+		high_priority = (si4) round((0.25 * f_min_priority) + (0.75 * f_max_priority));
+		max_priority = (si4) f_max_priority;
+		min_priority = (si4) f_min_priority;
+	}
+	switch (priority) {
+		case PROC_MIN_PRIORITY_m13:
+			return(min_priority);
+		case PROC_LOW_PRIORITY_m13:
+			return(low_priority);
+		case PROC_MEDIUM_PRIORITY_m13:
+			return(med_priority);
+		case PROC_HIGH_PRIORITY_m13:
+			return(high_priority);
+		case PROC_MAX_PRIORITY_m13:
+			return(max_priority);
+	}
+
+	return(priority);  // caller passed priority value
+}
+#endif  // MACOS_m13
+
+
+#ifdef LINUX_m13
+static si4	PROC_os_priority_m13(si4 priority)
+{
+	// maps a PROC priority tier to a per-thread nice value (see PROC_job_init_m13())
+	// (not called for PROC_DEFAULT_PRIORITY_m13: default means leave the thread's priority alone)
+
+	switch (priority) {
+		case PROC_MIN_PRIORITY_m13:
+			return(19);
+		case PROC_LOW_PRIORITY_m13:
+			return(5);
+		case PROC_MEDIUM_PRIORITY_m13:
+			return(0);
+		case PROC_HIGH_PRIORITY_m13:
+			return(-5);
+		case PROC_MAX_PRIORITY_m13:
+			return(-10);
+	}
+
+	// caller passed a raw value: interpreted as a nice value on Linux
+	return((priority < -20) ? -20 : (priority > 19) ? 19 : priority);
+}
+#endif  // LINUX_m13
+
+
+#ifdef WINDOWS_m13
+static si4	PROC_os_priority_m13(si4 priority)
+{
+	// maps a PROC priority tier to a Windows thread priority (raw values pass through)
+	// (not called for PROC_DEFAULT_PRIORITY_m13: default means leave the thread's priority alone)
+
+	switch (priority) {
+		case PROC_MIN_PRIORITY_m13:
+			return(THREAD_PRIORITY_LOWEST);
+		case PROC_LOW_PRIORITY_m13:
+			return(THREAD_PRIORITY_BELOW_NORMAL);
+		case PROC_MEDIUM_PRIORITY_m13:
+			return(THREAD_PRIORITY_NORMAL);
+		case PROC_HIGH_PRIORITY_m13:
+			return(THREAD_PRIORITY_ABOVE_NORMAL);
+		case PROC_MAX_PRIORITY_m13:
+			return(THREAD_PRIORITY_HIGHEST);
+	}
+
+	return(priority);  // caller passed priority value
+}
+#endif  // WINDOWS_m13
+
+
+static PROC_POOL_WORKER_m13	*PROC_pool_enter_m13(PROC_POOL_m13 *pool)
+{
+	PROC_POOL_WORKER_m13	*slot;
+
+
+	// lends a deque slot to a thread outside the pool for the length of a distribution: workers steal its jobs from it,
+	// & the caller runs those still queued itself while it waits (see PROC_pool_help_m13())
+	// returns NULL if every slot is in use (jobs then go on the shared deque)
+
+	pthread_mutex_lock_m13(&pool->mutex);
+	slot = PROC_pool_slot_m13(pool);
+	if (slot) {
+		slot->external = TRUE_m13;
+		slot->fork_mark = slot->bottom;
+	}
+	pthread_mutex_unlock_m13(&pool->mutex);
+	if (slot)
+		proc_pool_self_m13 = slot;
+
+	return(slot);
+}
+
+
+static PROC_POOL_m13	*PROC_pool_get_m13(void)
+{
+	tern		expected;
+	si4		i;
+	PROC_POOL_m13	*pool;
+
+
+	// process-wide persistent job pool, set up on first use (lazy-initialization election as in isem_lazy_init_m13())
+	// returns NULL if the pool can't be set up (callers fall back to a thread per job)
+	// (pool memory is plain malloc family: the pool outlives G_free_globals_m13(), so it must not be tracked)
+
+	pool = &proc_pool_m13;
+	if (pool->initialized == TRUE_m13)  // common case: already initialized
+		return(pool);
+
+	expected = NOT_SET_m13;
+	if (atomic_compare_exchange_strong(&pool->initialized, &expected, FALSE_m13)) {  // FALSE_m13 == initializing
+		pool->workers = (PROC_POOL_WORKER_m13 *) calloc((size_t) PROC_POOL_WORKERS_MAX_m13, sizeof(PROC_POOL_WORKER_m13));
+		pool->limit_jobs = (_Atomic si4 *) calloc((size_t) PROC_POOL_WORKERS_MAX_m13 + 1, sizeof(_Atomic si4));
+		if (pool->workers == NULL || pool->limit_jobs == NULL) {
+			free((void *) pool->workers);
+			free((void *) pool->limit_jobs);
+			pool->workers = NULL;
+			pool->limit_jobs = NULL;
+			pool->initialized = NOT_SET_m13;  // next use retries
+			return(NULL);
+		}
+		for (i = 0; i < PROC_POOL_WORKERS_MAX_m13; ++i)
+			pthread_mutex_init_m13(&pool->workers[i].mutex, NULL);
+		pthread_mutex_init_m13(&pool->shared.mutex, NULL);
+		pthread_mutex_init_m13(&pool->mutex, NULL);
+		pthread_cond_init_m13(&pool->work_cond, NULL);
+		pthread_cond_init_m13(&pool->done_cond, NULL);
+		pool->keep_workers = globals_m13->tables->HW_params.logical_cores * PROC_POOL_WORKERS_KEEP_m13;
+		pool->default_active = globals_m13->tables->HW_params.logical_cores * PROC_JOBS_PER_CORE_BASE_m13;
+		pool->max_active = pool->default_active;
+		pool->initialized = TRUE_m13;
+	} else {
+		while (pool->initialized == FALSE_m13)  // winner is initializing
+			nap_m13("1 us");
+	}
+
+	return((pool->initialized == TRUE_m13) ? pool : NULL);
+}
+
+
+static tern	PROC_pool_help_m13(PROC_POOL_m13 *pool, PROC_POOL_WORKER_m13 *self)
+{
+	tern		claim;
+	ui4		mark;
+	si4		limit;
+	PROC_JOB_m13	*job;
+
+
+	// fork-join: a waiting parent runs one of its own queued jobs (its sub-jobs no thief has taken) in place of sleeping
+	// only jobs above the deque's fork mark are its own: those below belong to enclosing jobs (e.g. sibling channel jobs on a
+	// borrowed deque) - running them here would nest unrelated jobs on this stack, so with none of its own left it sleeps
+	// runs in place with unthreaded semantics (as PROC_jobs_distribute_m13() with threading off): the job shares this
+	// thread's thread list entry, behavior, & errors - running it as a thread here would tear down the parent's on exit
+	// a worker helps within its own run slot; a distribution's caller (external slot) needs one under the global limit
+	// (unless already helping: a job it runs in place may wait on sub-jobs of its own)
+	// returns TRUE_m13 if a job was run
+
+	if ((si4) (self->bottom - self->fork_mark) <= 0)  // nothing of its own queued (free-running indices: signed difference)
+		return(FALSE_m13);
+	claim = (self->external == TRUE_m13 && self->helping == 0) ? TRUE_m13 : FALSE_m13;
+	if (claim == TRUE_m13) {
+		if (++pool->n_active > pool->max_active) {
+			--pool->n_active;
+			return(FALSE_m13);
+		}
+	}
+
+	job = PROC_pool_pop_m13(self, FALSE_m13);
+	if (job) {
+		--pool->n_queued;
+		job->threaded = FALSE_m13;
+		mark = self->fork_mark;
+		self->fork_mark = self->bottom;  // the job's own sub-jobs go above this
+		limit = job->pool_limit;  // (the job may be freed once it finishes)
+		++self->helping;
+		PROC_job_init_m13((void *) job);
+		--self->helping;
+		self->fork_mark = mark;
+		if (limit)
+			PROC_pool_limit_m13(pool, limit, -1);
+		PROC_pool_notify_m13();  // (the usual waiter is this thread, but need not be)
+	}
+
+	if (claim == TRUE_m13) {
+		--pool->n_active;
+		if (pool->n_queued > 0) {  // run slot freed: a worker idling at the limit may take it
+			pthread_mutex_lock_m13(&pool->mutex);
+			PROC_pool_runner_m13(pool);
+			pthread_mutex_unlock_m13(&pool->mutex);
+		}
+	}
+
+	return((job) ? TRUE_m13 : FALSE_m13);
+}
+
+
+static void	PROC_pool_leave_m13(PROC_POOL_m13 *pool, PROC_POOL_WORKER_m13 *slot)
+{
+	// returns a slot lent by PROC_pool_enter_m13()
+	// (its deque is empty once its distribution has been waited on; anything left in it is still stolen by workers)
+
+	proc_pool_self_m13 = NULL;
+	pthread_mutex_lock_m13(&pool->mutex);
+	slot->external = FALSE_m13;
+	slot->active = FALSE_m13;
+	pthread_mutex_unlock_m13(&pool->mutex);
+
+	return;
+}
+
+
+static void	PROC_pool_limit_m13(PROC_POOL_m13 *pool, si4 limit, si4 delta)
+{
+	si4	i, prev;
+
+
+	// counts an outermost distribution's job in (delta == 1: submitted) or out (delta == -1: finished) under its requested limit
+	// the global limit is the largest limit with jobs outstanding, so concurrent distributions don't override each other,
+	// & a distribution's limit holds until its last job finishes (it may not wait on them itself)
+	// only a limit gaining its first job or losing its last rescans (under the pool mutex: rescans see every count change before them)
+
+	prev = atomic_fetch_add(&pool->limit_jobs[limit], delta);
+	if (prev + delta != 0 && prev != 0)
+		return;
+
+	pthread_mutex_lock_m13(&pool->mutex);
+	for (i = PROC_POOL_WORKERS_MAX_m13; i; --i)
+		if (pool->limit_jobs[i] > 0)
+			break;
+	pool->max_active = (i) ? i : pool->default_active;
+	PROC_pool_runner_m13(pool);  // (limit raised: queued jobs may now run)
+	pthread_mutex_unlock_m13(&pool->mutex);
+
+	return;
+}
+
+
+static void	PROC_pool_notify_m13(void)
+{
+	PROC_POOL_m13	*pool;
+
+
+	// a threaded job finished: bump the completion sequence & wake waiters (see PROC_pool_wait_m13())
+	// the mutex is only taken when someone is waiting: the waiter registers before checking the sequence, & this
+	// side bumps the sequence before checking registration, so (sequentially consistent atomics) one of the two sees the other
+
+	pool = &proc_pool_m13;
+	++pool->done_seq;
+	if (pool->n_waiters) {
+		pthread_mutex_lock_m13(&pool->mutex);
+		pthread_cond_broadcast_m13(&pool->done_cond);
+		pthread_mutex_unlock_m13(&pool->mutex);
+	}
+
+	return;
+}
+
+
+static PROC_JOB_m13	*PROC_pool_pop_m13(PROC_POOL_WORKER_m13 *deque, tern steal)
+{
+	PROC_JOB_m13	*job;
+
+
+	// owner pops the newest job (bottom: cache-warm, & a worker's own sub-jobs), thieves take the oldest (top: typically
+	// the largest remaining share of a fan-out); returns NULL if the deque is empty
+
+	if (deque->bottom == deque->top)  // empty (checked before locking: idle workers scan every deque)
+		return(NULL);
+
+	pthread_mutex_lock_m13(&deque->mutex);
+	if (deque->bottom == deque->top)
+		job = NULL;
+	else if (steal == TRUE_m13)
+		job = deque->jobs[deque->top++ & (deque->size - 1)];
+	else
+		job = deque->jobs[--deque->bottom & (deque->size - 1)];
+	pthread_mutex_unlock_m13(&deque->mutex);
+
+	return(job);
+}
+
+
+static void	PROC_pool_priority_m13(PROC_POOL_WORKER_m13 *self, si4 priority)
+{
+	si4			os_priority;
+#ifdef MACOS_m13
+	struct sched_param	sched_params;
+#endif
+
+
+	// applies a job's priority to the worker running it (the job's thread as far as the job is concerned)
+	// default priority restores the worker's starting priority, as a new thread would have inherited it
+
+	if (priority == PROC_DEFAULT_PRIORITY_m13)
+		os_priority = self->base_priority;
+	else
+		os_priority = PROC_os_priority_m13(priority);
+	if (os_priority == self->priority)
+		return;
+
+	#ifdef LINUX_m13
+	// lowering nice needs CAP_SYS_NICE: unprivileged requests above the starting priority fail & are ignored,
+	// as for launched threads (PROC_job_init_m13()); but a worker niced ABOVE its start (e.g. by a low priority job)
+	// can't come back down - it finishes what it has & retires, & the pool replaces it as needed
+	if (setpriority(PRIO_PROCESS, (id_t) self->_id, os_priority) == 0)
+		self->priority = os_priority;
+	else if (os_priority < self->priority && self->priority > self->base_priority)
+		self->retire = TRUE_m13;
+	#endif
+
+	#ifdef MACOS_m13
+	sched_params.sched_priority = os_priority;
+	if (pthread_setschedparam(pthread_self(), SCHED_OTHER, &sched_params) == 0)
+		self->priority = os_priority;
+	#endif
+
+	#ifdef WINDOWS_m13
+	if (SetThreadPriority(GetCurrentThread(), os_priority))  // nonzero indicates success in Windows
+		self->priority = os_priority;
+	#endif
+
+	return;
+}
+
+
+static tern	PROC_pool_push_m13(PROC_POOL_WORKER_m13 *deque, PROC_JOB_m13 *job)
+{
+	ui4		i, n_jobs, new_size;
+	PROC_JOB_m13	**new_jobs;
+
+
+	// adds a job at the bottom (owner's end) of a deque, doubling the ring if full
+	// returns TRUE_m13 on success, FALSE_m13 if the ring can't grow
+
+	pthread_mutex_lock_m13(&deque->mutex);
+	n_jobs = deque->bottom - deque->top;
+	if (n_jobs == deque->size) {
+		new_size = (deque->size) ? deque->size << 1 : PROC_POOL_DEQUE_SIZE_m13;
+		new_jobs = (PROC_JOB_m13 **) malloc((size_t) new_size * sizeof(PROC_JOB_m13 *));
+		if (new_jobs == NULL) {
+			pthread_mutex_unlock_m13(&deque->mutex);
+			return(FALSE_m13);
+		}
+		for (i = deque->top; i != deque->bottom; ++i)  // rehash into the new ring (indices kept: fork marks refer to them)
+			new_jobs[i & (new_size - 1)] = deque->jobs[i & (deque->size - 1)];
+		free((void *) deque->jobs);
+		deque->jobs = new_jobs;
+		deque->size = new_size;
+	}
+	deque->jobs[deque->bottom & (deque->size - 1)] = job;
+	++deque->bottom;
+	pthread_mutex_unlock_m13(&deque->mutex);
+
+	return(TRUE_m13);
+}
+
+
+static void	PROC_pool_retire_m13(PROC_POOL_m13 *pool, PROC_POOL_WORKER_m13 *self)
+{
+	// worker leaving the pool (pool mutex held; worker's deque is empty)
+	// if the pool is now short of workers for what's queued, a replacement is started
+
+	self->active = FALSE_m13;
+	--pool->n_workers;
+	PROC_pool_runner_m13(pool);
+
+	return;
+}
+
+
+static tern	PROC_pool_runner_m13(PROC_POOL_m13 *pool)
+{
+	si4	awake;
+
+
+	// makes sure queued jobs will be run, within the global concurrency limit (pool mutex held)
+	// wakes an idle worker; starts another if idle workers don't cover the queue & awake workers are under the limit
+	// (at the limit, running workers take queued jobs as they finish theirs)
+	// returns FALSE_m13 if jobs are queued but no worker is awake or can be started
+
+	if (pool->n_queued <= 0)
+		return(TRUE_m13);
+	if (pool->n_idle) {
+		pthread_cond_signal_m13(&pool->work_cond);
+		if (pool->n_idle >= pool->n_queued)
+			return(TRUE_m13);
+	}
+	awake = pool->n_workers - pool->n_idle - pool->n_blocked;  // running jobs, or about to
+	if (awake < pool->max_active)
+		if (PROC_pool_spawn_m13(pool) == TRUE_m13)
+			return(TRUE_m13);
+
+	return((awake + pool->n_idle) ? TRUE_m13 : FALSE_m13);
+}
+
+
+static PROC_POOL_WORKER_m13	*PROC_pool_slot_m13(PROC_POOL_m13 *pool)
+{
+	si4			i;
+	PROC_POOL_WORKER_m13	*slot;
+
+
+	// claims a free worker slot (pool mutex held); returns NULL if every slot is in use
+
+	for (i = 0; i < pool->top_slot; ++i)
+		if (pool->workers[i].active != TRUE_m13)
+			break;
+	if (i == PROC_POOL_WORKERS_MAX_m13)
+		return(NULL);
+	slot = pool->workers + i;
+	slot->active = TRUE_m13;
+	slot->retire = FALSE_m13;
+	if (i == pool->top_slot)
+		++pool->top_slot;
+
+	return(slot);
+}
+
+
+static tern	PROC_pool_spawn_m13(PROC_POOL_m13 *pool)
+{
+	si4			err;
+	PROC_POOL_WORKER_m13	*worker;
+#if defined MACOS_m13 || defined LINUX_m13
+	pthread_t		thread;
+	pthread_attr_t		attributes;
+#endif
+#ifdef WINDOWS_m13
+	pthread_t_m13		thread;
+#endif
+
+
+	// starts a worker in a free slot (pool mutex held)
+	// returns TRUE_m13 on success, FALSE_m13 if every slot is in use or the thread can't be created
+
+	worker = PROC_pool_slot_m13(pool);
+	if (worker == NULL)
+		return(FALSE_m13);
+
+	// launch detached thread (priority & name are set per job)
+#if defined MACOS_m13 || defined LINUX_m13
+	pthread_attr_init(&attributes);
+	pthread_attr_setdetachstate(&attributes, PTHREAD_CREATE_DETACHED);
+	err = pthread_create(&thread, &attributes, PROC_pool_worker_m13, (void *) worker);
+	pthread_attr_destroy(&attributes);  // (destroy or memory leak)
+#endif
+#ifdef WINDOWS_m13
+	thread = (HANDLE) _beginthreadex(NULL, 0, (_beginthreadex_proc_type) PROC_pool_worker_m13, (void *) worker, 0, NULL);
+	if (thread == NULL) {
+		err = -1;
+	} else {
+		CloseHandle(thread);  // detach
+		err = 0;
+	}
+#endif
+	if (err) {
+		worker->active = FALSE_m13;
+		return(FALSE_m13);
+	}
+	++pool->n_workers;
+
+	return(TRUE_m13);
+}
+
+
+static tern	PROC_pool_submit_m13(PROC_JOB_m13 *job)
+{
+	PROC_POOL_m13		*pool;
+	PROC_POOL_WORKER_m13	*deque;
+
+
+	// hands a threaded job to the pool (the pool equivalent of PROC_job_launch_m13(), for PROC_jobs_distribute_m13())
+	// job is RUNNING (in flight) from submission: PROC_job_init_m13() sets it again when a worker picks it up
+	// jobs go on the submitting thread's deque if it has one (pool workers, & distribution callers - see PROC_pool_enter_m13()),
+	// otherwise on the shared deque
+	// returns TRUE_m13 on success, FALSE_m13 on failure
+
+	pool = PROC_pool_get_m13();
+	if (pool) {
+		job->_pid = gettid_m13();
+		job->parent_behavior = G_current_behavior_m13();  // snapshot: inherited as the job's base behavior (as PROC_job_launch_m13())
+		job->status = PROC_THREAD_RUNNING_m13;
+		deque = (proc_pool_self_m13) ? proc_pool_self_m13 : &pool->shared;
+		if (job->pool_limit)  // counted before it can be taken (& finished)
+			PROC_pool_limit_m13(pool, job->pool_limit, 1);
+
+		pthread_mutex_lock_m13(&pool->mutex);
+		++pool->n_queued;  // before the push: takers decrement after taking
+		if (PROC_pool_push_m13(deque, job) == TRUE_m13) {
+			// a job on the submitter's own deque always has a runner: the submitter helps with it while waiting
+			if (PROC_pool_runner_m13(pool) == TRUE_m13 || deque != &pool->shared) {
+				pthread_mutex_unlock_m13(&pool->mutex);
+				return(TRUE_m13);
+			}
+			PROC_pool_pop_m13(deque, FALSE_m13);  // no worker to take it (so none can have): take it back
+		}
+		--pool->n_queued;
+		pthread_mutex_unlock_m13(&pool->mutex);
+		if (job->pool_limit)
+			PROC_pool_limit_m13(pool, job->pool_limit, -1);
+	}
+
+	// no pool, or no worker available: job gets its own thread
+	if (PROC_job_launch_m13(job) == FALSE_m13)
+		return(FALSE_m13);
+	while (job->status == PROC_THREAD_WAITING_m13)  // wait for status change in thread (the distribution throttle would relaunch a WAITING job)
+		nap_m13("1 us");  // don't peg cpu on this
+
+	return(TRUE_m13);
+}
+
+
+static PROC_JOB_m13	*PROC_pool_take_m13(PROC_POOL_m13 *pool, PROC_POOL_WORKER_m13 *self)
+{
+	si4			i, n_slots, start;
+	PROC_JOB_m13		*job;
+	PROC_POOL_WORKER_m13	*victim;
+
+
+	// next job for a worker: its own deque first, then jobs submitted from outside the pool, then steal from other workers
+	// returns NULL if nothing is queued
+
+	if (pool->n_queued <= 0)
+		return(NULL);
+
+	job = PROC_pool_pop_m13(self, FALSE_m13);
+	if (job == NULL)
+		job = PROC_pool_pop_m13(&pool->shared, TRUE_m13);
+	if (job == NULL) {
+		n_slots = pool->top_slot;
+		start = (si4) (self - pool->workers) + 1;  // start past self: spreads thieves across victims
+		for (i = 0; i < n_slots; ++i) {
+			victim = pool->workers + ((start + i) % n_slots);
+			if (victim == self)
+				continue;
+			if ((job = PROC_pool_pop_m13(victim, TRUE_m13)) != NULL)
+				break;
+		}
+	}
+	if (job)
+		--pool->n_queued;
+
+	return(job);
+}
+
+
+static void	PROC_pool_wait_m13(ui8 seq, si8 wake_uutc)
+{
+	tern			blocked;
+	PROC_POOL_m13		*pool;
+	PROC_POOL_WORKER_m13	*self;
+
+
+	// completion wait step: runs one of the caller's own queued jobs if it has any (see PROC_pool_help_m13()), otherwise
+	// sleeps until a threaded job finishes after the completion sequence read as seq (see PROC_pool_notify_m13())
+	// callers rescan their jobs on return (the wake may be for another caller's job)
+	// a thread going to sleep hands its run slot back, so queued work elsewhere gets its core
+	// (timed: backstop for job statuses set outside PROC_job_init_m13(), which don't notify)
+	// wake_uutc: latest wake time (callers with their own deadline or backstop); zero == PROC_POOL_WAIT_BACKSTOP_US_m13 from now
+
+	pool = PROC_pool_get_m13();
+	if (pool == NULL) {
+		nap_m13("100 us");  // no pool: poll
+		return;
+	}
+
+	self = proc_pool_self_m13;
+	if (self)
+		if (PROC_pool_help_m13(pool, self) == TRUE_m13)
+			return;
+
+	pthread_mutex_lock_m13(&pool->mutex);
+	++pool->n_waiters;
+	if (pool->done_seq == seq) {
+		blocked = FALSE_m13;  // holding a run slot: a worker's job, or a job its caller runs in place on an external slot
+		if (self)
+			if (self->external != TRUE_m13 || self->helping)
+				blocked = TRUE_m13;
+		if (blocked == TRUE_m13) {
+			if (self->external != TRUE_m13)
+				++pool->n_blocked;
+			--pool->n_active;
+			PROC_pool_runner_m13(pool);
+		}
+		if (wake_uutc == 0)
+			wake_uutc = G_current_uutc_m13() + PROC_POOL_WAIT_BACKSTOP_US_m13;
+		pthread_cond_timedwait_m13(&pool->done_cond, &pool->mutex, wake_uutc);
+		if (blocked == TRUE_m13) {
+			if (self->external != TRUE_m13)
+				--pool->n_blocked;
+			++pool->n_active;  // a resumed job can't be held back: may briefly exceed the limit
+		}
+	}
+	--pool->n_waiters;
+	pthread_mutex_unlock_m13(&pool->mutex);
+
+	return;
+}
+
+
+static pthread_rval_m13	PROC_pool_worker_m13(void *arg)
+{
+	tern			retire;
+	si4			err, limit;
+	PROC_JOB_m13		*job;
+	PROC_POOL_m13		*pool;
+	PROC_POOL_WORKER_m13	*self;
+#ifdef MACOS_m13
+	si4			policy;
+	struct sched_param	sched_params;
+#endif
+
+
+	// pool worker thread: runs jobs until it's surplus to the pool, sleeping while none are queued
+	// each job goes through PROC_job_init_m13() exactly as on a launched thread (thread list entry, inherited behavior,
+	// G_thread_exit_m13() cleanup), so to the job, the worker is its thread
+	// (no function stack push here: G_thread_exit_m13() releases this thread's function stack after every job)
+
+	self = (PROC_POOL_WORKER_m13 *) arg;
+	pool = &proc_pool_m13;
+	proc_pool_self_m13 = self;
+	self->_id = gettid_m13();
+
+	// starting priority (inherited from the spawning thread)
+	#ifdef LINUX_m13
+	self->base_priority = getpriority(PRIO_PROCESS, (id_t) self->_id);
+	#endif
+	#ifdef MACOS_m13
+	pthread_getschedparam(pthread_self(), &policy, &sched_params);
+	self->base_priority = sched_params.sched_priority;
+	#endif
+	#ifdef WINDOWS_m13
+	self->base_priority = GetThreadPriority(GetCurrentThread());
+	#endif
+	self->priority = self->base_priority;
+
+	while (1) {
+		job = NULL;
+		if (++pool->n_active <= pool->max_active) {  // run slot under the global concurrency limit
+			job = PROC_pool_take_m13(pool, self);
+			if (job) {
+				PROC_pool_priority_m13(self, job->priority);
+				self->fork_mark = self->bottom;  // anything left below is not this job's to help with
+				limit = job->pool_limit;  // (the job may be freed once it finishes)
+				PROC_job_init_m13((void *) job);
+				if (limit)
+					PROC_pool_limit_m13(pool, limit, -1);
+			}
+		}
+		--pool->n_active;
+		if (job) {
+			if (self->retire == TRUE_m13 && self->bottom == self->top) {  // (own sub-jobs run first)
+				pthread_mutex_lock_m13(&pool->mutex);
+				PROC_pool_retire_m13(pool, self);
+				pthread_mutex_unlock_m13(&pool->mutex);
+				break;
+			}
+			continue;
+		}
+
+		// nothing queued (or at the limit): sleep until a submission (surplus workers retire after idling)
+		pthread_mutex_lock_m13(&pool->mutex);
+		if (pool->n_queued > 0 && pool->n_active < pool->max_active) {  // submitted (or slot freed) since the take above
+			pthread_mutex_unlock_m13(&pool->mutex);
+			continue;
+		}
+		++pool->n_idle;
+		err = pthread_cond_timedwait_m13(&pool->work_cond, &pool->mutex, G_current_uutc_m13() + PROC_POOL_IDLE_RETIRE_US_m13);
+		--pool->n_idle;
+		retire = FALSE_m13;
+		if (err == ETIMEDOUT && pool->n_queued == 0 && pool->n_workers > pool->keep_workers) {
+			PROC_pool_retire_m13(pool, self);
+			retire = TRUE_m13;
+		}
+		pthread_mutex_unlock_m13(&pool->mutex);
+		if (retire == TRUE_m13)
+			break;
+	}
+	proc_pool_self_m13 = NULL;
+
+	return((pthread_rval_m13) 0);
+}
+
+
 #ifdef MACOS_m13
 tern	PROC_show_thread_affinity_m13(pthread_t_m13 *thread_p)
 {
@@ -48233,7 +55010,7 @@ tern	PRTY_find_damage_m13(const si1 *file_path, PRTY_BLOCK_m13 **bad_blocks, si4
 			}
 		}
 	} else {
-		body_valid = CRC_validate_m13(bytes + UH_BODY_CRC_START_OFFSET_m13, len - UH_BODY_CRC_START_OFFSET_m13, uh->body_CRC);
+		body_valid = CRC_validate_parallel_m13(bytes + UH_BODY_CRC_START_OFFSET_m13, len - UH_BODY_CRC_START_OFFSET_m13, uh->body_CRC);
 		if (body_valid == FALSE_m13) {
 			if (return_bb == TRUE_m13) {
 				if (n_bb == bb_size) {
@@ -50126,6 +56903,47 @@ ui1	*SHA_hmac_m13(const ui1 *key, si4 key_bytes, const ui1 *data, si8 data_bytes
 }
 
 
+static void	SHA_hmac_pads_m13(const ui1 *key, si4 key_bytes, ui4 *i_state, ui4 *o_state)
+{
+	ui1		k_pad[64], k_hash[SHA_HASH_BYTES_m13];
+	si4		i;
+	SHA_CTX_m13	ctx;
+
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// chaining states after the (key ^ ipad) & (key ^ opad) blocks of SHA_hmac_m13(): every HMAC under one key starts
+	// from these, so an iterated MAC (PBKDF2) hashes the key pads once instead of on every iteration
+
+	if (key_bytes > 64) {  // longer than SHA-256 block size: use hash of key
+		SHA_hash_m13(key, (si8) key_bytes, k_hash);
+		key = k_hash;
+		key_bytes = SHA_HASH_BYTES_m13;
+	}
+
+	memset(k_pad, 0x36, (size_t) 64);
+	for (i = 0; i < key_bytes; ++i)
+		k_pad[i] ^= key[i];
+	SHA_init_m13(&ctx);
+	SHA_transform_m13(&ctx, k_pad);
+	memcpy(i_state, ctx.state, (size_t) SHA_HASH_BYTES_m13);
+
+	memset(k_pad, 0x5c, (size_t) 64);
+	for (i = 0; i < key_bytes; ++i)
+		k_pad[i] ^= key[i];
+	SHA_init_m13(&ctx);
+	SHA_transform_m13(&ctx, k_pad);
+	memcpy(o_state, ctx.state, (size_t) SHA_HASH_BYTES_m13);
+
+	G_secure_erase_m13(k_pad, (size_t) 64);
+	G_secure_erase_m13(k_hash, (size_t) SHA_HASH_BYTES_m13);
+	G_secure_erase_m13(&ctx, sizeof(SHA_CTX_m13));
+
+	return_void_m13;
+}
+
+
 #ifdef HW_CRYPTO_m13
 
 static const ui4	SHA_hw_k_m13[64] = {
@@ -50479,11 +57297,260 @@ ui1	*SHA_pbkdf2_m13(const ui1 *pw, si4 pw_bytes, const ui1 *salt, si4 salt_bytes
 }
 
 
+static void	SHA_pbkdf2_group_m13(SHA_PBKDF2_LANE_m13 *lanes, si4 n_lanes)
+{
+	ui1			salt_block[68], u_bytes[SHA_HASH_BYTES_m13];
+	si4			i, j, l, n;
+	ui4			i_state[SHA_LANES_m13][8], o_state[SHA_LANES_m13][8];
+	ui4			u[SHA_LANES_m13][8], dk[SHA_LANES_m13][8], n_iter[SHA_LANES_m13];
+	SHA_PBKDF2_LANE_m13	*ln;
+
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// lanes (already validated) run SHA_LANES_m13 at a time through SHA_pbkdf2_iterate_m13() on this thread
+
+	for (j = 0; j < n_lanes; j += SHA_LANES_m13) {
+		n = n_lanes - j;
+		if (n > SHA_LANES_m13)
+			n = SHA_LANES_m13;
+		for (l = 0; l < n; ++l) {  // U1 = HMAC(pw, salt || INT_32_BE(1))
+			ln = lanes + j + l;
+			SHA_hmac_pads_m13(ln->pw, ln->pw_bytes, i_state[l], o_state[l]);
+			memcpy(salt_block, ln->salt, (size_t) ln->salt_bytes);
+			salt_block[ln->salt_bytes] = salt_block[ln->salt_bytes + 1] = salt_block[ln->salt_bytes + 2] = 0;
+			salt_block[ln->salt_bytes + 3] = 1;
+			SHA_hmac_m13(ln->pw, ln->pw_bytes, salt_block, (si8) ln->salt_bytes + 4, u_bytes);
+			for (i = 0; i < 8; ++i)
+				dk[l][i] = u[l][i] = ((ui4) u_bytes[i << 2] << 24) | ((ui4) u_bytes[(i << 2) + 1] << 16) | ((ui4) u_bytes[(i << 2) + 2] << 8) | (ui4) u_bytes[(i << 2) + 3];
+			n_iter[l] = ln->iterations - 1;
+		}
+
+		SHA_pbkdf2_iterate_m13(n, i_state, o_state, u, dk, n_iter);
+
+		for (l = 0; l < n; ++l) {
+			ln = lanes + j + l;
+			for (i = 0; i < 8; ++i) {
+				ln->dk[i << 2] = (ui1) (dk[l][i] >> 24);
+				ln->dk[(i << 2) + 1] = (ui1) (dk[l][i] >> 16);
+				ln->dk[(i << 2) + 2] = (ui1) (dk[l][i] >> 8);
+				ln->dk[(i << 2) + 3] = (ui1) dk[l][i];
+			}
+		}
+	}
+
+	G_secure_erase_m13(u_bytes, (size_t) SHA_HASH_BYTES_m13);
+	G_secure_erase_m13(i_state, sizeof(i_state));
+	G_secure_erase_m13(o_state, sizeof(o_state));
+	G_secure_erase_m13(u, sizeof(u));
+	G_secure_erase_m13(dk, sizeof(dk));
+
+	return_void_m13;
+}
+
+
+static pthread_rval_m13	SHA_pbkdf2_group_thread_m13(void *ptr)
+{
+	PROC_JOB_m13		*job;
+	SHA_PBKDF2_GROUP_m13	*group;
+
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// form required by PROC_jobs_distribute_m13(): job->function_arg is the SHA_PBKDF2_GROUP_m13 *
+
+	job = (PROC_JOB_m13 *) ptr;
+	job->status = PROC_THREAD_RUNNING_m13;
+
+	group = (SHA_PBKDF2_GROUP_m13 *) job->function_arg;
+	SHA_pbkdf2_group_m13(group->lanes, group->n_lanes);
+	job->status = PROC_THREAD_SUCCEEDED_m13;
+
+	return_m13(PROC_JOB_STATUS_SET_m13);
+}
+
+
+static void	SHA_pbkdf2_iterate_m13(si4 n_lanes, ui4 (*i_state)[8], ui4 (*o_state)[8], ui4 (*u)[8], ui4 (*dk)[8], const ui4 *n_iter)
+{
+	si4		i, l;
+	ui4		c, max_iter, st[8][SHA_LANES_m13], w[16][SHA_LANES_m13];
+	ui1		*d;
+	tern		hw;
+	SHA_CTX_m13	ctx[SHA_LANES_m13];
+
+	// PBKDF2 inner loop of up to SHA_LANES_m13 independent derivations: lane l advances n_iter[l] iterations of
+	// Un = HMAC(pw, Un-1); dk ^= Un from its key pad states (SHA_hmac_pads_m13()). u & dk are in SHA word order.
+	// With the pads precomputed, the HMAC of a 32 byte U is exactly two compressions with fixed padding. The lanes'
+	// compressions are independent, so the hardware path issues them back to back & the core overlaps one lane's
+	// rounds with the next; the portable path runs several lanes through one lane-sliced compression (a single lane
+	// takes the block path with the scalar compression).
+
+	max_iter = 0;
+	for (l = 0; l < n_lanes; ++l)
+		if (n_iter[l] > max_iter)
+			max_iter = n_iter[l];
+
+	hw = FALSE_m13;
+#ifdef HW_CRYPTO_m13
+	hw = SHA_hw_ready_m13();
+#endif
+	if (hw == TRUE_m13 || n_lanes == 1) {
+		for (l = 0; l < n_lanes; ++l) {  // padding after the 32 message bytes: 64 + 32 bytes hashed => 768 bit length
+			d = ctx[l].data;
+			memset(d + 32, 0, (size_t) 32);
+			d[32] = 0x80;
+			d[62] = 0x03;
+		}
+		for (c = 0; c < max_iter; ++c) {
+			for (l = 0; l < n_lanes; ++l) {  // inner: SHA((key ^ ipad) || Un-1)
+				if (c >= n_iter[l])
+					continue;
+				d = ctx[l].data;
+				for (i = 0; i < 8; ++i, d += 4) {
+					d[0] = (ui1) (u[l][i] >> 24);
+					d[1] = (ui1) (u[l][i] >> 16);
+					d[2] = (ui1) (u[l][i] >> 8);
+					d[3] = (ui1) u[l][i];
+				}
+				memcpy(ctx[l].state, i_state[l], (size_t) SHA_HASH_BYTES_m13);
+				SHA_transform_m13(ctx + l, ctx[l].data);
+			}
+			for (l = 0; l < n_lanes; ++l) {  // outer: SHA((key ^ opad) || inner)
+				if (c >= n_iter[l])
+					continue;
+				d = ctx[l].data;
+				for (i = 0; i < 8; ++i, d += 4) {
+					d[0] = (ui1) (ctx[l].state[i] >> 24);
+					d[1] = (ui1) (ctx[l].state[i] >> 16);
+					d[2] = (ui1) (ctx[l].state[i] >> 8);
+					d[3] = (ui1) ctx[l].state[i];
+				}
+				memcpy(ctx[l].state, o_state[l], (size_t) SHA_HASH_BYTES_m13);
+				SHA_transform_m13(ctx + l, ctx[l].data);
+				for (i = 0; i < 8; ++i)
+					dk[l][i] ^= (u[l][i] = ctx[l].state[i]);
+			}
+		}
+		G_secure_erase_m13(ctx, sizeof(ctx));
+		return;
+	}
+
+	// portable, several lanes: lanes past n_lanes (& lanes that have finished) are carried along but never stored
+	memset(st, 0, sizeof(st));
+	memset(w, 0, sizeof(w));
+	for (c = 0; c < max_iter; ++c) {
+		for (l = 0; l < n_lanes; ++l) {  // inner: SHA((key ^ ipad) || Un-1)
+			for (i = 0; i < 8; ++i) {
+				w[i][l] = u[l][i];
+				st[i][l] = i_state[l][i];
+			}
+			w[8][l] = 0x80000000;
+			for (i = 9; i < 15; ++i)
+				w[i][l] = 0;
+			w[15][l] = 768;
+		}
+		SHA_transform_lanes_m13(st, w);
+		for (l = 0; l < n_lanes; ++l) {  // outer: SHA((key ^ opad) || inner)
+			for (i = 0; i < 8; ++i) {
+				w[i][l] = st[i][l];
+				st[i][l] = o_state[l][i];
+			}
+		}
+		SHA_transform_lanes_m13(st, w);
+		for (l = 0; l < n_lanes; ++l) {
+			if (c >= n_iter[l])
+				continue;
+			for (i = 0; i < 8; ++i)
+				dk[l][i] ^= (u[l][i] = st[i][l]);
+		}
+	}
+	G_secure_erase_m13(st, sizeof(st));
+	G_secure_erase_m13(w, sizeof(w));
+
+	return;
+}
+
+
+tern	SHA_pbkdf2_lanes_m13(SHA_PBKDF2_LANE_m13 *lanes, si4 n_lanes)
+{
+	tern			r_val;
+	si4			i, j, n_groups;
+	PROC_JOB_m13		*jobs;
+	SHA_PBKDF2_GROUP_m13	*groups;
+
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// PBKDF2-HMAC-SHA-256 of independent (password, salt, iterations) lanes, e.g. the per-level masters of a session;
+	// each lane's dk is identical to SHA_pbkdf2_m13() of the same inputs.
+	// The lanes are dealt into groups, one per logical core (at most one group per lane), the groups run on worker
+	// threads, & the lanes of a group are interleaved (SHA_pbkdf2_iterate_m13()). Threading off or a single core
+	// => one group on this thread, so the lanes still share the compression pipeline.
+
+	for (i = 0; i < n_lanes; ++i) {
+		if (lanes[i].salt_bytes > 64) {
+			G_set_error_m13(E_CRYP_m13, "salt too long (max 64 bytes)");
+			return_m13(FALSE_m13);
+		}
+		if (lanes[i].iterations == 0) {
+			G_set_error_m13(E_CRYP_m13, "iterations must be positive");
+			return_m13(FALSE_m13);
+		}
+		if (lanes[i].dk == NULL) {
+			G_set_error_m13(E_CRYP_m13, "derived key buffer required");
+			return_m13(FALSE_m13);
+		}
+	}
+	if (n_lanes < 1)
+		return_m13(TRUE_m13);
+	if (globals_m13->tables->SHA_h0_table == NULL)  // before the workers start (all tables initialized together)
+		SHA_init_tables_m13();
+
+	n_groups = 1;
+	if (n_lanes > 1 && PROC_default_threading_m13(NULL) == TRUE_m13) {
+		n_groups = globals_m13->tables->HW_params.logical_cores;
+		if (n_groups > n_lanes)
+			n_groups = n_lanes;
+	}
+	jobs = NULL;
+	if (n_groups > 1)
+		jobs = (PROC_JOB_m13 *) calloc((size_t) n_groups, sizeof(PROC_JOB_m13) + sizeof(SHA_PBKDF2_GROUP_m13));
+	if (jobs == NULL) {  // one group (or allocation failed): this thread
+		SHA_pbkdf2_group_m13(lanes, n_lanes);
+		return_m13(TRUE_m13);
+	}
+	groups = (SHA_PBKDF2_GROUP_m13 *) (jobs + n_groups);
+
+	for (i = j = 0; i < n_groups; ++i) {  // lanes dealt as evenly as possible
+		groups[i].lanes = lanes + j;
+		groups[i].n_lanes = (n_lanes - j) / (n_groups - i);
+		j += groups[i].n_lanes;
+		jobs[i].name = "SHA_pbkdf2_group_thread_m13";
+		jobs[i].function = SHA_pbkdf2_group_thread_m13;
+		jobs[i].function_arg = (void *) (groups + i);
+		jobs[i].priority = PROC_HIGH_PRIORITY_m13;
+		jobs[i].skip = FALSE_m13;
+	}
+
+	// group jobs write derived keys into the lanes: all must be finished before this thread rederives them
+	// (distribution waits, running queued groups itself meanwhile)
+	r_val = PROC_jobs_distribute_m13(jobs, n_groups, 0, PROC_JOBS_PER_CORE_DEFAULT_m13, TRUE_m13, TRUE_m13);
+	free(jobs);
+	if (r_val == FALSE_m13)  // launch failed: this thread (derivation is deterministic, so lanes a worker finished are just recomputed)
+		SHA_pbkdf2_group_m13(lanes, n_lanes);
+
+	return_m13(TRUE_m13);
+}
+
+
 ui1	*SHA_pbkdf2_resume_m13(const ui1 *pw, si4 pw_bytes, const ui1 *salt, si4 salt_bytes, ui4 from_iter, ui4 to_iter, ui1 *u, ui1 *dk)
 {
 	ui1	salt_block[68];
 	si4	i;
-	ui4	c;
+	ui4	n_iter, i_state[1][8], o_state[1][8], u_w[1][8], dk_w[1][8];
 
 #ifdef FT_DEBUG_m13
 	G_push_function_m13();
@@ -50514,11 +57581,29 @@ ui1	*SHA_pbkdf2_resume_m13(const ui1 *pw, si4 pw_bytes, const ui1 *salt, si4 sal
 		from_iter = 1;
 	}
 
-	// Un = HMAC(pw, Un-1); dk ^= Un
-	for (c = from_iter; c < to_iter; ++c) {
-		SHA_hmac_m13(pw, pw_bytes, u, (si8) SHA_HASH_BYTES_m13, u);
-		for (i = 0; i < SHA_HASH_BYTES_m13; ++i)
-			dk[i] ^= u[i];
+	// Un = HMAC(pw, Un-1); dk ^= Un  (single lane of SHA_pbkdf2_iterate_m13(): key pads hashed once, not per iteration)
+	if (to_iter > from_iter) {
+		SHA_hmac_pads_m13(pw, pw_bytes, i_state[0], o_state[0]);
+		for (i = 0; i < 8; ++i) {
+			u_w[0][i] = ((ui4) u[i << 2] << 24) | ((ui4) u[(i << 2) + 1] << 16) | ((ui4) u[(i << 2) + 2] << 8) | (ui4) u[(i << 2) + 3];
+			dk_w[0][i] = ((ui4) dk[i << 2] << 24) | ((ui4) dk[(i << 2) + 1] << 16) | ((ui4) dk[(i << 2) + 2] << 8) | (ui4) dk[(i << 2) + 3];
+		}
+		n_iter = to_iter - from_iter;
+		SHA_pbkdf2_iterate_m13(1, i_state, o_state, u_w, dk_w, &n_iter);
+		for (i = 0; i < 8; ++i) {
+			u[i << 2] = (ui1) (u_w[0][i] >> 24);
+			u[(i << 2) + 1] = (ui1) (u_w[0][i] >> 16);
+			u[(i << 2) + 2] = (ui1) (u_w[0][i] >> 8);
+			u[(i << 2) + 3] = (ui1) u_w[0][i];
+			dk[i << 2] = (ui1) (dk_w[0][i] >> 24);
+			dk[(i << 2) + 1] = (ui1) (dk_w[0][i] >> 16);
+			dk[(i << 2) + 2] = (ui1) (dk_w[0][i] >> 8);
+			dk[(i << 2) + 3] = (ui1) dk_w[0][i];
+		}
+		G_secure_erase_m13(i_state, sizeof(i_state));
+		G_secure_erase_m13(o_state, sizeof(o_state));
+		G_secure_erase_m13(u_w, sizeof(u_w));
+		G_secure_erase_m13(dk_w, sizeof(dk_w));
 	}
 
 	return_m13(dk);
@@ -50579,19 +57664,125 @@ void	SHA_transform_m13(SHA_CTX_m13 *ctx, const ui1 *data)
 }
 
 
-void	SHA_update_m13(SHA_CTX_m13 *ctx, const ui1 *data, si8 len)
+static void	SHA_transform_lanes_m13(ui4 (*state)[SHA_LANES_m13], ui4 (*w)[SHA_LANES_m13])
 {
-	si8	i;
+	si4	i, l;
+	ui4	m[64][SHA_LANES_m13], v[8][SHA_LANES_m13], t1, t2;
 
 
-	for (i = 0; i < len; ++i) {
-		ctx->data[ctx->datalen] = data[i];
-		ctx->datalen++;
-		if (ctx->datalen == 64) {
-			SHA_transform_m13(ctx, ctx->data);
-			ctx->bitlen += 512;
-			ctx->datalen = 0;
+	// portable compression of SHA_LANES_m13 independent blocks, lane-sliced ([word][lane], message words already
+	// in SHA order): every step is the same operation across the lanes, so the lane loops compile to vector instructions
+	for (i = 0; i < 16; ++i)
+		for (l = 0; l < SHA_LANES_m13; ++l)
+			m[i][l] = w[i][l];
+	for ( ; i < 64; ++i)
+		for (l = 0; l < SHA_LANES_m13; ++l)
+			m[i][l] = SHA_SIG1_m13(m[i - 2][l]) + m[i - 7][l] + SHA_SIG0_m13(m[i - 15][l]) + m[i - 16][l];
+
+	memcpy(v, state, sizeof(v));
+	for (i = 0; i < 64; ++i) {
+		for (l = 0; l < SHA_LANES_m13; ++l) {
+			t1 = v[7][l] + SHA_EP1_m13(v[4][l]) + SHA_CH_m13(v[4][l], v[5][l], v[6][l]) + SHA_K_SRC_m13[i] + m[i][l];
+			t2 = SHA_EP0_m13(v[0][l]) + SHA_MAJ_m13(v[0][l], v[1][l], v[2][l]);
+			v[7][l] = v[6][l];
+			v[6][l] = v[5][l];
+			v[5][l] = v[4][l];
+			v[4][l] = v[3][l] + t1;
+			v[3][l] = v[2][l];
+			v[2][l] = v[1][l];
+			v[1][l] = v[0][l];
+			v[0][l] = t1 + t2;
+		}
+	}
+
+	for (i = 0; i < 8; ++i)
+		for (l = 0; l < SHA_LANES_m13; ++l)
+			state[i][l] += v[i][l];
+
+	return;
+}
+
+
+void	SHA_update_blocks_m13(SHA_CTX_m13 **ctx, const ui1 **data, si4 n_lanes, si8 n_blocks)
+{
+	si4		i, j, l;
+	si8		b;
+	const ui1	*d;
+	ui4		st[8][SHA_LANES_m13], w[16][SHA_LANES_m13];
+	tern		hw;
+
+
+	// multi-buffer update: absorbs n_blocks consecutive 64 byte blocks from data[l] into ctx[l] for each of n_lanes
+	// (<= SHA_LANES_m13) independent messages; every ctx[l]->datalen must be 0 (callers feed whole blocks)
+	// hardware compression is fast enough per lane that the lanes just run in turn; the portable path compresses a
+	// block of every lane at once with the lane-sliced compression
+	hw = FALSE_m13;
+#ifdef HW_CRYPTO_m13
+	hw = SHA_hw_ready_m13();
+#endif
+	if (hw == TRUE_m13 || n_lanes == 1) {
+		for (l = 0; l < n_lanes; ++l) {
+			for (b = 0, d = data[l]; b < n_blocks; ++b, d += 64)
+				SHA_transform_m13(ctx[l], d);
+			ctx[l]->bitlen += (ui8) n_blocks << 9;
+		}
+		return;
+	}
+
+	memset(st, 0, sizeof(st));
+	memset(w, 0, sizeof(w));
+	for (l = 0; l < n_lanes; ++l)
+		for (i = 0; i < 8; ++i)
+			st[i][l] = ctx[l]->state[i];
+	for (b = 0; b < n_blocks; ++b) {
+		for (l = 0; l < n_lanes; ++l) {
+			d = data[l] + (b << 6);
+			for (i = j = 0; i < 16; ++i, j += 4)
+				w[i][l] = ((ui4) d[j] << 24) | ((ui4) d[j + 1] << 16) | ((ui4) d[j + 2] << 8) | (ui4) d[j + 3];
 		}
+		SHA_transform_lanes_m13(st, w);
+	}
+	for (l = 0; l < n_lanes; ++l) {
+		for (i = 0; i < 8; ++i)
+			ctx[l]->state[i] = st[i][l];
+		ctx[l]->bitlen += (ui8) n_blocks << 9;
+	}
+
+	return;
+}
+
+
+void	SHA_update_m13(SHA_CTX_m13 *ctx, const ui1 *data, si8 len)
+{
+	si8	n;
+
+
+	// top up a partial block
+	if (ctx->datalen) {
+		n = 64 - (si8) ctx->datalen;
+		if (n > len)
+			n = len;
+		memcpy(ctx->data + ctx->datalen, data, (size_t) n);
+		ctx->datalen += (ui4) n;
+		data += n;
+		len -= n;
+		if (ctx->datalen < 64)
+			return;
+		SHA_transform_m13(ctx, ctx->data);
+		ctx->bitlen += 512;
+		ctx->datalen = 0;
+	}
+
+	// whole blocks straight from the caller's buffer
+	for (; len >= 64; len -= 64, data += 64) {
+		SHA_transform_m13(ctx, data);
+		ctx->bitlen += 512;
+	}
+
+	// buffer the remainder
+	if (len) {
+		memcpy(ctx->data, data, (size_t) len);
+		ctx->datalen = (ui4) len;
 	}
 
 	return;
@@ -57289,6 +64480,76 @@ si8	flen_m13(void *fp)
 }
 
 
+static FLOCK_ENTRY_m13	*FLOCK_entry_get_m13(FLOCK_LIST_m13 *list)
+{
+	si4		i, n_locks;
+	FLOCK_ENTRY_m13	*lock, *new_locks, **new_lock_ptrs;
+
+
+	// takes an empty entry from the lock list's free list, allocating a block of them if it's empty
+	// caller holds the bucket's shard mutex (lock order: shard mutex, then list mutex)
+	// returns NULL on failure (error set)
+
+	pthread_mutex_lock_m13(&list->mutex);
+
+	if (list->free_locks == NULL) {  // expand list (note: allocated en bloc)
+		// reallocate lock pointers
+		n_locks = list->size + GLOBALS_FLOCK_LIST_SIZE_INCREMENT_m13;
+		new_lock_ptrs = (FLOCK_ENTRY_m13 **) realloc(list->lock_ptrs, (size_t) n_locks * sizeof(FLOCK_ENTRY_m13 *));
+		if (new_lock_ptrs == NULL) {
+			pthread_mutex_unlock_m13(&list->mutex);
+			G_set_error_m13(E_ALLOC_m13, NULL);
+			return(NULL);
+		}
+		list->lock_ptrs = new_lock_ptrs;
+
+		// allocate new locks (calloc: all fields zeroed => new entries read as empty & isems as uninitialized)
+		new_locks = (FLOCK_ENTRY_m13 *) calloc((size_t) GLOBALS_FLOCK_LIST_SIZE_INCREMENT_m13, sizeof(FLOCK_ENTRY_m13));
+		if (new_locks == NULL) {
+			pthread_mutex_unlock_m13(&list->mutex);
+			G_set_error_m13(E_ALLOC_m13, NULL);
+			return(NULL);
+		}
+
+		// assign lock pointers & chain new locks into free list (first allocated at head)
+		new_lock_ptrs = list->lock_ptrs + list->size;  // (list size still old size)
+		for (i = GLOBALS_FLOCK_LIST_SIZE_INCREMENT_m13; i--;) {
+			new_lock_ptrs[i] = new_locks + i;
+			new_locks[i].next = list->free_locks;
+			list->free_locks = new_locks + i;
+		}
+		list->size = n_locks;
+	}
+
+	lock = list->free_locks;
+	list->free_locks = lock->next;
+	lock->next = NULL;
+	++list->n_used;
+
+	pthread_mutex_unlock_m13(&list->mutex);
+
+	return(lock);
+}
+
+
+static void	FLOCK_entry_put_m13(FLOCK_LIST_m13 *list, FLOCK_ENTRY_m13 *lock)
+{
+	// returns an entry (unlinked from its bucket, file_id zeroed) to the lock list's free list
+	// entries are never freed while the library is initialized: FILE_m13 lock caches & thread held-read tables may still
+	// point here, & validate the entry by file_id
+
+	pthread_mutex_lock_m13(&list->mutex);
+
+	lock->next = list->free_locks;
+	list->free_locks = lock;
+	--list->n_used;
+
+	pthread_mutex_unlock_m13(&list->mutex);
+
+	return;
+}
+
+
 static FLOCK_HELD_READS_m13	*FLOCK_held_slot_m13(FLOCK_ENTRY_m13 *lock, tern claim)
 {
 	si4			i;
@@ -57327,15 +64588,16 @@ si4	flock_m13(void *fp, si4 operation, ...)	// varargs(FILE_m13 flags FLOCK_TIME
 {						// varargs(fp == FILE *): const si1 *file_path, const si1 *nap_str (must pass something for nap_str, but can be NULL)
 	tern				is_std, mp;
 	const si1			*path, *nap_str;
-	si4				i, n_locks, std_fd, file_fd;
+	si4				i, bucket, std_fd, file_fd;
 	ui4				own_reads;
-	ui8				file_id, lock_file_id;
+	ui8				file_id;
 	va_list				v_args;
 	pid_t_m13			_id;
 	FILE				*std_fp;
 	FILE_m13			*m13_fp;
+	pthread_mutex_t_m13		*shard_mutex;
 	FLOCK_LIST_m13			*list;
-	FLOCK_ENTRY_m13			*lock, **lock_ptr, *new_locks, **new_lock_ptrs;
+	FLOCK_ENTRY_m13			*lock, **lock_ptr;
 	FLOCK_HELD_READS_m13		*held;
 	
 #ifdef FT_DEBUG_m13
@@ -57456,68 +64718,37 @@ si4	flock_m13(void *fp, si4 operation, ...)	// varargs(FILE_m13 flags FLOCK_TIME
 	if (lock)
 		goto FLOCK_OPERATE_m13;
 
-	// get list mutex
+	// get the file's bucket (shard mutex: lookups, opens, & closes of other files proceed in parallel)
 	list = globals_m13->file_lock_list;
-	pthread_mutex_lock_m13(&list->mutex);  // lock the list
+	bucket = FLOCK_LIST_BUCKET_m13(file_id);
+	shard_mutex = list->shard_mutexes + (bucket & (FLOCK_LIST_SHARDS_m13 - 1));
+	pthread_mutex_lock_m13(shard_mutex);
 	
 	// find lock
-	n_locks = list->top_idx + 1;
-	lock = NULL;
-	lock_ptr = list->lock_ptrs;
-	for (i = n_locks; i--; ++lock_ptr) {
-		lock_file_id = (*lock_ptr)->file_id;
-		if (lock_file_id == file_id) {
-			lock = *lock_ptr;
+	for (lock = list->buckets[bucket]; lock; lock = lock->next)
+		if (lock->file_id == file_id)
 			break;
-		}
-		if (lock)
-			continue;
-		if (lock_file_id == 0)
-			lock = *lock_ptr;
-	}
 	
 	// not in list
-	if (i == -1) {
+	if (lock == NULL) {
 		if (operation & (FLOCK_UNLOCK_m13 | FLOCK_CLOSE_m13)) {  // file to unlock or close is not in list
-			pthread_mutex_unlock_m13(&list->mutex);  // unlock the list
+			pthread_mutex_unlock_m13(shard_mutex);
 			if (is_std == FALSE_m13)
 				m13_fp->lock = NULL;  // clear any stale cached entry
 			return_m13(FLOCK_SUCCESS_m13);
 		}
+		lock = FLOCK_entry_get_m13(list);
 		if (lock == NULL) {
-			if (n_locks == list->size) {  // expand list (note: allocated en bloc)
-				// reallocate lock pointers
-				n_locks += GLOBALS_FLOCK_LIST_SIZE_INCREMENT_m13;
-				new_lock_ptrs = (FLOCK_ENTRY_m13 **) realloc(list->lock_ptrs, (size_t) n_locks * sizeof(FLOCK_ENTRY_m13 *));
-				if (new_lock_ptrs == NULL) {
-					pthread_mutex_unlock_m13(&list->mutex);
-					G_set_error_m13(E_ALLOC_m13, NULL);
-					return_m13(FLOCK_ERR_m13);
-				}
-				list->lock_ptrs = new_lock_ptrs;
-				
-				// allocate new locks (calloc: all fields zeroed => new entries read as empty & isems as uninitialized)
-				new_locks = (FLOCK_ENTRY_m13 *) calloc((size_t) GLOBALS_FLOCK_LIST_SIZE_INCREMENT_m13, sizeof(FLOCK_ENTRY_m13));
-				if (new_locks == NULL) {
-					pthread_mutex_unlock_m13(&list->mutex);
-					G_set_error_m13(E_ALLOC_m13, NULL);
-					return_m13(FLOCK_ERR_m13);
-				}
-
-				// assign lock pointers
-				new_lock_ptrs = list->lock_ptrs + list->size;  // new_lock_ptrs incremented in loop (list_size still old size)
-				for (i = GLOBALS_FLOCK_LIST_SIZE_INCREMENT_m13; i--;)
-					*new_lock_ptrs++ = new_locks++;
-				list->size = n_locks;
-			}
-			lock = list->lock_ptrs[++list->top_idx];
-			// Note: reused slots keep read_cnt.initialized == TRUE_m13 (isem_destroy_m13() preserves the mutex) => isem_init_m13() will not re-init the mutex
+			pthread_mutex_unlock_m13(shard_mutex);
+			return_m13(FLOCK_ERR_m13);  // error set by FLOCK_entry_get_m13()
 		}
+		// Note: reused entries keep read_cnt.initialized == TRUE_m13 (isem_destroy_m13() preserves the mutex) => isem_init_m13() will not re-init the mutex
 
 		// initialize lock
 		if (isem_init_m13(&lock->read_cnt, 0, nap_str, path, ISEM_NO_OWNER_m13, FALSE_m13) == NULL) {  // statically allocated - don't free on destroy
-			pthread_mutex_unlock_m13(&list->mutex);
-			return_m13(FLOCK_ERR_m13);  // error set by isem_init_m13() (claimed slot left empty; trimmed at closes)
+			FLOCK_entry_put_m13(list, lock);
+			pthread_mutex_unlock_m13(shard_mutex);
+			return_m13(FLOCK_ERR_m13);  // error set by isem_init_m13()
 		}
 		lock->file_id = file_id;  // assign lock
 		lock->write_depth = (ui4) 0;
@@ -57528,6 +64759,10 @@ si4	flock_m13(void *fp, si4 operation, ...)	// varargs(FILE_m13 flags FLOCK_TIME
 			lock->open_cnt = (ui4) 0;
 		else
 			lock->open_cnt = (ui4) 1;  // lock operation called without initial call to fopen_m13() => add it here
+
+		// link into bucket (after initialization: entry is complete when found)
+		lock->next = list->buckets[bucket];
+		list->buckets[bucket] = lock;
 	}
 
 	// open (called by fopen_m13)
@@ -57536,7 +64771,9 @@ si4	flock_m13(void *fp, si4 operation, ...)	// varargs(FILE_m13 flags FLOCK_TIME
 	} else if (operation & FLOCK_CLOSE_m13) {  // close (called by fclose_m13)
 		if (lock->open_cnt)  // shouldn't be zero here, but possible
 			--lock->open_cnt;
-		if (lock->open_cnt == 0) {  // last close: unassign lock & mark slot empty (reusable)
+		if (lock->open_cnt == 0) {  // last close: unlink lock & return entry to free list (reusable)
+			for (lock_ptr = list->buckets + bucket; *lock_ptr != lock; lock_ptr = &(*lock_ptr)->next);
+			*lock_ptr = lock->next;
 			isem_destroy_m13(&lock->read_cnt);
 			if (lock->os_fd != -1) {  // closing the dedicated descriptor releases any os lock
 				#if defined MACOS_m13 || defined LINUX_m13
@@ -57551,15 +64788,12 @@ si4	flock_m13(void *fp, si4 operation, ...)	// varargs(FILE_m13 flags FLOCK_TIME
 			pthread_mutex_destroy_m13(&lock->os_mutex);
 			lock->file_id = 0;
 			lock->write_depth = (ui4) 0;
-
-			// trim search extents (scan past hole chain at the top; interior holes reused by the empty slot search)
-			while (list->top_idx >= 0 && list->lock_ptrs[list->top_idx]->file_id == 0)
-				--list->top_idx;
+			FLOCK_entry_put_m13(list, lock);
 		}
 	}
 
-	// release list mutex
-	pthread_mutex_unlock_m13(&list->mutex);
+	// release bucket
+	pthread_mutex_unlock_m13(shard_mutex);
 
 	// cache entry in FILE_m13 (cleared on close)
 	if (is_std == FALSE_m13) {
@@ -57588,7 +64822,7 @@ FLOCK_OPERATE_m13:
 						FLOCK_os_lock_m13(lock, FLOCK_OS_NONE_m13, TRUE_m13, file_fd);
 					pthread_mutex_unlock_m13(&lock->os_mutex);
 				}
-				lock->read_cnt.owner = ISEM_NO_OWNER_m13;
+				isem_chown_m13(&lock->read_cnt, ISEM_NO_OWNER_m13);  // (through the isem: wakes blocked readers & writers)
 			} else {  // not owner - can't unlock
 				return_m13(FLOCK_LOCKED_m13);
 			}
@@ -59279,6 +66513,7 @@ void	isem_chown_m13(isem_t_m13 *isem, pid_t_m13 tid)
 	pthread_mutex_lock_m13(&isem->mutex);
 	
 	isem->owner = tid;
+	isem_wake_m13(isem);
 	
 	pthread_mutex_unlock_m13(&isem->mutex);
 	
@@ -59286,6 +66521,19 @@ void	isem_chown_m13(isem_t_m13 *isem, pid_t_m13 tid)
 }
 
 
+ui8	isem_contentions_m13(isem_t_m13 *isem)
+{
+	// returns the number of blocking calls that had to wait on the isem (since isem_init_m13())
+	// pass NULL for the process-wide total (all isems, including destroyed ones)
+	// does not need mutex or ownership
+
+	if (isem == NULL)
+		return(isem_total_contentions_m13);
+
+	return(isem->contentions);
+}
+
+
 void	isem_dec_m13(isem_t_m13 *isem)
 {
 	// decrements the count (unless already zero)
@@ -59293,8 +66541,11 @@ void	isem_dec_m13(isem_t_m13 *isem)
 	
 	pthread_mutex_lock_m13(&isem->mutex);
 	
-	if (isem->count)
+	if (isem->count) {
 		--isem->count;
+		if (isem->count == 0)  // (only a zero count releases waiters)
+			isem_wake_m13(isem);
+	}
 	
 	pthread_mutex_unlock_m13(&isem->mutex);
 	
@@ -59312,6 +66563,7 @@ void	isem_destroy_m13(isem_t_m13 *isem)
 		return_void_m13;
 	
 	if (isem->free_on_destroy == TRUE_m13) {
+		pthread_cond_destroy_m13(&isem->cond);
 		pthread_mutex_destroy_m13(&isem->mutex);
 		free_m13(isem);
 	} else {
@@ -59320,7 +66572,7 @@ void	isem_destroy_m13(isem_t_m13 *isem)
 		isem->owner = (pid_t_m13) 0;
 		*isem->name = 0;
 		isem->free_on_destroy = UNKNOWN_m13;
-		// leave mutex in in current state of initialization for reuse
+		// leave mutex & condition variable in current state of initialization for reuse
 	}
 		
 	return;
@@ -59338,63 +66590,24 @@ ui4	isem_getcnt_m13(isem_t_m13 *isem)
 
 void	isem_inc_m13(isem_t_m13 *isem)
 {
-	tern			wait_warning;
-	const si1		*owner_name;
-	si8			wait_time_base, wait_time, tmp_time;
-	pid_t_m13		_id;
-	struct timespec		tv;
+	si8		warn_uutc;
+	pid_t_m13	_id;
 
 
 	// if unowned or owner, increments count
 	// if owned & not owner, blocks until it can increment the count
 
-	tv.tv_sec = (si8) 0;
-	if (isem->period)
-		tv.tv_nsec = (si8) isem->period;
-	else
-		tv.tv_nsec = (si8) 10000;  // default (10 us)
-	
-	wait_warning = (G_current_behavior_m13() & SUPPRESS_WARNING_OUTPUT_m13) ? FALSE_m13 : TRUE_m13;
-	if (wait_warning == TRUE_m13)
-		wait_time_base = G_current_uutc_m13();
-
 	isem_lazy_init_m13(isem, __FUNCTION__);
 	
 	_id = gettid_m13();
-	owner_name = NULL;
+	warn_uutc = 0;
 	
 	pthread_mutex_lock_m13(&isem->mutex);
 	
 	while (1) {
 		if (isem->owner == _id || isem->owner == 0)
 			break;
-		
-		pthread_mutex_unlock_m13(&isem->mutex);
-		
-		if (wait_warning == TRUE_m13) {
-			tmp_time = G_current_uutc_m13();
-			wait_time = tmp_time - wait_time_base;
-			if (wait_time >= (si8) 1000000) {  // notify after every second of waiting
-				if (owner_name == NULL)
-					owner_name = PROC_thread_name_m13(isem->owner);
-				if (*isem->name) {
-					if (owner_name)
-						G_warning_message_m13("isem \"%s\" is still owned by %s(id: %lu) ...\n", isem->name, owner_name, isem->owner);
-					else
-						G_warning_message_m13("isem \"%s\" is still owned by thread %lu ...\n", isem->name, isem->owner);
-				} else {
-					if (owner_name)
-						G_warning_message_m13("isem is still owned by %s(id: %lu) ...\n", owner_name, isem->owner);
-					else
-						G_warning_message_m13("isem is still owned by thread %lu ...\n", isem->owner);
-				}
-				wait_time_base = tmp_time;
-			}
-		}
-		
-		nanosleep_m13(&tv);
-
-		pthread_mutex_lock_m13(&isem->mutex);
+		isem_sleep_m13(isem, &warn_uutc);
 	}
 
 	++isem->count;
@@ -59434,9 +66647,11 @@ isem_t_m13	*isem_init_m13(isem_t_m13 *isem, ui4 init_val, const si1 *nap_str, co
 		if (isem == NULL)
 			return(NULL);
 		pthread_mutex_init_m13(&isem->mutex, NULL);
+		pthread_cond_init_m13(&isem->cond, NULL);
 		isem->initialized = TRUE_m13;
 	} else if (isem->initialized != TRUE_m13) {  // initialze passed isem
 		pthread_mutex_init_m13(&isem->mutex, NULL);
+		pthread_cond_init_m13(&isem->cond, NULL);
 		isem->initialized = TRUE_m13;
 	}
 
@@ -59466,6 +66681,8 @@ isem_t_m13	*isem_init_m13(isem_t_m13 *isem, ui4 init_val, const si1 *nap_str, co
 
 	// set count
 	isem->count = init_val;
+	isem->contentions = 0;
+	isem_wake_m13(isem);  // (re-initialized with waiters: they recheck)
 	
 	pthread_mutex_unlock_m13(&isem->mutex);
 	
@@ -59488,6 +66705,7 @@ static void	isem_lazy_init_m13(isem_t_m13 *isem, const si1 *caller)
 	if (atomic_compare_exchange_strong(&isem->initialized, &expected, FALSE_m13)) {  // FALSE_m13 == initializing
 		G_warning_message_m13("%s(): isem not initialized => initializing with defaults (isem_init_m13() sets period, name, & ownership)\n", caller);
 		pthread_mutex_init_m13(&isem->mutex, NULL);
+		pthread_cond_init_m13(&isem->cond, NULL);
 		isem->initialized = TRUE_m13;
 	} else {
 		while (isem->initialized != TRUE_m13)  // winner is initializing
@@ -59500,30 +66718,17 @@ static void	isem_lazy_init_m13(isem_t_m13 *isem, const si1 *caller)
 
 void	isem_own_m13(isem_t_m13 *isem)
 {
-	tern			wait_warning;
-	const si1		*owner_name;
-	si8			wait_time_base, wait_time, tmp_time;
-	pid_t_m13		tid;
-	struct timespec		tv;
+	si8		warn_uutc;
+	pid_t_m13	tid;
 
 
 	// if unowned or owner, takes ownership
 	// if owned & not owner, blocks until it can take ownership
 
-	tv.tv_sec = (si8) 0;
-	if (isem->period)
-		tv.tv_nsec = (si8) isem->period;
-	else
-		tv.tv_nsec = (si8) 10000;  // default (10 us)
-
-	wait_warning = (G_current_behavior_m13() & SUPPRESS_WARNING_OUTPUT_m13) ? FALSE_m13 : TRUE_m13;
-	if (wait_warning == TRUE_m13)
-		wait_time_base = G_current_uutc_m13();
-
 	isem_lazy_init_m13(isem, __FUNCTION__);
 	
 	tid = gettid_m13();
-	owner_name = NULL;
+	warn_uutc = 0;
 
 	pthread_mutex_lock_m13(&isem->mutex);
 
@@ -59534,33 +66739,7 @@ void	isem_own_m13(isem_t_m13 *isem)
 		} else if (tid == isem->owner) {  // aleady owner
 			break;
 		} // else owned & not owner
-		
-		pthread_mutex_unlock_m13(&isem->mutex);
-		
-		if (wait_warning == TRUE_m13) {
-			tmp_time = G_current_uutc_m13();
-			wait_time = tmp_time - wait_time_base;
-			if (wait_time >= (si8) 1000000) {  // notify after every second of waiting
-				if (owner_name == NULL)
-					owner_name = PROC_thread_name_m13(isem->owner);
-				if (*isem->name) {
-					if (owner_name)
-						G_warning_message_m13("isem \"%s\" is still owned by %s(id: %lu) ...\n", isem->name, owner_name, isem->owner);
-					else
-						G_warning_message_m13("isem \"%s\" is still owned by thread %lu ...\n", isem->name, isem->owner);
-				} else {
-					if (owner_name)
-						G_warning_message_m13("isem is still owned by %s(id: %lu) ...\n", owner_name, isem->owner);
-					else
-						G_warning_message_m13("isem is still owned by thread %lu ...\n", isem->owner);
-				}
-				wait_time_base = tmp_time;
-			}
-		}
-		
-		nanosleep_m13(&tv);
-
-		pthread_mutex_lock_m13(&isem->mutex);
+		isem_sleep_m13(isem, &warn_uutc);
 	}
 
 	pthread_mutex_unlock_m13(&isem->mutex);
@@ -59571,67 +66750,29 @@ void	isem_own_m13(isem_t_m13 *isem)
 
 void	isem_setcnt_m13(isem_t_m13 *isem, ui4 count)
 {
-	tern			wait_warning;
-	const si1		*owner_name;
-	si8			wait_time_base, wait_time, tmp_time;
-	pid_t_m13		tid;
-	struct timespec		tv;
+	si8		warn_uutc;
+	pid_t_m13	tid;
 
 
 	// if unowned or owner: set the count
 	// if owned & not owner: blocks until unowned or owner & sets count
-	// if period > 0, it will try once more after a nap
-
-	tv.tv_sec = (si8) 0;
-	if (isem->period)
-		tv.tv_nsec = (si8) isem->period;
-	else
-		tv.tv_nsec = (si8) 10000;  // default (10 us)
-	
-	wait_warning = (G_current_behavior_m13() & SUPPRESS_WARNING_OUTPUT_m13) ? FALSE_m13 : TRUE_m13;
-	if (wait_warning == TRUE_m13)
-		wait_time_base = G_current_uutc_m13();
 
 	isem_lazy_init_m13(isem, __FUNCTION__);
 	
 	tid = gettid_m13();
-	owner_name = NULL;
+	warn_uutc = 0;
 	
 	pthread_mutex_lock_m13(&isem->mutex);
 	
 	while (1) {
 		if (isem->owner == tid || isem->owner == 0)
 			break;
-		
-		pthread_mutex_unlock_m13(&isem->mutex);
-		
-		if (wait_warning == TRUE_m13) {
-			tmp_time = G_current_uutc_m13();
-			wait_time = tmp_time - wait_time_base;
-			if (wait_time >= (si8) 1000000) {  // notify after every second of waiting
-				if (owner_name == NULL)
-					owner_name = PROC_thread_name_m13(isem->owner);
-				if (*isem->name) {
-					if (owner_name)
-						G_warning_message_m13("isem \"%s\" is still owned by %s(id: %lu) ...\n", isem->name, owner_name, isem->owner);
-					else
-						G_warning_message_m13("isem \"%s\" is still owned by thread %lu ...\n", isem->name, isem->owner);
-				} else {
-					if (owner_name)
-						G_warning_message_m13("isem is still owned by %s(id: %lu) ...\n", owner_name, isem->owner);
-					else
-						G_warning_message_m13("isem is still owned by thread %lu ...\n", isem->owner);
-				}
-				wait_time_base = tmp_time;
-			}
-		}
-		
-		nanosleep_m13(&tv);
-
-		pthread_mutex_lock_m13(&isem->mutex);
+		isem_sleep_m13(isem, &warn_uutc);
 	}
 
 	isem->count = count;
+	if (count == 0)
+		isem_wake_m13(isem);
 	
 	pthread_mutex_unlock_m13(&isem->mutex);
 	
@@ -59652,6 +66793,8 @@ void	isem_show_m13(isem_t_m13 *isem)
 	printf_m13("\tcount: %u\n", isem->count);
 	printf_m13("\tperiod: %u (nsec)\n", isem->period);
 	printf_m13("\towner (tid): %lu\n", isem->owner);
+	printf_m13("\twaiters: %u\n", isem->n_waiters);
+	printf_m13("\tcontentions: %lu\n", isem->contentions);
 	printf_m13("\tinitialized: %s\n", STR_tern_m13(isem->initialized, FALSE_m13));
 	printf_m13("\tfree on destroy: %s\n\n", STR_tern_m13(isem->free_on_destroy, FALSE_m13));
 	
@@ -59661,6 +66804,64 @@ void	isem_show_m13(isem_t_m13 *isem)
 }
 
 
+static void	isem_sleep_m13(isem_t_m13 *isem, si8 *warn_uutc)
+{
+	si8		now_uutc, wake_uutc;
+	const si1	*owner_name;
+	pid_t_m13	owner;
+
+
+	// blocking step of the blocking isem functions: the caller holds isem->mutex & found the isem unavailable
+	// sleeps until another thread changes the isem (see isem_wake_m13()) or the backstop passes, & returns with the mutex held
+	// callers recheck their condition on return (wakes are broadcast)
+	// *warn_uutc: zero before a call's first sleep (counts the contention); then the next "still owned" warning time,
+	// or -1 if warnings are suppressed
+
+	now_uutc = G_current_uutc_m13();
+	if (*warn_uutc == 0) {
+		++isem->contentions;
+		++isem_total_contentions_m13;
+		if (G_current_behavior_m13() & SUPPRESS_WARNING_OUTPUT_m13)
+			*warn_uutc = -1;
+		else
+			*warn_uutc = now_uutc + (si8) 1000000;  // notify after every second of waiting
+	}
+	wake_uutc = now_uutc + ISEM_WAIT_BACKSTOP_US_m13;
+	if (*warn_uutc > 0 && *warn_uutc < wake_uutc)
+		wake_uutc = *warn_uutc;
+
+	++isem->n_waiters;
+	pthread_cond_timedwait_m13(&isem->cond, &isem->mutex, wake_uutc);
+	--isem->n_waiters;
+
+	if (*warn_uutc < 0)
+		return;
+	now_uutc = G_current_uutc_m13();
+	if (now_uutc < *warn_uutc)
+		return;
+
+	// warn outside the mutex (thread name lookup takes the thread list mutex)
+	owner = isem->owner;
+	pthread_mutex_unlock_m13(&isem->mutex);
+	owner_name = PROC_thread_name_m13(owner);
+	if (*isem->name) {
+		if (owner_name)
+			G_warning_message_m13("isem \"%s\" is still owned by %s(id: %lu) ...\n", isem->name, owner_name, owner);
+		else
+			G_warning_message_m13("isem \"%s\" is still owned by thread %lu ...\n", isem->name, owner);
+	} else {
+		if (owner_name)
+			G_warning_message_m13("isem is still owned by %s(id: %lu) ...\n", owner_name, owner);
+		else
+			G_warning_message_m13("isem is still owned by thread %lu ...\n", owner);
+	}
+	*warn_uutc = now_uutc + (si8) 1000000;
+	pthread_mutex_lock_m13(&isem->mutex);
+
+	return;
+}
+
+
 tern	isem_tryinc_m13(isem_t_m13 *isem)
 {
 	tern			waited, r_val;
@@ -59792,6 +66993,8 @@ tern	isem_trysetcnt_m13(isem_t_m13 *isem, ui4 count)
 	while (1) {
 		if (isem->owner == tid || isem->owner == 0) {
 			isem->count = count;
+			if (count == 0)
+				isem_wake_m13(isem);
 			r_val = TRUE_m13;
 			break;
 		}
@@ -59917,30 +67120,17 @@ tern	isem_trywait_noinc_m13(isem_t_m13 *isem)
 
 void	isem_wait_m13(isem_t_m13 *isem)
 {
-	tern			wait_warning;
-	const si1		*owner_name;
-	si8			wait_time_base, wait_time, tmp_time;
-	pid_t_m13		tid;
-	struct timespec		tv;
+	si8		warn_uutc;
+	pid_t_m13	tid;
 
 
 	// blocks until unowned or owner & count == 0, sets count == 1
 	// calling thread should decrement count when finished
 
-	tv.tv_sec = (si8) 0;
-	if (isem->period)
-		tv.tv_nsec = (si8) isem->period;
-	else
-		tv.tv_nsec = (si8) 10000;  // default (10 us)
-	
-	wait_warning = (G_current_behavior_m13() & SUPPRESS_WARNING_OUTPUT_m13) ? FALSE_m13 : TRUE_m13;
-	if (wait_warning == TRUE_m13)
-		wait_time_base = G_current_uutc_m13();
-
 	isem_lazy_init_m13(isem, __FUNCTION__);
 	
 	tid = gettid_m13();
-	owner_name = NULL;
+	warn_uutc = 0;
 	
 	pthread_mutex_lock_m13(&isem->mutex);
 
@@ -59948,33 +67138,7 @@ void	isem_wait_m13(isem_t_m13 *isem)
 		if (isem->owner == tid || isem->owner == 0)
 			if (isem->count == 0)
 				break;
-		
-		pthread_mutex_unlock_m13(&isem->mutex);
-		
-		if (wait_warning == TRUE_m13) {
-			tmp_time = G_current_uutc_m13();
-			wait_time = tmp_time - wait_time_base;
-			if (wait_time >= (si8) 1000000) {  // notify after every second of waiting
-				if (owner_name == NULL)
-					owner_name = PROC_thread_name_m13(isem->owner);
-				if (*isem->name) {
-					if (owner_name)
-						G_warning_message_m13("isem \"%s\" is still owned by %s(id: %lu) ...\n", isem->name, owner_name, isem->owner);
-					else
-						G_warning_message_m13("isem \"%s\" is still owned by thread %lu ...\n", isem->name, isem->owner);
-				} else {
-					if (owner_name)
-						G_warning_message_m13("isem is still owned by %s(id: %lu) ...\n", owner_name, isem->owner);
-					else
-						G_warning_message_m13("isem is still owned by thread %lu ...\n", isem->owner);
-				}
-				wait_time_base = tmp_time;
-			}
-		}
-		
-		nanosleep_m13(&tv);
-
-		pthread_mutex_lock_m13(&isem->mutex);
+		isem_sleep_m13(isem, &warn_uutc);
 	}
 
 	isem->count = (ui4) 1;
@@ -59987,29 +67151,16 @@ void	isem_wait_m13(isem_t_m13 *isem)
 
 void	isem_wait_noinc_m13(isem_t_m13 *isem)
 {
-	tern			wait_warning;
-	const si1		*owner_name;
-	si8			wait_time_base, wait_time, tmp_time;
-	pid_t_m13		tid;
-	struct timespec		tv;
+	si8		warn_uutc;
+	pid_t_m13	tid;
 
 
 	// blocks until unowned or owner & count == 0
 
-	tv.tv_sec = (si8) 0;
-	if (isem->period)
-		tv.tv_nsec = (si8) isem->period;
-	else
-		tv.tv_nsec = (si8) 10000;  // default (10 us)
-	
-	wait_warning = (G_current_behavior_m13() & SUPPRESS_WARNING_OUTPUT_m13) ? FALSE_m13 : TRUE_m13;
-	if (wait_warning == TRUE_m13)
-		wait_time_base = G_current_uutc_m13();
-
 	isem_lazy_init_m13(isem, __FUNCTION__);
 	
 	tid = gettid_m13();
-	owner_name = NULL;
+	warn_uutc = 0;
 	
 	pthread_mutex_lock_m13(&isem->mutex);
 
@@ -60017,33 +67168,7 @@ void	isem_wait_noinc_m13(isem_t_m13 *isem)
 		if (isem->owner == tid || isem->owner == 0)
 			if (isem->count == 0)
 				break;
-		
-		pthread_mutex_unlock_m13(&isem->mutex);
-		
-		if (wait_warning == TRUE_m13) {
-			tmp_time = G_current_uutc_m13();
-			wait_time = tmp_time - wait_time_base;
-			if (wait_time >= (si8) 1000000) {  // notify after every second of waiting
-				if (owner_name == NULL)
-					owner_name = PROC_thread_name_m13(isem->owner);
-				if (*isem->name) {
-					if (owner_name)
-						G_warning_message_m13("isem \"%s\" is still owned by %s(id: %lu) ...\n", isem->name, owner_name, isem->owner);
-					else
-						G_warning_message_m13("isem \"%s\" is still owned by thread %lu ...\n", isem->name, isem->owner);
-				} else {
-					if (owner_name)
-						G_warning_message_m13("isem is still owned by %s(id: %lu) ...\n", owner_name, isem->owner);
-					else
-						G_warning_message_m13("isem is still owned by thread %lu ...\n", isem->owner);
-				}
-				wait_time_base = tmp_time;
-			}
-		}
-		
-		nanosleep_m13(&tv);
-
-		pthread_mutex_lock_m13(&isem->mutex);
+		isem_sleep_m13(isem, &warn_uutc);
 	}
 
 	pthread_mutex_unlock_m13(&isem->mutex);
@@ -60052,6 +67177,18 @@ void	isem_wait_noinc_m13(isem_t_m13 *isem)
 }
 
 
+void	isem_wake_m13(isem_t_m13 *isem)
+{
+	// wakes threads blocked on the isem to recheck it (count or ownership changed)
+	// caller holds isem->mutex (called by the isem functions; exported for direct field writers)
+
+	if (isem->n_waiters)
+		pthread_cond_broadcast_m13(&isem->cond);
+
+	return;
+}
+
+
 size_t	malloc_size_m13(void *address)
 {
 	if (address == NULL)
@@ -60911,6 +68048,131 @@ si4	printf_m13(const si1 *fmt, ...)
 }
 
 
+si4	pthread_cond_broadcast_m13(pthread_cond_t_m13 *cond_p)
+{
+	si4	r_val;
+
+
+#if defined MACOS_m13 || defined LINUX_m13
+	r_val = pthread_cond_broadcast(cond_p);
+#endif
+
+#ifdef WINDOWS_m13
+	WakeAllConditionVariable(cond_p);  // cannot fail
+	r_val = 0;
+#endif
+
+	return(r_val);
+}
+
+
+si4	pthread_cond_destroy_m13(pthread_cond_t_m13 *cond_p)
+{
+	si4	r_val;
+
+
+#if defined MACOS_m13 || defined LINUX_m13
+	r_val = pthread_cond_destroy(cond_p);
+#endif
+
+#ifdef WINDOWS_m13
+	r_val = 0;  // CONDITION_VARIABLEs require no destruction
+#endif
+
+	return(r_val);
+}
+
+
+si4	pthread_cond_init_m13(pthread_cond_t_m13 *cond_p, pthread_condattr_t_m13 *attr_p)
+{
+	si4	r_val;
+
+
+#if defined MACOS_m13 || defined LINUX_m13
+	r_val = pthread_cond_init(cond_p, attr_p);
+#endif
+
+#ifdef WINDOWS_m13
+	InitializeConditionVariable(cond_p);  // attr_p ignored; cannot fail
+	r_val = 0;
+#endif
+
+	return(r_val);
+}
+
+
+si4	pthread_cond_signal_m13(pthread_cond_t_m13 *cond_p)
+{
+	si4	r_val;
+
+
+#if defined MACOS_m13 || defined LINUX_m13
+	r_val = pthread_cond_signal(cond_p);
+#endif
+
+#ifdef WINDOWS_m13
+	WakeConditionVariable(cond_p);  // cannot fail
+	r_val = 0;
+#endif
+
+	return(r_val);
+}
+
+
+si4	pthread_cond_timedwait_m13(pthread_cond_t_m13 *cond_p, pthread_mutex_t_m13 *mutex_p, si8 abs_uutc)
+{
+	si4		r_val;
+#if defined MACOS_m13 || defined LINUX_m13
+	struct timespec	deadline;
+#endif
+#ifdef WINDOWS_m13
+	si8		ms;
+#endif
+
+
+	// as pthread_cond_timedwait(), but the deadline is in uutc (the G_current_uutc_m13() clock == CLOCK_REALTIME, the condition variable default)
+	// returns zero when signaled (or spuriously woken), ETIMEDOUT when the deadline passes
+
+#if defined MACOS_m13 || defined LINUX_m13
+	deadline.tv_sec = (time_t) (abs_uutc / (si8) 1000000);
+	deadline.tv_nsec = (long) ((abs_uutc % (si8) 1000000) * (si8) 1000);
+	r_val = pthread_cond_timedwait(cond_p, mutex_p, &deadline);
+#endif
+
+#ifdef WINDOWS_m13
+	ms = (abs_uutc - G_current_uutc_m13()) / (si8) 1000;
+	if (ms < 0)
+		ms = 0;
+	if (SleepConditionVariableSRW(cond_p, mutex_p, (DWORD) ms, 0))  // zero indicates failure in Windows
+		r_val = 0;
+	else
+		r_val = (GetLastError() == ERROR_TIMEOUT) ? ETIMEDOUT : EINVAL;
+#endif
+
+	return(r_val);
+}
+
+
+si4	pthread_cond_wait_m13(pthread_cond_t_m13 *cond_p, pthread_mutex_t_m13 *mutex_p)
+{
+	si4	r_val;
+
+
+#if defined MACOS_m13 || defined LINUX_m13
+	r_val = pthread_cond_wait(cond_p, mutex_p);
+#endif
+
+#ifdef WINDOWS_m13
+	if (SleepConditionVariableSRW(cond_p, mutex_p, INFINITE, 0))  // exclusive mode (flags == 0), as the mutexes are locked
+		r_val = 0;
+	else
+		r_val = EINVAL;
+#endif
+
+	return(r_val);
+}
+
+
 si4	pthread_equal_m13(pthread_t_m13 t1, pthread_t_m13 t2)
 {
 	// NOTE: this function returns one (1) if t1 & t2 correspond to the same thread, zero (0) if not  (Posix standard)
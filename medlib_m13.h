@@ -179,6 +179,7 @@
 	#include <sys/wait.h>
 	#include <poll.h>
 	#include <semaphore.h>
+	#include <fnmatch.h> // G_file_list_m13() name expansion
 #endif // MACOS_m13 || LINUX_m13
 #ifdef MACOS_m13
 	#include <malloc/malloc.h>
@@ -197,6 +198,7 @@
 	#include <utmp.h>
 	#include <sys/syscall.h>   // add_key()/keyctl() syscalls (session key cache)
 	#include <linux/keyctl.h>  // KEYCTL_* ops (session key cache)
+	#include <sys/eventfd.h>  // PAR_event_fd_m13() completion descriptor
 #endif // LINUX_m13
 #if defined LINUX_m13 || defined WINDOWS_m13
 	#include <malloc.h>
@@ -220,7 +222,7 @@
 	#include "matrix.h"
 #endif // MATLAB_m13
 
-// hardware crypto intrinsics (compile-time capability; runtime selection reads HW_params AES_accel / SHA256_accel)
+// hardware crypto & SIMD intrinsics (compile-time capability; runtime selection reads HW_params AES_accel / SHA256_accel / SIMD_accel / CRC32_accel)
 // per-function target attributes: the hardware paths compile without global -maes/-msha/-march flags,
 // & are only executed when HW_get_crypto_accel_m13() confirmed the instructions exist on this machine
 #if (defined MACOS_m13 || defined LINUX_m13) && (defined __x86_64__ || defined __i386__) && !defined __INTEL_COMPILER
@@ -228,6 +230,9 @@
 	#define HW_CRYPTO_m13
 	#define HW_AES_FN_ATTR_m13	__attribute__((target("aes,sse2")))
 	#define HW_SHA_FN_ATTR_m13	__attribute__((target("sha,sse4.1,ssse3,sse2")))
+	#define HW_CLMUL_FN_ATTR_m13	__attribute__((target("pclmul,sse4.1")))  // CRC folding
+	#define HW_SIMD_m13
+	#define HW_SIMD_FN_ATTR_m13	__attribute__((target("avx2")))  // no "fma": keeps multiply & round-offset adds rounded as the scalar code does
 #endif
 #if (defined MACOS_m13 || defined LINUX_m13) && defined __aarch64__
 	#include <arm_neon.h>
@@ -235,10 +240,14 @@
 	#ifdef MACOS_m13  // Apple silicon compiler targets enable the AES & SHA-2 features by default
 		#define HW_AES_FN_ATTR_m13
 		#define HW_SHA_FN_ATTR_m13
+		#define HW_CLMUL_FN_ATTR_m13
 	#else  // UNVERIFIED (no ARM Linux test machine): generic aarch64 needs the crypto feature enabled per function
 		#define HW_AES_FN_ATTR_m13	__attribute__((target("+crypto")))
 		#define HW_SHA_FN_ATTR_m13	__attribute__((target("+crypto")))
+		#define HW_CLMUL_FN_ATTR_m13	__attribute__((target("+crypto")))  // PMULL (64-bit polynomial multiply) is in the AES feature
 	#endif
+	#define HW_SIMD_m13  // NEON is baseline on aarch64
+	#define HW_SIMD_FN_ATTR_m13
 #endif
 #ifdef DATABASE_m13
 	#include <libpq-fe.h> // postgres header
@@ -936,6 +945,10 @@ typedef struct {
 #define GLOBALS_SESSION_KEY_CACHE_TIMEOUT_MAX_m13		((si4) 7200) // hard cap, clamped in SKC_put_m13() (no path can store longer): re-paying one KDF every 2 hours is cheap; a longer-lived cached key is asking for trouble
 #define GLOBALS_INCREASE_PRIORITY_DEFAULT_m13			TRUE_m13
 #define GLOBALS_BACKGROUND_PROCESSING_DEFAULT_m13		FALSE_m13 // SPEED default: distributed jobs run at their requested (typically high) priority; YES runs them below normal so the OS & foreground apps always win contention
+#define GLOBALS_BLOCK_CACHE_MB_DEFAULT_m13			((si8) 0) // process-wide decoded block cache budget, MB (0 == off; RC field in MB; stored as bytes)
+#define GLOBALS_SHARED_BLOCK_CACHE_MB_DEFAULT_m13		((si8) 0) // host-wide (shared memory) decoded block cache size, MB (0 == off; RC field in MB; stored as bytes)
+#define GLOBALS_SESSION_MANIFEST_DEFAULT_m13			FALSE_m13 // opt-in: sessions are opened from (& closed with an update of) a manifest file in the session directory
+#define GLOBALS_SEGMENT_OVERVIEWS_DEFAULT_m13			FALSE_m13 // opt-in: coarse DM trace range requests are answered from segment overview files, where present
 #define GLOBALS_PROC_GLOBS_LIST_SIZE_INCREMENT_m13		1 // number of processes
 #define GLOBALS_BEHAVIOR_STACK_SIZE_INCREMENT_m13		16 // number of behaviors
 #define GLOBALS_BEHAVIOR_STACK_DEPTH_WARNING_m13		64 // depth at first growth warning (usually indicates a push/pop leak; growth continues regardless)
@@ -1405,6 +1418,7 @@ typedef struct {
 #define LH_EXCLUDE_VID_CHANS_m13		((ui8) 1 << 10) // useful when session directory passed, but don't want video channels
 #define LH_MAP_ALL_TS_CHANS_m13			((ui8) 1 << 11) // useful when time series channels may be added to open session
 #define LH_MAP_ALL_VID_CHANS_m13		((ui8) 1 << 12) // useful when video channels may be added to open session
+#define LH_READ_AHEAD_m13			((ui8) 1 << 13) // after each G_read_session_m13(), hint the kernel to fetch the predicted next slice (sequential viewers & detectors)
 
 #define LH_READ_SLICE_SESS_RECS_m13		((ui8) 1 << 16) // read full record indices file (close file); open data, read universal header, leave open
 #define LH_READ_FULL_SESS_RECS_m13		((ui8) 1 << 17) // read full recordindices & data files, close all files
@@ -1426,11 +1440,14 @@ typedef struct {
 #define LH_READ_FULL_CHAN_RECS_m13		((ui8) 1 << 41) // read full record indices & data files, close all files
 #define LH_MMAP_CHAN_RECS_m13			((ui8) 1 << 42) // allocate, but don't read full file
 #define LH_THREAD_SEG_READS_m13			((ui8) 1 << 43) // set if likely to cross many segment boundaries in read (e.g. one channel, long reads or short segments)
+#define LH_LAZY_SEG_OPEN_m13			((ui8) 1 << 44) // open segments on first read (channel open maps them from Sgmt records only); least recently read segments are freed when over the open file budget
 
 // segment level
 #define LH_SEG_OPEN_m13				((ui8) 1 << 48) // segment has been opened
 #define LH_NO_CPS_PTR_RESET_m13			((ui8) 1 << 49) // caller will update pointers
 #define LH_NO_CPS_CACHING_m13			((ui8) 1 << 50) // set cps_caching parameter to FALSE
+#define LH_THREAD_BLOCK_DECODE_m13		((ui8) 1 << 51) // decode runs of blocks in parallel (e.g. one or two channels, long reads => channel & segment threading can't fill the cores)
+#define LH_DEFER_TS_DECODE_m13			((ui8) 1 << 52) // read compressed time series data only (non-caching CPS); caller decodes into its own buffer with G_decode_time_series_data_m13()
 // (active channels only)
 #define LH_READ_SLICE_SEG_DATA_m13		((ui8) 1 << 56) // read full metadata & indices files, close files; open data, read universal header, leave open
 #define LH_READ_FULL_SEG_DATA_m13		((ui8) 1 << 57) // read full metadata, indices, & data files, close all files
@@ -1665,6 +1682,10 @@ void		FILE_update_m13(void *fp);
 #define PROC_THREAD_SKIPPED_m13			((ui4) 1 << 3)
 #define PROC_THREAD_FINISHED_m13		( PROC_THREAD_SUCCEEDED_m13 | PROC_THREAD_FAILED_m13 | PROC_THREAD_SKIPPED_m13 )
 
+// job function return value: the function published its finish status itself (PROC_job_init_m13() doesn't touch the job after it returns)
+// (any other return: PROC_job_init_m13() publishes it - (pthread_rval_m13) 0 == succeeded, else failed)
+#define PROC_JOB_STATUS_SET_m13			((pthread_rval_m13) (size_t) PROC_THREAD_FINISHED_m13)
+
 #define THREAD_NAME_BYTES_m13		64
 
 
@@ -1691,6 +1712,8 @@ typedef void 	(*sig_handler_t_m13)(si4); // signal handler function pointer
 	typedef pthread_rval_m13 	(*pthread_fn_m13)(void *);
 	typedef	pthread_mutex_t		pthread_mutex_t_m13;
 	typedef	pthread_mutexattr_t	pthread_mutexattr_t_m13;
+	typedef	pthread_cond_t		pthread_cond_t_m13;
+	typedef	pthread_condattr_t	pthread_condattr_t_m13;
 
 // semaphores
 	typedef sem_t			sem_t_m13;
@@ -1708,6 +1731,8 @@ typedef void 	(*sig_handler_t_m13)(si4); // signal handler function pointer
 						// zero-initialized == SRWLOCK_INIT == valid unlocked lock (statically initialized & calloc'd mutexes work without init, as with PTHREAD_MUTEX_INITIALIZER)
 						// not recursive (matches POSIX default mutexes); no abandoned-lock rescue (POSIX has none either); must be released by the acquiring thread
 	typedef	SECURITY_ATTRIBUTES	pthread_mutexattr_t_m13; // accepted for interface parity; ignored (SRWLOCKs take no attributes)
+	typedef	CONDITION_VARIABLE	pthread_cond_t_m13; // pairs with the SRWLOCK mutexes; zero-initialized == CONDITION_VARIABLE_INIT (as with the mutexes)
+	typedef	void *			pthread_condattr_t_m13; // accepted for interface parity; ignored
 
 // semaphores
 	typedef	HANDLE			sem_t_m13;
@@ -1724,17 +1749,26 @@ typedef void 	(*sig_handler_t_m13)(si4); // signal handler function pointer
 // if an isem is owned by another thread, accesses that would increase the count will block
 // (or fail in try functions) until ownership is released or transferred to the calling thread
 
+// blocking functions sleep on the isem's condition variable, woken by count & ownership changes made through
+// the isem functions (direct field writers must call isem_wake_m13() with the mutex held - otherwise waiters
+// see them at the next ISEM_WAIT_BACKSTOP_US_m13 check); try functions nap for the period & check once more
+// each blocking call that had to wait counts as a contention (isem_contentions_m13(): per isem, or process-wide)
+
 // example usage: flock reader count => write request blocks in isem until reader count == 0
 
 #define ISEM_SELF_m13		((pid_t_m13) 0xFFFFFFFFFFFFFFFF)
 #define ISEM_NO_OWNER_m13	((pid_t_m13) 0)
 #define ISEM_NAME_BYTES_m13	30 // short ascii names (size chosen for alignment with subsequent two terns)
+#define ISEM_WAIT_BACKSTOP_US_m13	100000 // longest sleep between checks in blocking functions (backstop for direct field writes)
 
 typedef struct {
 	_Atomic ui4		count;
-	ui4			period; // checking period, in nanoseconds (max ~4.3 secs); 0 indicates no wait in try functions, default (10 us) in non-try functions
+	ui4			period; // try function retry nap, in nanoseconds (max ~4.3 secs); 0 indicates no retry (blocking functions don't nap: see above)
 	_Atomic pid_t_m13	owner; // thread id of owning thread; zero indicates no ownership
 	pthread_mutex_t_m13	mutex;
+	pthread_cond_t_m13	cond; // signaled on count & ownership changes (blocking functions sleep on it)
+	ui4			n_waiters; // threads sleeping on cond (changes only broadcast when nonzero; guarded by mutex)
+	_Atomic ui8		contentions; // blocking calls that had to wait (lock hot spot diagnostics; reset by isem_init_m13())
 	si1 			name[ISEM_NAME_BYTES_m13];
 	_Atomic tern		initialized;
 	tern			free_on_destroy;
@@ -1749,13 +1783,14 @@ typedef struct {
 	const si1		*affinity_str; // if not empty, a cpu set will be created; if cpu_set_p != NULL, the cpu set will be written at that address, if NULL it will remain so (not used in MacOS)
 	cpu_set_t_m13		*cpu_set_p; // if not NULL & affinity_str is empty, it will be used (not used in MacOS)
 	si4			priority; // if not set, system default priority will be used
-	_Atomic ui4		status; // contract enforced by PROC_job_init_m13(): RUNNING set before function runs, finish status guaranteed after return (function may also set these itself)
+	_Atomic ui4		status; // contract enforced by PROC_job_init_m13(): RUNNING set before function runs, finish status guaranteed after return (a function setting its finish status itself returns PROC_JOB_STATUS_SET_m13)
 	pid_t_m13		_id; // thread id [ set by PROC_job_init_m13() ]
 	pid_t_m13		_pid; // parent thread id [ set by PROC_launch_job_m13() ]
 	ui4			parent_behavior; // spawner's behavior code at launch (snapshot) [ set by PROC_job_launch_m13(); pushed as thread's base behavior by PROC_job_init_m13() ]
 	tern			threaded; // TRUE_m13 to run as a thread, FALSE_m13 to run in current thread
 	tern			detached; // if TRUE_m13, thread exits when finished, not joinable
 	tern			skip; // if TRUE_m13, don't run this job (e.g. because data missing)
+	si4			pool_limit; // concurrency limit requested by the job's outermost distribution (zero: nested, or not pooled) [ set by PROC_jobs_distribute_m13() ]
 } PROC_JOB_m13;
 
 // thread trampoline for pthread_create_m13(): carries the spawner's behavior (snapshot at spawn) into the new thread
@@ -1765,6 +1800,52 @@ typedef struct {
 	ui4		behavior;
 } G_THREAD_TRAMPOLINE_m13;
 
+// persistent job pool: PROC_jobs_distribute_m13() hands threaded jobs to long-lived workers instead of creating a thread per job
+// fork-join: nested distributions (session => channel => segment) fork into the same pool under one global concurrency limit,
+// & a job waiting on its sub-jobs runs those still queued itself (sleeping only while others run them)
+#define PROC_POOL_WORKERS_MAX_m13	1024 // worker slots; jobs submitted with every slot busy get their own thread (PROC_job_launch_m13())
+#define PROC_POOL_WORKERS_KEEP_m13	PROC_JOBS_PER_CORE_MAX_m13 // idle workers kept per logical core (beyond these, idle workers retire)
+#define PROC_POOL_DEQUE_SIZE_m13	64 // initial deque capacity (power of 2, doubles as needed)
+#define PROC_POOL_IDLE_RETIRE_US_m13	((si8) 2000000) // idle time before a surplus worker retires
+#define PROC_POOL_WAIT_BACKSTOP_US_m13	((si8) 50000) // completion waits recheck at least this often (job status may be set outside PROC_job_init_m13())
+
+typedef struct {
+	pthread_mutex_t_m13	mutex; // guards the deque (owner pushes & pops the bottom; thieves take from the top)
+	PROC_JOB_m13		**jobs; // ring buffer (allocated on first push)
+	ui4			size; // ring capacity (power of 2)
+	_Atomic ui4		top; // free-running indices: count == bottom - top, slot == index & (size - 1)
+	_Atomic ui4		bottom; // (atomic: thieves check for empty before locking)
+	ui4			fork_mark; // bottom when the job (or distribution) the owner is running forked: below it are others' jobs [ owner only ]
+	tern			active; // slot holds a live worker, or is borrowed [ pool mutex ]
+	tern			external; // slot borrowed by a distribution's caller (a thread outside the pool) [ pool mutex ]
+	si4			helping; // external slot: depth of jobs its caller is running in place (holds a run slot while > 0)
+	tern			retire; // worker exits after its current job (Linux: raised nice could not be undone)
+	si4			base_priority; // OS-level priority (nice on Linux) the worker started with
+	si4			priority; // OS-level priority currently applied to the worker
+	pid_t_m13		_id; // worker thread id
+} PROC_POOL_WORKER_m13;
+
+typedef struct {
+	pthread_mutex_t_m13	mutex; // guards worker slots, idle count, & condition variable waits
+	pthread_cond_t_m13	work_cond; // idle workers wait here for submissions
+	pthread_cond_t_m13	done_cond; // PROC_jobs_wait_m13() & PROC_jobs_distribute_m13() wait here for job completions
+	PROC_POOL_WORKER_m13	shared; // deque for jobs submitted from threads outside the pool (never has a worker)
+	PROC_POOL_WORKER_m13	*workers; // PROC_POOL_WORKERS_MAX_m13 slots (never freed: thieves may scan any slot)
+	_Atomic si4		top_slot; // slots in use (highest index + 1) (atomic: thieves read it without the pool mutex)
+	si4			n_workers; // live workers
+	si4			n_idle; // workers waiting on work_cond
+	si4			n_blocked; // workers asleep in completion waits (their jobs waiting on sub-jobs run by others)
+	si4			keep_workers; // idle workers not retired
+	_Atomic si4		n_active; // threads running pool jobs (workers & helping callers), excluding blocked workers
+	_Atomic si4		max_active; // global concurrency limit: largest limit among outermost distributions with jobs outstanding (see PROC_pool_limit_m13())
+	_Atomic si4		*limit_jobs; // outstanding (queued or running) outermost distribution jobs, by requested limit (1 to PROC_POOL_WORKERS_MAX_m13)
+	si4			default_active; // limit with no outermost distribution outstanding (logical cores x PROC_JOBS_PER_CORE_BASE_m13)
+	_Atomic si4		n_queued; // jobs in all deques (submitted, not yet taken)
+	_Atomic si4		n_waiters; // threads waiting on done_cond
+	_Atomic ui8		done_seq; // incremented as each threaded job completes
+	_Atomic tern		initialized; // NOT_SET_m13: no, FALSE_m13: initializing, TRUE_m13: yes
+} PROC_POOL_m13;
+
 // Prototypes
 // Note: medlib versions of standard pthread functions are prototyped with other standard function versions
 tern			PROC_adjust_open_file_limit_m13(si4 new_limit, tern verbose_flag);
@@ -1774,10 +1855,11 @@ tern			PROC_default_threading_m13(void *lh); // lh is an LH_m13 *
 cpu_set_t_m13		*PROC_generate_cpu_set_m13(const si1 *affinity_str, cpu_set_t_m13 *cpu_set_p);
 pid_t_m13		PROC_id_for_thread_m13(pthread_t_m13 *thread_p);
 tern			PROC_increase_process_priority_m13(tern verbose_flag, si4 sudo_prompt_flag, ...); // varargs (sudo_prompt_flag == TRUE_m13): const si1 *exec_name, sf8 timeout_secs
-tern			PROC_jobs_distribute_m13(PROC_JOB_m13 *jobs, si4 n_jobs, si4 reserved_cores, si4 jobs_per_core, tern thread_jobs, tern wait_jobs);
+tern			PROC_jobs_distribute_m13(PROC_JOB_m13 *jobs, si4 n_jobs, si4 reserved_cores, si4 jobs_per_core, tern thread_jobs, tern wait_jobs); // nested calls (from inside pool jobs) ignore reserved_cores & jobs_per_core: they run within the outermost call's limit
 pthread_rval_m13	PROC_job_init_m13(void *arg);
 tern			PROC_job_launch_m13(PROC_JOB_m13 *job);
 tern			PROC_jobs_wait_m13(PROC_JOB_m13 *jobs, si4 n_jobs);
+si4			PROC_open_file_limit_m13(void);
 tern			PROC_show_thread_affinity_m13(pthread_t_m13 *thread_p);
 void			PROC_show_thread_list_m13(void);
 pthread_t_m13		*PROC_thread_for_id_m13(pid_t_m13 _id);
@@ -1829,6 +1911,24 @@ pid_t_m13		PROC_thread_parent_id_m13(pid_t_m13 _id);
 // compute-bound jobs may run best throttled to physical cores: reserved_cores == logical - physical;
 // jobs_per_core: pass PROC_JOBS_PER_CORE_DEFAULT_m13 for session-adaptive tuning (recommended; starts
 // at PROC_JOBS_PER_CORE_BASE_m13 & converges on the measured optimum over repeated calls))
+//
+// completion is event driven: waits sleep until a job finishes (no status polling), & may be bounded:
+//	PAR_wait_m13() / PAR_wait_all_m13(): one handle / a set (interval: status backstop only, see below)
+//	PAR_wait_any_m13(): index of the first finished handle in a set, with optional timeout
+//	PAR_wait_timed_m13(): one handle, with timeout (UNKNOWN_m13 on timeout)
+// timeouts & intervals are nap_m13() strings (e.g. "50 ms"); NULL timeout == wait indefinitely
+// PAR_wait_any_m13() keeps returning a finished handle until the caller drops it from the set:
+//	while ((i = PAR_wait_any_m13(pis, n, NULL)) >= 0) {
+//		... use pis[i]->r_val ...
+//		PAR_free_m13(&pis[i]);  // sets pis[i] to NULL (or set pis[i] = NULL for caller-owned handles)
+//	}
+// completion callback (optional): set par_info->callback (& callback_arg) before launch; it runs in the job's
+// thread once r_val & error info are captured, just BEFORE the job status is set (the status set is what
+// releases waiters, so the handle is still valid in the callback - but its status still reads running)
+// event loops: PAR_event_fd_m13() returns a descriptor that becomes readable whenever any PAR job finishes
+// (Linux eventfd, MacOS pipe; -1 on Windows or failure) - add it to an epoll/kqueue/poll set, & on wake call
+// PAR_event_clear_m13() then collect finished handles (e.g. PAR_wait_any_m13() with a "0 us" timeout);
+// a finished handle may be freed at once: the library doesn't touch it after its status is set
 
 // Constants
 #define PAR_MAX_ARGS_m13		16 // maximum total arguments
@@ -1838,6 +1938,8 @@ pid_t_m13		PROC_thread_parent_id_m13(pid_t_m13 _id);
 #define PAR_AFFINITY_BYTES_m13		16
 #define PAR_MSG_BYTES_m13		( (PATH_BYTES_m13 << 1) + 128 ) // == E_MAX_MSG_LEN_m13 (defined below)
 #define PAR_DEFAULTS_m13		"defaults"
+#define PAR_WAIT_TIMEOUT_m13		-1 // PAR_wait_any_m13(): timed out before any handle finished
+#define PAR_WAIT_NONE_m13		-2 // PAR_wait_any_m13(): no started handles in the set (nothing to wait for)
 
 // Status Macros (status values defined with PROC constants)
 #define PAR_RUNNING_m13(par_info)	( ((par_info)->job.status == PROC_THREAD_RUNNING_m13) ? TRUE_m13 : FALSE_m13 )
@@ -1866,6 +1968,8 @@ typedef struct {
 	si1		label[THREAD_NAME_BYTES_m13]; // thread name & job description
 	si1		affinity[PAR_AFFINITY_BYTES_m13]; // cpu affinity string (empty => any cpu)
 	si1		sig[PAR_SIG_BYTES_m13]; // argument signature string
+	void		(*callback)(void *par_info, void *callback_arg); // optional completion callback (runs in job thread; see above)
+	void		*callback_arg; // passed to callback
 	tern		variadic; // sig contains '|'
 	tern		allocated; // allocated by PAR library code => freed by PAR_free_m13()
 } PAR_INFO_m13;
@@ -1873,6 +1977,8 @@ typedef struct {
 // Prototypes
 void			*PAR_call_m13(PAR_INFO_m13 *par_info); // executes captured call in calling thread
 tern			PAR_distribute_m13(PAR_INFO_m13 **par_infos, si4 n_infos, si4 reserved_cores, si4 jobs_per_core, tern thread_jobs, tern wait_jobs); // launch prepped handles throttled to cores (args as in PROC_jobs_distribute_m13())
+si8			PAR_event_clear_m13(void); // drains the completion descriptor; returns completions signaled since the last clear (MacOS: up to the pipe's capacity)
+si4			PAR_event_fd_m13(void); // completion descriptor for caller's event loop (created on first call; -1 if unsupported)
 tern			PAR_free_m13(PAR_INFO_m13 **par_info_ptr);
 PAR_INFO_m13		*PAR_init_m13(PAR_INFO_m13 *par_info, const si1 *label, ...); // varargs(label != PAR_DEFAULTS_m13 or NULL): si4 priority, const si1 *affinity, si4 threaded
 PAR_INFO_m13		*PAR_launch_m13(PAR_INFO_m13 *par_info, void *fn, const si1 *sig, ...); // varargs: target function arguments, per sig
@@ -1883,6 +1989,8 @@ tern			PAR_start_m13(PAR_INFO_m13 *par_info); // launch a prepped handle
 pthread_rval_m13	PAR_thread_m13(void *arg);
 tern			PAR_wait_m13(PAR_INFO_m13 *par_info, const si1 *interval);
 tern			PAR_wait_all_m13(PAR_INFO_m13 **par_infos, si4 n_infos, const si1 *interval);
+si4			PAR_wait_any_m13(PAR_INFO_m13 **par_infos, si4 n_infos, const si1 *timeout); // returns index of a finished handle, PAR_WAIT_TIMEOUT_m13, or PAR_WAIT_NONE_m13
+tern			PAR_wait_timed_m13(PAR_INFO_m13 *par_info, const si1 *timeout); // TRUE_m13 succeeded, FALSE_m13 failed, UNKNOWN_m13 timed out
 
 
 
@@ -2405,6 +2513,8 @@ typedef struct {
 	tern				hyperthreading;
 	tern				AES_accel; // hardware AES instructions present (x86 AES-NI / ARMv8 AES); UNKNOWN_m13 until detected
 	tern				SHA256_accel; // hardware SHA-256 instructions present (x86 SHA extensions / ARMv8 SHA-2); UNKNOWN_m13 until detected
+	tern				SIMD_accel; // vector conversion instructions present (x86 AVX2 / ARMv8 NEON); UNKNOWN_m13 until detected
+	tern				CRC32_accel; // carry-less multiply present (x86 PCLMULQDQ & SSE4.1 / ARMv8 PMULL); UNKNOWN_m13 until detected
 	sf8				minimum_speed;
 	sf8				maximum_speed;
 	sf8				current_speed;
@@ -2423,7 +2533,7 @@ typedef struct {
 // Prototypes
 ui4	HW_get_block_size_m13(const si1 *volume_path);
 tern	HW_get_core_info_m13(void);
-tern	HW_get_crypto_accel_m13(void); // AES_accel & SHA256_accel (encryption/hash routines read these to select hardware vs table paths)
+tern	HW_get_crypto_accel_m13(void); // AES_accel, SHA256_accel, SIMD_accel & CRC32_accel (encryption/hash/conversion/CRC routines read these to select hardware vs scalar paths)
 tern	HW_get_endianness_m13(void);
 tern	HW_get_info_m13(void); // fill whole HW_PARAMS_m13 structure
 tern	HW_get_machine_code_m13(void);
@@ -2496,6 +2606,12 @@ typedef struct {
 	si4 	end_seg_num;
 } SLICE_m13;
 
+typedef struct {
+	si8	n_requests; // slices seen
+	si8	last_start_time; // previous request (valid if n_requests > 0)
+	si8	last_end_time;
+} READ_AHEAD_m13;
+
 typedef struct {
 	si8 	start_time;
 	si8 	end_time;
@@ -2550,6 +2666,164 @@ typedef struct { // multiple thread access
 	_Atomic si4				top_idx; // last non-empty Sgmt_RECORD_ENTRY in list
 } Sgmt_RECS_LIST_m13;
 
+// Session Manifest: an optional file in a hidden subdirectory of the session directory (".smft/<session fs name>.smft") holding the channel directory list & byte images
+// of the small files every session open reads (segment metadata & indices, record indices).  The images are the files' on-disk bytes
+// (encrypted regions stay encrypted), so FPS_read_m13() serves a full-file read from an image & then runs its password, CRC, decryption
+// & validation steps on it unchanged.  An image is used only while its file's length & modification time still match the entry (the
+// library dictates lib_mod_time to the file system on every write, so any write invalidates it); the directory list is used only while
+// the session directory's modification time matches (builds write & rename only inside the subdirectory, so they never change that time).
+// Anything that does not match is read from the file system as usual.
+//
+// layout, in file order:  [ SESS_MNFST_HDR_m13 ] [ SESS_MNFST_ENTRY_m13 * (n_dirs + n_files) ] [ images ]
+#define SESS_MNFST_TYPE_STR_m13			"smft" // ascii[4]; file extension only (not a MED level or file type)
+#define SESS_MNFST_DIR_STR_m13			".smft" // manifest subdirectory of the session directory
+#define SESS_MNFST_TAG_m13			((ui8) 0x74666D7373736573) // "sesssmft" (little endian)
+#define SESS_MNFST_VER_MAJOR_m13		((ui1) 1)
+#define SESS_MNFST_VER_MINOR_m13		((ui1) 0)
+#define SESS_MNFST_HDR_CRC_START_OFFSET_m13	12 // header_CRC covers the header from body_CRC on
+#define SESS_MNFST_REL_PATH_BYTES_m13		NAME_BYTES_m13 // entry path, relative to the session directory
+#define SESS_MNFST_MAX_IMAGE_BYTES_m13		((si8) 1 << 20) // larger files are not imaged
+#define SESS_MNFST_MAX_BYTES_m13		((si8) 1 << 30) // images stop being added at this manifest size
+
+typedef struct {
+	ui8	tag; // SESS_MNFST_TAG_m13
+	ui4	header_CRC; // CRC of the header after this field
+	ui4	body_CRC; // CRC of everything after the header
+	ui1	version_major; // SESS_MNFST_VER_MAJOR_m13
+	ui1	version_minor; // SESS_MNFST_VER_MINOR_m13
+	ui1	pad[2];
+	si4	n_dirs; // channel directory entries (file list order), first in the entry array
+	si4	n_files; // image entries (ascending by rel_path), following the directory entries
+	si4	n_segments; // session segment count when built
+	ui8	session_UID;
+	si8	session_dir_mod_time; // session directory modification time before the build listed it (a channel added or removed since => mismatch)
+	si8	build_time;
+} SESS_MNFST_HDR_m13; // 56 bytes
+
+typedef struct {
+	si1	rel_path[SESS_MNFST_REL_PATH_BYTES_m13];
+	si8	mod_time; // file system modification time when imaged (== universal header lib_mod_time if the library wrote it last)
+	si8	len; // file (& image) bytes; 0 for directories
+	si8	offset; // image offset in the manifest; 0 for directories
+	ui4	header_CRC; // the image's universal header CRCs (cross-checked against the image when served)
+	ui4	body_CRC;
+} SESS_MNFST_ENTRY_m13;
+
+typedef struct SESS_MNFST_m13 {
+	si1			sess_path[PATH_BYTES_m13]; // session directory the manifest was read from (full path)
+	ui1			*data; // whole manifest file
+	SESS_MNFST_HDR_m13	*header; // points into data
+	SESS_MNFST_ENTRY_m13	*dirs; // points into data
+	SESS_MNFST_ENTRY_m13	*files; // points into data
+	tern			dirs_valid; // session directory unchanged since the build => directory list can replace a listing
+	_Atomic tern		stale; // an image failed validation, or the library wrote a session file => rebuild on session close
+} SESS_MNFST_m13;
+
+// Segment Overview: an optional file beside a time series segment's data ("<segment fs name>.tovw") holding minimum, maximum & mean
+// pyramids of the segment's samples at power-of-two decimations.  Level 0 bins hold OVW_BASE_BIN_SAMPLES_m13 samples & each level
+// above merges bin pairs.  Bins run in segment sample order (discontinuities are not bin boundaries, as in DM binterpolation).  An
+// overview is used only while the data file's length & modification time match its header.  Encrypted time series data get no
+// overview (the envelope would be stored in the clear).  Built by G_build_overview_m13() / G_build_overviews_m13().
+//
+// layout, in file order:  [ OVW_HDR_m13 ] [ OVW_LEVEL_m13 * n_levels ] [ per level: si4 minima[n_bins], si4 maxima[n_bins], sf4 means[n_bins] ]
+#define OVW_TYPE_STR_m13			"tovw" // ascii[4]; file extension only (not a MED level or file type)
+#define OVW_TAG_m13				((ui8) 0x77766F746D676573) // "segmtovw" (little endian)
+#define OVW_VER_MAJOR_m13			((ui1) 1)
+#define OVW_VER_MINOR_m13			((ui1) 0)
+#define OVW_HDR_CRC_START_OFFSET_m13		12 // header_CRC covers the header from body_CRC on
+#define OVW_BASE_BIN_SAMPLES_m13		((si8) 16) // level 0 decimation
+#define OVW_MIN_TOP_BINS_m13			((si8) 64) // no level with fewer bins
+#define OVW_MAX_LEVELS_m13			32
+#define OVW_BUILD_CHUNK_SAMPLES_m13		((si8) 1 << 20) // samples decoded per read while building (multiple of OVW_BASE_BIN_SAMPLES_m13)
+#define OVW_MIN_DECIMATION_m13			((sf8) 64.0) // DM uses overviews only at this many input samples per output sample, or more
+
+typedef struct {
+	ui8	tag; // OVW_TAG_m13
+	ui4	header_CRC; // CRC of the header after this field
+	ui4	body_CRC; // CRC of everything after the header
+	ui1	version_major; // OVW_VER_MAJOR_m13
+	ui1	version_minor; // OVW_VER_MINOR_m13
+	ui1	pad[2];
+	si4	n_levels;
+	si8	number_of_samples; // segment samples covered
+	si8	data_len; // time series data file length when built
+	si8	data_mod_time; // time series data file modification time when built
+	ui8	segment_UID;
+	si8	build_time;
+} OVW_HDR_m13; // 64 bytes
+
+typedef struct {
+	si8	bin_samples; // samples per bin (last bin of a level may be partial)
+	si8	n_bins;
+	si8	offset; // file offset of the level's minima; maxima & means follow
+} OVW_LEVEL_m13;
+
+typedef struct OVW_m13 {
+	ui1		*data; // whole overview file
+	OVW_HDR_m13	*header; // points into data
+	OVW_LEVEL_m13	*levels; // points into data
+} OVW_m13;
+
+// Zone Map: an optional file beside a time series segment's indices ("<segment fs name>.tzmp") holding per-block statistics, one entry
+// per time series index, so block-level queries (|x| > threshold, variance above a level) can skip blocks without reading or decoding
+// them.  Written at encode time (CPS_DF_ZONE_MAP_m13 + G_write_zone_map_m13()) or built from existing data by G_build_zone_map_m13().
+// Validated as overviews are (data file length & modification time).  Encrypted time series data get no zone map.  Statistics
+// exclude NaN samples (NAN_SI4_m13); a block of NaNs only has n_valid == 0.
+//
+// layout, in file order:  [ ZMAP_HDR_m13 ] [ ZMAP_BLOCK_m13 * n_blocks ]
+#define ZMAP_TYPE_STR_m13			"tzmp" // ascii[4]; file extension only (not a MED level or file type)
+#define ZMAP_TAG_m13				((ui8) 0x706D7A746D676573) // "segmtzmp" (little endian)
+#define ZMAP_VER_MAJOR_m13			((ui1) 1)
+#define ZMAP_VER_MINOR_m13			((ui1) 0)
+#define ZMAP_HDR_CRC_START_OFFSET_m13		12 // header_CRC covers the header from body_CRC on
+#define ZMAP_BUILD_CHUNK_SAMPLES_m13		((si8) 1 << 20) // samples decoded per read while building or querying (whole blocks; at least one)
+#define ZMAP_BF_DISCONTINUITY_m13		((ui4) 1) // block begins a discontinuity
+
+typedef struct {
+	ui8	tag; // ZMAP_TAG_m13
+	ui4	header_CRC; // CRC of the header after this field
+	ui4	body_CRC; // CRC of the block entries
+	ui1	version_major; // ZMAP_VER_MAJOR_m13
+	ui1	version_minor; // ZMAP_VER_MINOR_m13
+	ui1	pad[2];
+	si4	n_blocks;
+	si8	number_of_samples; // segment samples covered
+	si8	data_len; // time series data file length when written
+	si8	data_mod_time; // time series data file modification time when written
+	ui8	segment_UID;
+	si8	build_time;
+} ZMAP_HDR_m13; // 64 bytes
+
+typedef struct {
+	si8	start_time;
+	si8	start_samp_num; // segment relative (as in TS_IDX_m13)
+	si4	n_samps;
+	si4	n_valid; // samples that are not NaN
+	si4	minimum;
+	si4	maximum;
+	ui4	abs_maximum; // unsigned: |NEG_INF_SI4_m13| does not fit in an si4
+	ui4	flags; // ZMAP_BF_ flags
+	sf4	mean;
+	sf4	variance; // population variance
+} ZMAP_BLOCK_m13; // 48 bytes
+
+typedef struct ZMAP_m13 {
+	ui1		*data; // whole zone map file (accumulating encoder: header & blocks, as they will be written)
+	ZMAP_HDR_m13	*header; // points into data
+	ZMAP_BLOCK_m13	*blocks; // points into data
+	si8		max_blocks; // accumulating encoder only: blocks allocated
+} ZMAP_m13;
+
+// query result: a run of samples (exceedances), or of adjacent blocks (variance), session sample numbering
+typedef struct {
+	si8	start_time;
+	si8	end_time;
+	si8	start_samp_num;
+	si8	end_samp_num;
+	si4	seg_num;
+	sf4	value; // peak |x| (exceedances) or largest block variance (variance)
+} ZMAP_INTERVAL_m13;
+
 typedef struct {
 	ui8			UID;
 	si1			path[PATH_BYTES_m13]; // path including file system session directory name
@@ -2561,6 +2835,7 @@ typedef struct {
 	Sgmt_RECS_LIST_m13	*Sgmt_recs_list; // list with one entry for each unique sampling frequency and channel type
 	si1			index_channel_name[NAME_BYTES_m13]; // contains user specified value if needed, open_session_m13() matches to session channel
 	struct CHAN_m13		*index_channel;
+	SESS_MNFST_m13		*manifest; // session manifest, if one was read (freed with the proc globals)
 } CURRENT_SESSION_m13; // PROC_GLOBS_m13 element
 
 typedef struct {
@@ -2825,15 +3100,29 @@ typedef struct FLOCK_ENTRY_m13 { // multiple thread access (tagged: forward refe
 	si4			os_fd; // dedicated descriptor holding the os lock (duplicated => user closes cannot drop it); -1 == none
 	_Atomic si1		os_lock_state; // this process's os lock: FLOCK_OS_NONE/SHARED/EXCLUSIVE_m13
 	ui1			pad_bytes[3]; // future use (bytes will be there anyway)
+	struct FLOCK_ENTRY_m13	*next; // hash chain link (in use, guarded by the bucket's shard mutex) or free list link (empty, guarded by list mutex)
 } FLOCK_ENTRY_m13;
 
+// file lock list: entries hashed by file_id into chained buckets; each bucket is guarded by one of a set of shard mutexes,
+// so lookups, opens, & closes of different files proceed in parallel (lock & unlock of open files use the FILE_m13 lock cache)
+// entries are allocated en bloc & recycled through a free list - never freed while the library is initialized - so a stale
+// cached entry pointer always points at a valid entry (validated against file_id, as before)
+#define FLOCK_LIST_BUCKETS_m13		1024 // hash chains (power of 2)
+#define FLOCK_LIST_BUCKET_BITS_m13	10 // log2(FLOCK_LIST_BUCKETS_m13)
+#define FLOCK_LIST_SHARDS_m13		64 // bucket mutexes (power of 2; bucket b guarded by shard b % FLOCK_LIST_SHARDS_m13)
+
 typedef struct { // multiple thread access
-	pthread_mutex_t_m13		mutex;
-	_Atomic(FLOCK_ENTRY_m13	**)	lock_ptrs; // secondary indirection to FLOCK_ENTRY_m13 *
+	pthread_mutex_t_m13		mutex; // entry allocation & free list (lookups don't take it)
+	_Atomic(FLOCK_ENTRY_m13	**)	lock_ptrs; // secondary indirection to FLOCK_ENTRY_m13 * (every allocated entry, in allocation blocks)
 	_Atomic si4			size; // total allocated locks
-	_Atomic si4			top_idx; // last non-empty lock in list
+	_Atomic si4			n_used; // entries assigned to files
+	FLOCK_ENTRY_m13			*free_locks; // empty entries (reused before allocating more)
+	pthread_mutex_t_m13		shard_mutexes[FLOCK_LIST_SHARDS_m13];
+	FLOCK_ENTRY_m13			*buckets[FLOCK_LIST_BUCKETS_m13]; // hash chain heads
 } FLOCK_LIST_m13;
 
+#define FLOCK_LIST_BUCKET_m13(file_id)	( (si4) (((ui8) (file_id) * (ui8) 0x9E3779B97F4A7C15) >> (64 - FLOCK_LIST_BUCKET_BITS_m13)) ) // fibonacci hash (file_id: device low, inode high)
+
 #define FLOCK_HELD_SLOTS_m13	16
 
 typedef struct { // single thread access (thread-local read-lock bookkeeping)
@@ -2920,11 +3209,17 @@ typedef struct {
 	tern				background_processing; // run distributed jobs (PROC_jobs_distribute_m13()/PAR_distribute_m13()) at low priority (default NO == full speed; overrides per-job priorities when YES)
 	ui1				new_password_required_classes; // OPT-IN creation-time composition rule (bitmask of PW_CLASS_*_m13); 0 == none (default). Length policy is unconditional; this is extra. Reads never consult it.
 	ui1				new_password_min_classes; // OPT-IN: require at least N of the 4 categories present (0 == off). The generally-deployed standard (Active Directory: 3 of 4). Independent of, & AND-ed with, new_password_required_classes.
+	si8				block_cache_bytes; // process-wide decoded block cache budget (0 == off; set with CMP_block_cache_budget_m13() to shrink a live cache)
+	si8				shared_block_cache_bytes; // host-wide decoded block cache size, used by the process that creates the segment (0 == off; Linux only; see CMP_shm_cache_fetch_m13())
+	tern				session_manifest; // open sessions from a session manifest when valid, & rebuild it on session close when absent or stale (see G_read_session_manifest_m13())
+	tern				segment_overviews; // answer coarse DM trace range requests from segment overviews, when present (see G_build_overview_m13())
 	TEST_BYTE_m13			test_byte;
 	_Atomic tern			suspend_stacks;
 } GLOBAL_MISC_m13;
 
 typedef struct CMP_BUFFER_DEPOT_m13 CMP_BUFFER_DEPOT_m13;  // forward decl (full def in the CMP section); GLOBALS holds only a pointer
+typedef struct CMP_BLOCK_CACHE_m13 CMP_BLOCK_CACHE_m13;  // forward decl (full def in the CMP section); GLOBALS holds only a pointer
+typedef struct CMP_SHM_CACHE_m13 CMP_SHM_CACHE_m13;  // forward decl (full def in the CMP section); GLOBALS holds only a pointer
 
 typedef struct {
 	pthread_mutex_t_m13		mutex;
@@ -2945,6 +3240,10 @@ typedef struct {
 	AT_LIST_m13			*AT_list;
 // CMP Buffer Depot (global checkout/return pool of locked, page-aligned scratch bundles)
 	CMP_BUFFER_DEPOT_m13		*CMP_buffer_depot;
+// CMP Block Cache (global decoded blocks, keyed by file UID & block number; budget in miscellaneous.block_cache_bytes)
+	_Atomic(CMP_BLOCK_CACHE_m13 *)	CMP_block_cache; // created on first insert: read without the globals mutex, so published (shards initialized) atomically
+// CMP Shared Memory Cache (this process's attachment to the host-wide decoded block cache; behind CMP_block_cache)
+	CMP_SHM_CACHE_m13		*CMP_shm_cache;
 // Record Filters (global default)
 	si4 				*record_filters; // signed, "NULL terminated" array version of MED record type codes to include or exclude when reading records.
 						  // The terminal entry is NO_TYPE_CODE_m13 (== zero). NULL or no filter codes includes all records (== no filters).
@@ -3445,7 +3744,10 @@ typedef struct {
 	ui4			mmap_block_bytes; // read size for memory mapped files (size data may be on different volumes, or even files within the same volume)
 	ui4			mmap_n_blocks; // file system block in file == number of bits in bitmap
 	ui4			mmap_blocks_read; // when this == mmap_n_blocks, mmap directive flag is unset & full_file_read parameter is set to TRUE_m13
-	ui1			pad[4]; // future use (compiler would pad regardless)
+	tern			mmap_os; // TRUE_m13 if raw_data is an mmap(2) of the file (Linux, read-only opens): no bitmap, released with munmap(), never free()
+	ui1			pad[3]; // future use (compiler would pad regardless)
+	si8			mmap_file_bytes; // file length when raw_data was mapped (mmap_os only); the mapping describes the file at this length (live files are not mapped)
+	si8			mmap_map_offset; // first mapped file page past the header page (mmap_os only; 0 == whole file mapped); pages between are reserved, mapped when read
 } FPS_PARAMS_m13;
 
 #ifdef __cplusplus
@@ -3525,6 +3827,7 @@ si8		FPS_items_for_bytes_m13(FPS_m13 *fps, si8 *n_bytes);
 tern		FPS_mmap_m13(FPS_m13 *fps, tern set);
 si8		FPS_mmap_read_m13(FPS_m13 *fps, si8 n_bytes);
 FPS_m13		*FPS_open_m13(const si1 *path, const si1 *mode_str, si8 n_bytes, void *parent, ...); // vararg(mode_str empty): ui8 fd_flags
+tern		FPS_read_ahead_m13(FPS_m13 *fps, si8 offset, si8 n_bytes);
 FPS_m13 	*FPS_read_m13(FPS_m13 *fps, si8 offset, si8 n_bytes, si8 n_items, ...); // varargs(fps invalid): const si1 *path, const si1 *mode, const si1 *password, void *parent, ui8 lh_flags
 											// varargs(offset == FPS_REL_START/CURR/END): si8 rel_bytes
 tern		FPS_realloc_m13(FPS_m13 *fps, si8 n_bytes);
@@ -3648,6 +3951,10 @@ typedef struct {
 	si1			fs_name[SEG_NAME_BYTES_m13]; // stored here, no segment_name field in universal header
 	si1			uh_name[SEG_NAME_BYTES_m13]; // stored here, no segment_name field in universal header
 	SLICE_m13		slice;
+	OVW_m13			*overview; // segment overview, once read (see G_read_overview_m13())
+	tern			overview_read; // UNKNOWN_m13: not looked for; TRUE_m13: read; FALSE_m13: absent, stale, or invalid
+	ZMAP_m13		*zone_map; // segment zone map, once read (see G_read_zone_map_m13())
+	tern			zone_map_read; // as overview_read
 } SEG_m13;
 #else // __cplusplus
 typedef struct {
@@ -3672,6 +3979,10 @@ typedef struct {
 	si1			fs_name[SEG_NAME_BYTES_m13]; // stored here, no segment_name field in universal header
 	si1			uh_name[SEG_NAME_BYTES_m13]; // stored here, no segment_name field in universal header
 	SLICE_m13		slice;
+	OVW_m13			*overview; // segment overview, once read (see G_read_overview_m13())
+	tern			overview_read; // UNKNOWN_m13: not looked for; TRUE_m13: read; FALSE_m13: absent, stale, or invalid
+	ZMAP_m13		*zone_map; // segment zone map, once read (see G_read_zone_map_m13())
+	tern			zone_map_read; // as overview_read
 } SEG_m13;
 #endif // standard C
 
@@ -3805,6 +4116,7 @@ typedef struct {
 	si8			n_contigua;
 	CONTIGUON_m13		*contigua;
 	SLICE_m13		slice;
+	READ_AHEAD_m13		read_ahead; // LH_READ_AHEAD_m13: recent requests, for predicting the next slice
 } SESS_m13;
 #else // __cplusplus
 typedef struct {
@@ -3825,6 +4137,7 @@ typedef struct {
 	si8			n_contigua;
 	CONTIGUON_m13		*contigua;
 	SLICE_m13		slice;
+	READ_AHEAD_m13		read_ahead; // LH_READ_AHEAD_m13: recent requests, for predicting the next slice
 } SESS_m13;
 #endif // standard C
 
@@ -3838,11 +4151,77 @@ typedef struct {
 	const si1		*password;
 } READ_MED_THREAD_INFO_m13;
 
+// Streaming channel iterator: G_stream_open_m13() / G_stream_next_m13() / G_stream_close_m13()
+// Walks a time series channel in fixed-size chunks of decoded samples with bounded memory. Chunks never span a
+// discontinuity: a chunk ends at the end of its contiguon, & the first chunk of each contiguon has "discontinuity" set.
+// Segments are crossed via the Sgmt records; a segment's data file (& its CPS) is released once the stream has passed
+// it, so memory is about two chunks plus segment indices. With prefetch, the next chunk is read & decoded by a worker
+// thread while the caller processes the current one.
+#define STREAM_CHUNK_SAMPLES_DEFAULT_m13	((si8) 1 << 20)
+
+typedef struct {
+	si4			*samples; // decoded samples (stream owns; valid until the next G_stream_next_m13() call)
+	si8			n_samples; // zero at end of stream
+	si8			start_samp_num; // session-relative sample number of samples[0]
+	si8			end_samp_num;
+	si8			start_time; // uutc of samples[0]
+	si8			end_time; // uutc of last sample
+	si8			contiguon_idx; // index into stream->contigua
+	tern			discontinuity; // first chunk of its contiguon
+	ui1			pad[7];
+} STREAM_CHUNK_m13;
+
+typedef struct {
+	CHAN_m13		*chan;
+	tern			free_chan; // channel opened by G_stream_open_m13() (closed by G_stream_close_m13())
+	tern			prefetch; // read the next chunk in a worker thread
+	tern			prefetch_pending; // job outstanding
+	ui1			pad[5];
+	si8			chunk_samples;
+	si8			n_contigua;
+	CONTIGUON_m13		*contigua; // of the stream slice
+	si8			fill_contiguon_idx; // position of the next chunk to fill
+	si8			fill_samp_num;
+	si4			release_seg_num; // first segment whose data may still be held
+	ui1			pad_2[4];
+	STREAM_CHUNK_m13	chunk; // current chunk
+	STREAM_CHUNK_m13	next_chunk; // prefetched chunk (swapped with chunk)
+	PROC_JOB_m13		job; // prefetch job
+} STREAM_m13;
+
+// Batched epoch reads: G_read_epochs_m13() / G_free_epochs_m13()
+// Extracts many windows (e.g. around records) from an open session in one pass. Windows are sorted & coalesced into spans
+// (overlapping, or separated by less than the merge gap), each span is read with one G_read_session_m13() call (channel
+// threads, one decode per block within a span; a block straddling two spans is decoded by each unless the block cache
+// holds it), & the samples are scattered into an [epoch][channel][sample] array. Rows are padded with NAN_SI4_m13 where a
+// window has no data (spans in recording gaps aren't read); any other read error fails the call.
+#define EPOCHS_MERGE_GAP_DEFAULT_m13		((si8) 1000000) // µs; windows closer than this share a read
+#define EPOCHS_MAX_SPAN_BYTES_DEFAULT_m13	((si8) 1 << 28) // decoded bytes (all active channels) per coalesced read
+
+typedef struct {
+	si8			n_epochs; // windows, in caller order
+	si4			n_chans; // active time series channels, in session order
+	ui1			pad[4];
+	CHAN_m13		**chans; // [n_chans] (session owns)
+	si8			epoch_samples; // row stride: samples in the longest window at the highest active sampling frequency
+	si4			*samples; // [n_epochs][n_chans][epoch_samples]
+	si8			*start_samp_nums; // [n_epochs][n_chans] session-relative sample number of the row's first sample
+	si8			*sample_counts; // [n_epochs][n_chans] valid samples in the row (remainder padded)
+	si8			n_reads; // coalesced session reads performed
+} EPOCHS_m13;
+
 typedef struct {
 	CHAN_m13	*chan;
 	si4		acq_num;
 } ACQ_NUM_SORT_m13;
 
+typedef struct {
+	si8		start_time;
+	si8		end_time;
+	si8		epoch_idx;
+	ui4		type_code; // locking record's type code (DM_get_epochs_m13())
+} EPOCH_SORT_m13;
+
 // schema 0 -> 1 re-key context, held by G_update_MED_version_m13() & passed to G_update_MED_type_m13().
 // uh = the established schema-1 password data to stamp; legacy_pwd/schema1_pwd = the two key contexts swapped into
 // the process-global pg->password_data around decrypt (legacy) / re-encrypt (schema-1). NULL context => no re-key.
@@ -3872,6 +4251,12 @@ BEHAVIOR_STACK_m13	*G_behavior_stack_m13(void);
 void			G_behavior_stack_reset_exec_m13(const si1 *function, si4 line, ui4 code);
 si1			*G_behavior_string_m13(ui4 behavior_code, si1 *behavior_string);
 si8			G_build_contigua_m13(void *level_header);
+tern			G_build_overview_m13(SEG_m13 *seg); // from the decoded samples; unencrypted time series segments only
+pthread_rval_m13	G_build_overview_thread_m13(void *ptr);
+tern			G_build_overviews_m13(void *level_header); // session or channel: every open time series segment, one job per segment
+tern			G_build_zone_map_m13(SEG_m13 *seg); // from the decoded samples; unencrypted time series segments only
+pthread_rval_m13	G_build_zone_map_thread_m13(void *ptr);
+tern			G_build_zone_maps_m13(void *level_header); // session or channel: every open time series segment, one job per segment
 Sgmt_REC_m13		*G_build_Sgmt_records_m13(void *level_header, si4 search_mode, ui4 *source_type);
 tern 			G_calculate_indices_CRCs_m13(FPS_m13 *fps);
 tern			G_calculate_metadata_CRC_m13(FPS_m13 *fps);
@@ -3906,6 +4291,7 @@ BEHAVIOR_m13		*G_current_behavior_entry_m13(void); // returns pointer to BEHAVIO
 si8			G_current_uutc_m13(void);
 si4			G_days_in_month_m13(si4 month, si4 year);
 tern			G_AES_crypt_m13(UH_m13 *uh, PASSWORD_DATA_m13 *pwd, si1 level, ui1 *data, si8 len, tern encrypt);
+si8			G_decode_time_series_data_m13(SEG_m13 *seg, void *dest, ui8 dest_type, si8 dest_stride); // dest_type: DM_TYPE_SI2/SI4/SF4/SF8_m13; dest_stride in elements; dest == NULL: decode into the CPS
 tern 			G_decrypt_metadata_m13(FPS_m13 *fps);
 tern			G_encryption_decrypted_state_m13(si1 level);  // TRUE only for the decrypted transients (-LEVEL_1/-LEVEL_2); ENCRYPTION_NO_ENTRY_m13 (-128) is a legitimate sentinel & is NOT one
 tern			G_validate_encryption_map_m13(UH_m13 *uh, ui4 type_code);  // a NEGATIVE encryption level for THIS file's own region is an in-memory transient: on disk it means the file was written mid-decryption & cannot be trusted (irrelevant regions are ignored - real sessions carry stale values there)
@@ -3938,11 +4324,15 @@ si8			G_find_record_index_m13(FPS_m13 *rec_inds_fps, si8 target_time, ui4 mode,
 si8			G_flen_m13(FILE_m13 *fp, const si1 *path);
 //si8 			G_frame_number_for_uutc_m13(void *level_header, si8 target_uutc, ui4 mode, ...); // varargs (level_header == NULL): si8 ref_frame_number, si8 ref_uutc, sf8 frame_rate
 tern			G_free_channel_m13(void *ptr);
+tern			G_free_epochs_m13(EPOCHS_m13 **epochs_ptr);
 void			G_free_global_tables_m13(void);
 void			G_free_globals_m13(tern cleanup_for_exit);
+void			G_free_overview_m13(OVW_m13 *ovw);
 tern			G_free_segment_m13(void *ptr);
 tern			G_free_session_m13(void *ptr);
+void			G_free_session_manifest_m13(SESS_MNFST_m13 *mnfst);
 tern			G_free_ssr_m13(void *ptr);
+void			G_free_zone_map_m13(ZMAP_m13 *zmap);
 tern			G_full_path_m13(const si1 *path, si1 *full_path);
 FUNCTION_STACK_m13	*G_function_stack_m13(pid_t_m13 _id);
 si1			**G_generate_numbered_names_m13(si1 **names, const si1 *prefix, si4 n_names);
@@ -4003,17 +4393,22 @@ tern			G_propagate_flags_m13(void *level_header, ui8 new_flags);
 void			G_push_behavior_exec_m13(const si1 *function, const si4 line, ui4 code);
 void			G_push_function_exec_m13(const si1 *function, const si4 line);
 tern			G_rates_vary_m13(SESS_m13 *sess);
+tern			G_read_ahead_m13(SESS_m13 *sess);
 CHAN_m13		*G_read_channel_m13(CHAN_m13 *chan, SLICE_m13 *slice, ...); // varargs(chan == NULL): const si1 *chan_path, void *parent, ui8 lh_flags, const si1 *password, const si1 *index_channel_name
 pthread_rval_m13	G_read_channel_thread_m13(void *ptr);
 si4			G_read_cs_file_m13(const si1 *cs_file_name, si4 n_available_channels, si4 **map, si4 **reverse_map, si1 ***names, sf8 **decimation_frequencies, ui4 **block_samples, si1 ***descriptions);
 LH_m13			*G_read_data_m13(void *level_header, SLICE_m13 *slice, ...); // varargs(lh == NULL): const si1 *file_list, si4 list_len, ui8 lh_flags, const si1 *password, const si1 *index_channel_name
+EPOCHS_m13		*G_read_epochs_m13(SESS_m13 *sess, SLICE_m13 *slices, si8 n_slices);
 tern			G_read_medlibrc_m13(const si1 *path, tern sequential); // path NULL == the user file (~/.medlibrc; written with defaults if unusable); non-NULL == an application's own RC, applied on top & never written by the library. sequential TRUE == fast forward walk (fields in emitted order); FALSE == search from start (a partial file, any order)
+OVW_m13			*G_read_overview_m13(SEG_m13 *seg); // NULL if absent or stale (not an error); cached on the segment
 si8			G_read_records_m13(void *level_header, SLICE_m13 *slice, ...); // varargs(level->type_code == LH_SSR_m13): si4 seg_num
 SEG_m13			*G_read_segment_m13(SEG_m13 *seg, SLICE_m13 *slice, ...); // varargs(seg == NULL): const si1 *seg_path, void *parent, ui8 lh_flags, const si1 *password
 pthread_rval_m13	G_read_segment_thread_m13(void *ptr);
 SESS_m13		*G_read_session_m13(SESS_m13 *sess, SLICE_m13 *slice, ...); // varargs(sess == NULL): void *file_list, si4 list_len, ui8 lh_flags, const si1 *password, const si1 *index_channel_name
+SESS_MNFST_m13		*G_read_session_manifest_m13(const si1 *sess_path); // NULL if absent or invalid (not an error)
 si8			G_read_time_series_data_m13(SEG_m13 *seg, SLICE_m13 *slice);
 UH_m13			*G_read_universal_header_m13(const si1 *path, UH_m13 *uh);
+ZMAP_m13		*G_read_zone_map_m13(SEG_m13 *seg); // NULL if absent or stale (not an error); cached on the segment
 tern			G_recover_passwords_m13(const si1 *L3_password, UH_m13* universal_header, si1 *L1_out, si1 *L2_out); // L1_out/L2_out (legacy schema only): if non-NULL, RETURN the recovered password STRINGS (>= MAX_PASSWORD_STRING_BYTES each; empty if that level absent) & stay SILENT (re-key/programmatic use); both NULL => print recovered values (recovery tool)
 si1			*G_recover_password_string_m13(si1 *password_string, ui1 target_level, const si1 *higher_level_pw, UH_m13 *universal_header); // escrow recovery: returns the TYPED password string of target_level; read-only, validated before return
 si1			*G_unseal_password_string_m13(si1 *password_string, const ui1 *anchor_private_key, UH_m13 *universal_header); // anchor (type 2) recovery of the top-level password string; anchor-holder side, requires only the universal header
@@ -4031,6 +4426,7 @@ si4			G_segment_range_m13(void *level_header, SLICE_m13 *slice);
 ui4			*G_segment_video_start_frames_m13(FPS_m13 *vid_inds_fps, ui4 *n_video_files);
 tern			G_sendgrid_email_m13(const si1 *sendgrid_key, const si1 *to_email, const si1 *cc_email, const si1 *to_name, const si1 *subject, const si1 *content, const si1 *from_email, const si1 *from_name, const si1 *reply_to_email, const si1 *reply_to_name);
 tern			G_session_directory_m13(FPS_m13 *fps);
+ui1			*G_session_manifest_image_m13(SESS_MNFST_m13 *mnfst, const si1 *path, si8 *len); // image of a file, if still valid (NULL otherwise)
 si1			*G_session_path_for_path_m13(const si1 *path, si1 *sess_path);
 si8			G_session_samples_m13(void *level_header, sf8 rate);
 void			G_set_error_exec_m13(const si1 *function, si4 line, si4 code, const si1 *message, ...); // vararg(code == E_SIG_m13): si4 sig_num (followed by optional formatting string values)
@@ -4064,6 +4460,9 @@ void			G_signal_trap_m13(si4 sig_num);
 tern			G_sort_channels_by_acq_num_m13(SESS_m13 *sess);
 tern			G_rec_inds_ordered_m13(REC_IDX_m13 *inds, si8 n_recs); // backward abort-early order scan (TIME_NO_ENTRY counts as unordered)
 tern			G_sort_records_m13(FPS_m13 *rec_inds_fps, FPS_m13 *rec_data_fps);
+tern			G_stream_close_m13(STREAM_m13 **stream_ptr);
+STREAM_CHUNK_m13	*G_stream_next_m13(STREAM_m13 *stream); // returns NULL on error; chunk->n_samples == 0 at end of stream
+STREAM_m13		*G_stream_open_m13(CHAN_m13 *chan, SLICE_m13 *slice, si8 chunk_samples, tern prefetch, ...); // varargs(chan == NULL): const si1 *chan_path, ui8 lh_flags, const si1 *password
 tern			G_swap_names_m13(void *level_header);
 // returns TRUE_m13 if an operator responded (including an empty entry accepting the default),
 // UNKNOWN_m13 if input was exhausted & the default was applied with nobody present, FALSE_m13 on
@@ -4091,6 +4490,10 @@ tern			G_validate_time_series_data_CRCs_m13(FPS_m13 *fps);
 tern			G_validate_video_data_CRCs_m13(FPS_m13 *fps);
 void			G_warning_message_m13(const si1 *fmt, ...) FMT_ATTR_m13(1, 2);
 void			G_write_medlibrc_m13(const si1 *path);
+tern			G_write_session_manifest_m13(SESS_m13 *sess);
+tern			G_write_zone_map_m13(FPS_m13 *ts_data_fps); // writes & resets the zone map accumulated in its CPS; call once the data file is complete
+si8			G_zone_map_exceedances_m13(CHAN_m13 *chan, si8 start_time, si8 end_time, si4 threshold, ZMAP_INTERVAL_m13 **intervals); // runs of |x| > threshold; -1 on error
+si8			G_zone_map_variance_m13(CHAN_m13 *chan, si8 start_time, si8 end_time, sf8 min_variance, ZMAP_INTERVAL_m13 **intervals); // runs of blocks with variance > min_variance; -1 on error
 
 
 
@@ -4367,6 +4770,17 @@ void		*STR_wchar2char_m13(void *target, const wchar_t *source);
 #define CMP_VDS_DEFER_DENSITY_SHIFT_m13		6  // use defer refine when post-spurious anchors <= (block_samps >> 6) (~1.5%); denser => local (defer's extra rounds not worth ~3% fewer anchors)
 #define CMP_VDS_BLAST_COUPLING_m13		3  // Akima coupling radius: inserting near anchor i perturbs the fit for anchors within +-3
 #define CMP_VDS_OUTPUT_BUFFERS_m13		CMP_MAK_OUTPUT_BUFFERS_m13
+#define CMP_DECODE_RUN_MIN_BLOCKS_m13		8  // block-parallel decode: fewest blocks per run (fewer are not worth a thread)
+#define CMP_DECODE_RUN_BUFFERS_m13		4  // block-parallel decode: worker scratch buffers (depot bundle)
+#define CMP_DECODE_RUN_CHUNK_BLOCKS_m13		32  // deferred block-parallel decode: blocks per run per chunk (bounds the conversion scratch)
+#define CMP_DECODE_RUN_KEYSAMPLE_BUF_m13	0
+#define CMP_DECODE_RUN_RESIDUALS_BUF_m13	1  // SRRED
+#define CMP_DECODE_RUN_CUMULATIVE_BUF_m13	2  // RED flat / PRED 2D (row pointers rebuilt per block)
+#define CMP_DECODE_RUN_MINIMUM_RANGE_BUF_m13	3  // RED flat / PRED 2D (row pointers rebuilt per block)
+#define CMP_SI2_TYPE_m13			((ui1) 1)  // CMP_si4_to_type_m13() output types
+#define CMP_SI4_TYPE_m13			((ui1) 2)
+#define CMP_SF4_TYPE_m13			((ui1) 3)
+#define CMP_SF8_TYPE_m13			((ui1) 4)
 #define CMP_VDS_LOWPASS_ORDER_m13		6
 #define CMP_VDS_MINIMUM_SAMPLES_m13		10
 #define CMP_SRRED_BOTTOM_SCALE_m13		((sf8) 0.005) // minimum search scale (scale search starts here)
@@ -4630,6 +5044,7 @@ void		*STR_wchar2char_m13(void *target, const wchar_t *source);
 #define CPS_DF_SET_DERIVATIVE_LEVEL_m13			((ui8) 1 << 21)	 // user sets level in parameters
 #define CPS_DF_FIND_DERIVATIVE_LEVEL_m13		((ui8) 1 << 22)
 #define CPS_DF_CONVERT_TO_NATIVE_UNITS_m13		((ui8) 1 << 23)
+#define CPS_DF_ZONE_MAP_m13				((ui8) 1 << 24) // CMP_encode_m13() adds each block's statistics to cps->zone_map (see G_write_zone_map_m13())
 
 // directives flags (lossy)
 #define CPS_DF_DETREND_DATA_m13				((ui8) 1 << 32)
@@ -5088,6 +5503,87 @@ struct CMP_BUFFER_DEPOT_m13 {  // tag matches the forward decl before GLOBALS_m1
 	pthread_mutex_t_m13		mutex;
 };
 
+// Process-wide cache of decoded blocks, keyed by (file UID, block number). Unlike CPS caching (one contiguous
+// run per CPS) it survives window jumps & CPS frees, & its size is bounded by a byte budget rather than by the
+// number of open channels. Sharded: each shard has its own lock, hash table & LRU list, so concurrent channel
+// reads rarely contend. Samples are stored as decoded (before native units conversion).
+// See CMP_block_cache_budget_m13() / CMP_block_cache_fetch_m13() / CMP_block_cache_store_m13().
+#define CMP_BLOCK_CACHE_SHARDS_m13		16 // power of 2
+#define CMP_BLOCK_CACHE_BUCKETS_m13		1024 // hash buckets per shard (power of 2)
+
+typedef struct CMP_BLOCK_CACHE_ENTRY_m13 {
+	ui8					file_UID;
+	si8					block_number;
+	si8					bytes; // entry & samples (one allocation)
+	ui4					n_samples;
+	ui1					pad[4];
+	struct CMP_BLOCK_CACHE_ENTRY_m13	*hash_next; // bucket chain
+	struct CMP_BLOCK_CACHE_ENTRY_m13	*lru_prev; // toward most recently used
+	struct CMP_BLOCK_CACHE_ENTRY_m13	*lru_next; // toward least recently used
+	si4					*samples; // follows the entry
+} CMP_BLOCK_CACHE_ENTRY_m13;
+
+typedef struct {
+	pthread_mutex_t_m13		mutex;
+	CMP_BLOCK_CACHE_ENTRY_m13	*buckets[CMP_BLOCK_CACHE_BUCKETS_m13];
+	CMP_BLOCK_CACHE_ENTRY_m13	*lru_head; // most recently used
+	CMP_BLOCK_CACHE_ENTRY_m13	*lru_tail; // least recently used (evicted first)
+	si8				bytes; // held by this shard's entries
+} CMP_BLOCK_CACHE_SHARD_m13;
+
+struct CMP_BLOCK_CACHE_m13 {  // tag matches the forward decl before GLOBALS_m13
+	CMP_BLOCK_CACHE_SHARD_m13	shards[CMP_BLOCK_CACHE_SHARDS_m13];
+};
+
+// Host-wide decoded block cache in POSIX shared memory (Linux), the tier behind the process block cache: processes
+// reviewing the same sessions decode each block once between them. Set-associative: a key hashes to a set of
+// CMP_SHM_CACHE_WAYS_m13 fixed-size slots guarded by one process-shared ROBUST mutex, & CLOCK evicts within the
+// set. Readers copy out under the set lock, so a slot cannot be reused mid-read & no per-slot reference is left
+// behind by a process that dies. A process that dies holding a set lock leaves the set possibly half written: the
+// next locker gets EOWNERDEAD, empties that set & marks the mutex consistent. The segment is per user (the euid is
+// in its name) & created owner-only (0600): it holds decrypted samples. Its geometry is fixed by the creating
+// process; an attacher maps it only if it is owned by the euid, grants no group/other access, carries this
+// layout's magic, & is exactly the size its header geometry implies.
+#define CMP_SHM_CACHE_NAME_m13			"/medlib_m13_block_cache_%u" // formatted with the euid
+#define CMP_SHM_CACHE_NAME_BYTES_m13		64
+#define CMP_SHM_CACHE_VERSION_m13		((ui4) 2) // bump when the segment layout (header, set, or slot) changes
+#define CMP_SHM_CACHE_MAGIC_m13			((ui4) 0x4D424300 | CMP_SHM_CACHE_VERSION_m13) // "MBC" + layout version: segment initialized (written last by the creator)
+#define CMP_SHM_CACHE_WAYS_m13			8 // slots per set
+#define CMP_SHM_CACHE_SLOT_SAMPLES_m13		((ui4) 32768) // larger blocks are not shared
+#define CMP_SHM_CACHE_ATTACH_NAP_m13		"10 ms" // poll interval waiting for a concurrent creator to initialize the segment  [nap_m13() form]
+#define CMP_SHM_CACHE_ATTACH_TRIES_m13		10
+
+typedef struct {
+	ui8	file_UID; // UID_NO_ENTRY_m13 == empty slot
+	si8	block_number;
+	ui4	n_samples;
+	ui1	referenced; // CLOCK bit
+	ui1	pad[3];
+} CMP_SHM_CACHE_SLOT_m13;
+
+typedef struct {
+	pthread_mutex_t_m13	mutex; // process-shared & robust
+	ui4			clock_hand;
+	ui1			pad[4];
+	CMP_SHM_CACHE_SLOT_m13	slots[CMP_SHM_CACHE_WAYS_m13];
+} CMP_SHM_CACHE_SET_m13;
+
+typedef struct {  // start of the shared segment; sets follow, then the sample arena
+	_Atomic ui4		magic;
+	ui4			n_sets;
+	ui4			slot_samples;
+	ui1			pad[4];
+	si8			segment_bytes;
+} CMP_SHM_CACHE_HDR_m13;
+
+struct CMP_SHM_CACHE_m13 {  // tag matches the forward decl before GLOBALS_m13 (process local)
+	CMP_SHM_CACHE_HDR_m13	*hdr; // mapped segment
+	CMP_SHM_CACHE_SET_m13	*sets;
+	si4			*arena; // n_sets * CMP_SHM_CACHE_WAYS_m13 slots of hdr->slot_samples samples
+	tern			attached; // FALSE_m13 == attach failed (not retried)
+	ui1			pad[7];
+};
+
 typedef struct {
 	si8	cache_offset;
 	ui4	block_samples;
@@ -5113,6 +5609,7 @@ typedef struct {
 	si4				cached_block_list_len;
 	si4				cached_block_cnt;
 	si4				*cache;
+	tern				decode_deferred; // compressed data read, not decoded (LH_DEFER_TS_DECODE_m13): see G_decode_time_series_data_m13()
 	
 	// memory parameters
 	si8	allocated_block_samples;
@@ -5214,13 +5711,38 @@ typedef struct CPS_m13 {
 	ui1				*block_records; // pointer beginning of records region of block header
 	ui4				*block_parameters; // pointer beginning of parameter region of block header
 	ui1				*discretionary_region;
+	ZMAP_m13			*zone_map; // per-block statistics accumulated in compression (CPS_DF_ZONE_MAP_m13); freed with the CPS
 } CPS_m13;
 
+// block-parallel decode run (see G_read_time_series_data_m13() & LH_THREAD_BLOCK_DECODE_m13)
+typedef struct {
+	CPS_m13				cps; // worker CPS: shares the segment CPS compressed & decompressed arrays, private scratch
+	CMP_BUFFERS_m13			*scratch; // worker scratch, checked out from the CMP buffer depot
+	CMP_CACHE_BLOCK_INFO_m13	*cached_blocks; // segment CPS cache block list (NULL if not caching)
+	tern				skip_cached; // cached blocks are present in the slice (skip them, as in the serial loop)
+	tern				scale; // convert to native units
+	sf8				scale_factor;
+	si8				start_idx; // slice relative index of first block in run
+	si8				n_blocks; // blocks in run
+	si8				cache_offset; // cache offset of first block in run
+	si4				start_block_number; // segment relative number of first block in run
+	ui4				block_end_index; // limit on last block of run (0xFFFFFFFF == no limit)
+	ui8				file_UID; // process-wide block cache key (UID_NO_ENTRY_m13 == block cache off)
+} CMP_DECODE_RUN_m13;
+
 // Function Prototypes
 CMP_BUFFERS_m13	*CMP_allocate_buffers_m13(CMP_BUFFERS_m13 *buffers, si8 n_buffers, si8 n_elements, si8 element_size, tern zero_data, tern lock_memory);
 CMP_BUFFERS_m13	*CMP_checkout_buffers_m13(si8 n_buffers, si8 n_elements, si8 element_size);  // depot: get a locked/aligned bundle of this exact shape
 tern		CMP_return_buffers_m13(CMP_BUFFERS_m13 *buffers);  // depot: release a checked-out bundle
 void		CMP_free_buffer_depot_m13(void);  // depot: free all pooled bundles (teardown)
+tern		CMP_block_cache_budget_m13(si8 budget_bytes);  // block cache: set byte budget (evicts to fit; 0 == off & empty)
+tern		CMP_block_cache_fetch_m13(CPS_m13 *cps, ui8 file_UID, si8 block_number);  // block cache: hit => samples at cps->decompressed_ptr, CPS left as CMP_decode_m13() would
+tern		CMP_block_cache_store_m13(ui8 file_UID, si8 block_number, si4 *samples, ui4 n_samples);  // block cache: insert a fully decoded block (evicts LRU to fit)
+void		CMP_free_block_cache_m13(void);  // block cache: free all entries (teardown)
+tern		CMP_shm_cache_fetch_m13(ui8 file_UID, si8 block_number, si4 *samples, ui4 n_samples);  // shared block cache: copy a hit to samples (Linux)
+tern		CMP_shm_cache_store_m13(ui8 file_UID, si8 block_number, si4 *samples, ui4 n_samples);  // shared block cache: insert (CLOCK evicts within the set)
+tern		CMP_shm_cache_unlink_m13(void);  // shared block cache: remove the segment name (attached processes keep their mapping; next attach creates anew)
+void		CMP_free_shm_cache_m13(void);  // shared block cache: detach (teardown; the segment persists for other processes)
 si8	CMP_max_compressed_bytes_m13(CPS_m13 *cps, si8 block_samps, si8 n_blocks);
 CPS_m13	*CMP_allocate_CPS_m13(FPS_m13 *fps, ui4 mode, si8 data_samples, si8 compressed_data_bytes, si8 keysample_bytes, ui4 block_samples, CPS_DIRECS_m13 *direcs, CPS_PARAMS_m13 *parameters);
 tern	CMP_binterpolate_sf8_m13(sf8 *in_data, si8 in_len, sf8 *out_data, si8 out_len, ui4 center_mode, tern extrema, sf8 *minima, sf8 *maxima);
@@ -5234,7 +5756,10 @@ tern	CMP_check_CPS_allocation_m13(FPS_m13 *fps);
 si4	CMP_compare_sf8_m13(const void *a, const void * b);
 si4	CMP_compare_si4_m13(const void *a, const void * b);
 si4	CMP_compare_si8_m13(const void *a, const void * b);
+tern	CMP_decode_block_m13(CPS_m13 *cps); // decode without FPS (cps scratch must fit the block)
 tern	CMP_decode_m13(FPS_m13 *fps);
+pthread_rval_m13	CMP_decode_run_thread_m13(void *ptr);
+tern	CMP_decode_runs_m13(FPS_m13 *fps, CMP_DECODE_RUN_m13 *range, si4 n_runs); // block-parallel decode (see G_read_time_series_data_m13())
 tern	CMP_decrypt_m13(FPS_m13 *fps); // single block decrypt (see also decrypt_time_series_data_m13)
 tern	CMP_detrend_m13(si4 *input_buffer, si4 *output_buffer, si8 len, CPS_m13 *cps);
 tern	CMP_detrend_sf8_m13(sf8 *input_buffer, sf8 *output_buffer, si8 len);
@@ -5310,6 +5835,7 @@ tern	CMP_sf8_to_si4_and_scale_m13(sf8 *sf8_arr, si4 *si4_arr, si8 len, sf8 scale
 tern	CMP_show_block_header_m13(void *level_header, CMP_FIXED_BH_m13 *bh);
 tern	CMP_show_block_model_m13(CPS_m13 *cps, tern recursed_call);
 tern	CMP_si4_to_sf8_m13(si4 *si4_arr, sf8 *sf8_arr, si8 len);
+tern	CMP_si4_to_type_m13(si4 *si4_arr, void *out_arr, si8 len, ui1 out_type, sf8 scale); // scale, round & narrow in one pass (vectorized where HW_params.SIMD_accel); scale 1.0 (or not finite, or 0.0) => none; si4_arr may be out_arr
 sf8	*CMP_spline_interp_sf8_m13(sf8 *in_data, si8 in_len, sf8 *out_data, si8 out_len, CMP_BUFFERS_m13 *spline_bufs);
 si4	*CMP_spline_interp_si4_m13(si4 *in_data, si8 in_len, si4 *out_data, si8 out_len, CMP_BUFFERS_m13 *spline_bufs);
 sf8	CMP_splope_m13(sf8 *xa, sf8 *ya, sf8 *d2y, sf8 x, si8 lo_pt, si8 hi_pt);
@@ -5364,6 +5890,9 @@ typedef ui4	crc4;
 #define CRC_POLYNOMIAL_m13	((crc4) 0xEDB88320) // note library CRC routines are customized to this polynomial, it cannot be changed arbitrarily
 #define CRC_START_VALUE_m13	((crc4) 0x0)
 #define CRC_NO_ENTRY_m13	CRC_START_VALUE_m13
+#define CRC_HW_MIN_BYTES_m13	64 // shortest run folded with carry-less multiplies (HW_params.CRC32_accel); shorter runs use the tables
+#define CRC_PAR_MIN_BYTES_m13	((si8) 1 << 22) // runs shorter than this (4 MiB) are CRC'd on the calling thread by the *_parallel_m13() functions
+#define CRC_PAR_SPAN_BYTES_m13	((si8) 1 << 20) // fewest bytes given to one CRC worker (1 MiB)
 
 // CRC Modes
 #define CRC_IGNORE_m13		((ui4) 0) // ignore CRCs
@@ -5371,17 +5900,31 @@ typedef ui4	crc4;
 #define CRC_CALCULATE_m13	((ui4) 1 << 1) // calculate on output
 #define CRC_MODES_ALL_m13	( CRC_VALIDATE_m13 | CRC_CALCULATE_m13 ) // validate on input & calculate on output
 
+// Structures
+typedef struct {
+	const ui1	*ptr; // start of span (for time series data: its first CMP block header)
+	si8		n_bytes; // bytes in span
+	si8		n_blocks; // time series data only: CMP blocks in span
+	tern		calculate; // time series data only: TRUE_m13 to calculate block CRCs, FALSE_m13 to validate them
+	crc4		crc; // [returned] CRC of the span bytes
+	tern		valid; // [returned] time series data only: result of block CRC validation
+} CRC_SPAN_m13;
+
 // Macros
 #define CRC_SWAP4_m13(x)	( (((x) >> 24) & 0x000000ff) + (((x) >> 8) & 0x0000ff00) + (((x) & 0x0000ff00) << 8) + (((x) & 0x000000ff) << 24) )
 
 // Function Prototypes
 crc4	CRC_calculate_m13(const ui1 *block_ptr, si8 block_bytes);
+crc4	CRC_calculate_parallel_m13(const ui1 *block_ptr, si8 block_bytes);
 crc4	CRC_combine_m13(crc4 block_1_crc, crc4 block_2_crc, si8 block_2_bytes);
 tern	CRC_init_tables_m13(void);
 void	CRC_matrix_square_m13(crc4 *square, const crc4 *mat);
 crc4	CRC_matrix_times_m13(const crc4 *mat, crc4 vec);
+si4	CRC_parallel_spans_m13(si8 n_bytes); // number of workers the *_parallel_m13() functions would use for n_bytes (1 == calling thread only)
 crc4	CRC_update_m13(const ui1 *block_ptr, si8 block_bytes, crc4 current_crc);
+crc4	CRC_update_parallel_m13(const ui1 *block_ptr, si8 block_bytes, crc4 current_crc); // spans CRC'd on worker threads, combined in order with CRC_combine_m13()
 tern	CRC_validate_m13(const ui1 *block_ptr, si8 block_bytes, crc4 crc_to_validate);
+tern	CRC_validate_parallel_m13(const ui1 *block_ptr, si8 block_bytes, crc4 crc_to_validate);
 
 
 
@@ -5436,6 +5979,7 @@ tern		UTF8_valid_str_m13(const si1 *s);
 #define AES_NK_256_m13		8 // The number of 32 bit words in an AES-256 key (256 bits)
 #define AES_KEY_BYTES_256_m13	( AES_NK_256_m13 * 4 ) // 32 (binary key, e.g. KDF-derived: null bytes are valid & not conditioned away)
 #define AES_EXPANDED_KEY_BYTES_256_m13	( (AES_NR_256_m13 + 1) * AES_NB_m13 * 4 ) // 240
+#define AES_HW_LANES_m13	8 // independent blocks kept in flight per round by the hardware multi-block kernels (AESENC / AESE latency ~4 cycles, issue 1-2 per cycle); keep "#pragma GCC unroll 8" there in step
 #define AES_XTIME_m13(x)	( (x << 1) ^ (((x >> 7) & 1) * 0x1b) ) // AES_XTIME is a macro that finds the product of 0x02 and the argument to AES_XTIME modulo 0x1b
 #define AES_MULTIPLY_m13(x, y)	( ((y & 1) * x) ^ ((y >> 1 & 1) * AES_XTIME_m13(x)) ^ ((y >> 2 & 1) * AES_XTIME_m13(AES_XTIME_m13(x))) ^ \
 				((y >> 3 & 1) * AES_XTIME_m13(AES_XTIME_m13(AES_XTIME_m13(x)))) ^ ((y >> 4 & 1) * \
@@ -5497,6 +6041,7 @@ tern		UTF8_valid_str_m13(const si1 *s);
 
 // Function Prototypes
 void	AES_add_round_key_m13(si4 round, ui1 state[][4], ui1 *round_key);
+void	AES_cipher_blocks_m13(ui1 *data, si8 n_blocks, ui1 *round_key, si4 nr); // in place, whole blocks (ECB); hardware path pipelines AES_HW_LANES_m13 blocks
 void	AES_cipher_m13(ui1 *in, ui1 *out, ui1 state[][4], ui1 *round_key);
 void	AES_cipher_nr_m13(ui1 *in, ui1 *out, ui1 state[][4], ui1 *round_key, si4 nr);
 void	AES_ctr_blocks_m13(ui1 *data, si8 len, si4 phase, const ui1 *init_ctr_block, ui1 *round_key_256);  // low-level CTR engine: explicit initial counter block, NIST SP 800-38A semantics
@@ -5506,6 +6051,7 @@ void	AES_decrypt_256_m13(ui1 *data, si8 len, const ui1 *key, ui1 *inv_expanded_k
 void	AES_encrypt_m13(ui1 *data, si8 len, const si1 *password, ui1 *expanded_key);
 void	AES_encrypt_256_m13(ui1 *data, si8 len, const ui1 *key, ui1 *expanded_key);
 tern	AES_init_tables_m13(void);
+void	AES_inv_cipher_blocks_m13(ui1 *data, si8 n_blocks, ui1 *round_key, si4 nr); // in place, whole blocks (ECB); round_key is a decryption schedule
 void	AES_inv_cipher_m13(ui1 *in, ui1 *out, ui1 state[][4], ui1 *round_key);
 void	AES_inv_cipher_nr_m13(ui1 *in, ui1 *out, ui1 state[][4], ui1 *round_key, si4 nr);
 ui1	*AES_inv_key_expansion_m13(ui1 *inv_expanded_key, const si1 *key);
@@ -5546,6 +6092,7 @@ void	AES_sub_bytes_m13(ui1 state[][4]);
 // Constants
 #define SHA_HASH_BYTES_m13	32 // 256 bit
 #define SHA_LOW_BYTE_MASK_m13	((ui4) 0x000000FF)
+#define SHA_LANES_m13	4 // independent messages compressed together on one thread (SHA_update_blocks_m13(), SHA_pbkdf2_lanes_m13())
 
 #define	SHA_H0_ENTRIES_m13	8
 #define	SHA_H0_m13 {		0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19 }
@@ -5578,6 +6125,20 @@ typedef struct {
 	ui4	datalen;
 } SHA_CTX_m13;
 
+typedef struct {
+	const ui1	*pw;
+	si4		pw_bytes;
+	const ui1	*salt;
+	si4		salt_bytes; // max 64
+	ui4		iterations;
+	ui1		*dk; // [returned] SHA_HASH_BYTES_m13 bytes (caller supplied)
+} SHA_PBKDF2_LANE_m13;
+
+typedef struct {
+	SHA_PBKDF2_LANE_m13	*lanes; // run interleaved on one thread
+	si4			n_lanes;
+} SHA_PBKDF2_GROUP_m13;
+
 // Function Prototypes
 void	SHA_finalize_m13(SHA_CTX_m13 *ctx, ui1 *hash);
 ui1	*SHA_hash_m13(const ui1 *data, si8 len, ui1 *hash);
@@ -5585,12 +6146,14 @@ ui1	*SHA_hmac_m13(const ui1 *key, si4 key_bytes, const ui1 *data, si8 data_bytes
 void	SHA_init_m13(SHA_CTX_m13 *ctx);
 tern	SHA_init_tables_m13(void);
 ui1	*SHA_pbkdf2_m13(const ui1 *pw, si4 pw_bytes, const ui1 *salt, si4 salt_bytes, ui4 iterations, ui1 *dk);
+tern	SHA_pbkdf2_lanes_m13(SHA_PBKDF2_LANE_m13 *lanes, si4 n_lanes); // independent derivations: groups of lanes on worker threads, each group interleaved SHA_LANES_m13 at a time
 ui1	*SHA_pbkdf2_resume_m13(const ui1 *pw, si4 pw_bytes, const ui1 *salt, si4 salt_bytes, ui4 from_iter, ui4 to_iter, ui1 *u, ui1 *dk); // resumable PBKDF2: advance (u,dk) state from_iter->to_iter; dk snapshot at any to_iter == PBKDF2(that count). from_iter 0 initializes.
 void	SKC_id_m13(UH_m13 *uh, ui1 *cache_id);					// cache_id = SHA-256(KDF salt || kdf_exponent)[0:SESSION_KEY_CACHE_ID_BYTES_m13]
 tern	SKC_get_m13(const ui1 *cache_id, ui1 *master, ui1 *fp_out);		// TRUE = hit (master filled, unexpired; fp_out (may be NULL) gets the stored password fingerprint); FALSE = miss/expired/unavailable
 tern	SKC_put_m13(const ui1 *cache_id, const ui1 *master, const ui1 *fp, si4 timeout_sec);	// store/refresh (resets expiry); fp = password fingerprint (NULL => zeros); timeout clamped to GLOBALS_SESSION_KEY_CACHE_TIMEOUT_MAX_m13
 tern	SKC_evict_m13(const ui1 *cache_id);
 void	SHA_transform_m13(SHA_CTX_m13 *ctx, const ui1 *data);
+void	SHA_update_blocks_m13(SHA_CTX_m13 **ctx, const ui1 **data, si4 n_lanes, si8 n_blocks); // multi-buffer: n_blocks whole blocks of each of up to SHA_LANES_m13 messages (every ctx->datalen must be 0)
 void	SHA_update_m13(SHA_CTX_m13 *ctx, const ui1 *data, si8 len);
 
 
@@ -5651,6 +6214,7 @@ tern	XEC_unseal_m13(ui1 *plaintext_block, const ui1 *sealed_box, const ui1 *reci
 // Constants
 #define DGST_BYTES_m13		SHA_HASH_BYTES_m13 // 32
 #define DGST_CHUNK_BYTES_m13	((si8) 1 << 22) // 4 MiB streaming-read chunk (constant memory at any file size)
+#define DGST_BATCH_CHUNK_BYTES_m13	((si8) 1 << 20) // DGST_files_m13() read size per lane (SHA_LANES_m13 files in flight per worker thread)
 
 // resume state serialization (little endian, explicit layout - NOT a raw SHA_CTX_m13 copy):
 #define DGST_RESUME_STATE_OFFSET_m13	0	// ui4[8] (SHA chaining state)
@@ -5675,9 +6239,30 @@ typedef struct DGST_STREAM_m13 {
 	tern		video; // UH at file end: physical == canonical order
 } DGST_STREAM_m13;
 
+typedef struct {
+	si1		**paths;
+	DGST_RESULT_m13	*results;
+	tern		*file_ok; // [returned] may be NULL
+	si4		n_files;
+	_Atomic si4	next_file; // next list entry to claim (workers pull files until the list is exhausted)
+	_Atomic si4	n_failed;
+} DGST_BATCH_m13;
+
+typedef struct {
+	FILE_m13	*fp;
+	SHA_CTX_m13	ctx;
+	ui1		*buffer; // DGST_BATCH_CHUNK_BYTES_m13
+	si8		buf_bytes; // valid bytes in buffer
+	si8		buf_pos; // next byte of buffer to absorb
+	si8		remaining; // data-region bytes not yet read
+	si8		uh_offset; // < 0: degenerate file (no universal header region)
+	si4		file_idx; // < 0: lane idle
+} DGST_LANE_m13;
+
 // Function Prototypes
 tern	DGST_begin_m13(FILE_m13 *fp); // attach stream to a MED file open for writing (existing data-region bytes caught up by read; forces LEN & POS flags)
 tern	DGST_file_m13(const si1 *path, DGST_RESULT_m13 *result); // canonical digests by streamed read
+tern	DGST_files_m13(si1 **paths, si4 n_files, DGST_RESULT_m13 *results, tern *file_ok); // batch DGST_file_m13(): files pulled by worker threads, SHA_LANES_m13 hashed at once per worker; file_ok (may be NULL) gets each file's outcome (failed files' results zeroed); FALSE_m13 if any failed
 tern	DGST_finalize_m13(FILE_m13 *fp, DGST_RESULT_m13 *result); // absorb settled UH, emit digests, detach; UNKNOWN_m13 == stream unusable (fall back to DGST_file_m13()), FALSE_m13 == error
 void	DGST_free_m13(FILE_m13 *fp); // detach & free stream state without producing a digest (also called by fclose_m13())
 tern	DGST_full_from_resume_m13(const ui1 *resume, const ui1 *uh_bytes, ui1 *full_digest); // absorb a (new) UH onto a stored resume state => full digest, no body re-read
@@ -6031,28 +6616,6 @@ tern	FILT_unsymmeig_m13(sf8 **a, si4 poles, FILT_COMPLEX_m13 *eigs);
 
 // ---------------- DM matrix-fill code generation macros ----------------
 
-// Fast path: copy a channel's decompressed si4 samples straight into the caller's matrix, converting to
-// TYPE via CONV (a round function for integers, a cast for floats). One pattern per element type; channel-
-// vs sample-major layout is handled inside. Expands inside G_DM_channel_thread_m13 & CAPTURES ITS LOCALS:
-//   dm, chan, slice, seg_idx, pt_base, chan_offset, samp_offset, chan_idx, i, j, k
-// Defined here rather than in the .c only to keep #defines out of the .c - it is not a general-use macro.
-#define DM_PASSTHRU_m13(TYPE, CONV) \
-		do { \
-			if (dm->flags & DM_FMT_CHANNEL_MAJOR_m13) {  /* contiguous per channel */ \
-				TYPE *_d = (TYPE *) pt_base + chan_offset; \
-				for (i = 0, j = seg_idx; i < slice->n_segs; ++i, ++j) { \
-					si4 *_s = chan->segs[j]->ts_data_fps->params.cps->decompressed_data; \
-					for (k = SLICE_IDX_COUNT_S_m13(chan->segs[j]->slice); k--;) *_d++ = CONV((sf8) *_s++); \
-				} \
-			} else {  /* DM_FMT_SAMPLE_MAJOR_m13: stride by channel_count */ \
-				TYPE *_d = ((TYPE *) pt_base + chan_idx) - samp_offset; \
-				for (i = 0, j = seg_idx; i < slice->n_segs; ++i, ++j) { \
-					si4 *_s = chan->segs[j]->ts_data_fps->params.cps->decompressed_data; \
-					for (k = SLICE_IDX_COUNT_S_m13(chan->segs[j]->slice); k--;) *(_d += samp_offset) = CONV((sf8) *_s++); \
-				} \
-			} \
-		} while (0)
-
 // Store out_buf (+ optional trace min/max) into the caller's matrix in the requested element type & layout.
 // One pattern per type; channel- vs sample-major and trace-ranges are handled inside. CONV converts sf8 ->
 // TYPE (a round function for integers, a cast for floats). sf8 channel-major was written straight into
@@ -6124,10 +6687,43 @@ typedef struct {
 	si8		chan_idx;
 } DM_CHANNEL_THREAD_INFO_m13;
 
+// Record-locked epochs: DM_get_epochs_m13()
+// One window per record passing the record filters ([record time - pre_time, record time + post_time]); all windows are read
+// in one coalesced pass (G_read_epochs_m13()), then each channel's epochs are filtered, resampled (linear), scaled, & typed
+// per the DM flags in a channel thread. Only DM_TYPE, DM_EXTMD_SAMP_COUNT/FREQ, DM_SCALE, DM_FILT, & DM_DSCNT_NAN flags apply.
+typedef struct {
+	si8		epoch_count;
+	si8		channel_count;
+	si8		sample_count;  // per epoch & channel (from params, as in DATA_MATRIX_m13)
+	sf8		sampling_frequency;
+	sf8		scale_factor;
+	sf8		filter_low_fc;
+	sf8		filter_high_fc;
+	void		*data;  // [epoch_count][channel_count][sample_count] of the DM_TYPE flag type; time-locked rows, padded where the window reached no data
+	si8		*valid_sample_counts;  // [epoch_count][channel_count]
+	si8		*epoch_times;  // [epoch_count] uutc of the locking record (epochs in time order)
+	ui4		*record_type_codes;  // [epoch_count]
+	CHAN_m13	**chans;  // [channel_count] (session owns)
+	si8		pre_time;  // µs
+	si8		post_time;  // µs
+	ui8		flags;
+	si8		el_size;
+} DM_EPOCHS_m13;
+
+typedef struct {
+	DM_EPOCHS_m13	*dme;
+	EPOCHS_m13	*epochs;
+	sf8		samp_freq;  // channel sampling frequency
+	si8		chan_idx;
+} DM_EPOCHS_THREAD_INFO_m13;
+
 
 // Prototypes
 pthread_rval_m13	DM_channel_thread_m13(void *ptr);
+pthread_rval_m13	DM_epochs_thread_m13(void *ptr);
+tern			DM_free_epochs_m13(DM_EPOCHS_m13 **epochs_ptr);
 tern			DM_free_matrix_m13(DATA_MATRIX_m13 **matrix);
+DM_EPOCHS_m13		*DM_get_epochs_m13(SESS_m13 *sess, si4 *record_filters, si8 pre_time, si8 post_time, const si1 **chan_names, si4 n_chan_names, DATA_MATRIX_m13 *params); // params: processing fields & flags only (NULL: native si4 at the highest active rate)
 DATA_MATRIX_m13 	*DM_get_matrix_m13(DATA_MATRIX_m13 *matrix, SESS_m13 *sess, SLICE_m13 *slice, si4 varargs, ...); // can't use tern to flag varargs (undefined behavior)
 // DM_get_matrix_m13() varargs: si8 sample_count, sf8 sampling_frequency, ui8 flags, sf8 scale, sf8 fc1, sf8 fc2
 //
@@ -6879,6 +7475,7 @@ pid_t_m13	getpid_m13(void);
 pid_t_m13	gettid_m13(void);
 // inverse semaphore functions [semaphores (with optional ownership) that unlock when count == 0]
 void		isem_chown_m13(isem_t_m13 *isem, pid_t_m13 tid); // ownership not required  [special tid values: ISEM_SELF_m13, ISEM_UNOWN_m13]
+ui8		isem_contentions_m13(isem_t_m13 *isem); // ownership not required  [isem == NULL: process-wide total]
 void		isem_dec_m13(isem_t_m13 *sem); // ownership not required
 void		isem_destroy_m13(isem_t_m13 *isem); // ownership not required
 ui4		isem_getcnt_m13(isem_t_m13 *isem); // ownership not required
@@ -6894,6 +7491,7 @@ tern		isem_trywait_m13(isem_t_m13 *sem); // ownership or no owner required, or f
 tern		isem_trywait_noinc_m13(isem_t_m13 *isem); // ownership or no owner required, or fail
 void		isem_wait_m13(isem_t_m13 *sem); // ownership or no owner required, or block
 void		isem_wait_noinc_m13(isem_t_m13 *isem); // ownership or no owner required, or block
+void		isem_wake_m13(isem_t_m13 *isem); // caller holds isem mutex (for direct field writers; isem functions wake internally)
 size_t		malloc_size_m13(void *address);
 tern		md_m13(const si1 *dir); // synonym for mkdir()
 void		*memalign_m13(void *addr, si4 alignment);  // (alignment == -1): page align
@@ -6914,6 +7512,12 @@ si4		pthread_equal_m13(pthread_t_m13 thread_1, pthread_t_m13 thread_2);
 void		pthread_exit_m13(void *ptr);
 si1		*pthread_getname_m13(pthread_t_m13 thread, si1 *thread_name, size_t name_len);
 si1		*pthread_getname_id_m13(pid_t_m13 _id, si1 *thread_name, size_t name_len);  // get thread name by thread id
+si4		pthread_cond_broadcast_m13(pthread_cond_t_m13 *cond_p);
+si4		pthread_cond_destroy_m13(pthread_cond_t_m13 *cond_p);
+si4		pthread_cond_init_m13(pthread_cond_t_m13 *cond_p, pthread_condattr_t_m13 *attr_p);
+si4		pthread_cond_signal_m13(pthread_cond_t_m13 *cond_p);
+si4		pthread_cond_timedwait_m13(pthread_cond_t_m13 *cond_p, pthread_mutex_t_m13 *mutex_p, si8 abs_uutc); // deadline in uutc (G_current_uutc_m13() clock); returns ETIMEDOUT on expiry
+si4		pthread_cond_wait_m13(pthread_cond_t_m13 *cond_p, pthread_mutex_t_m13 *mutex_p);
 si4		pthread_create_m13(pthread_t_m13 *thread, pthread_attr_t_m13 *attributes, pthread_fn_m13 start_routine, void *arg); // new thread inherits spawner's current behavior (snapshot) as its base stack entry
 si4		pthread_join_m13(pthread_t_m13 thread, void **value_ptr);
 si4		pthread_kill_m13(pthread_t_m13 thread, si4 signal);
@@ -1053,6 +1053,50 @@ tern	REC_write_CSig_m13(const si1 *level_path, si8 record_time, const si1 *targe
 }
 
 
+tern	REC_write_CSigs_m13(si1 **level_paths, si8 record_time, si1 **target_file_paths, ui8 *target_file_UIDs, si4 n_files, ui1 occasion, tern *written)
+{
+	tern			r_val, *dgst_ok;
+	si4			i;
+	DGST_RESULT_m13		*dgsts;
+
+#ifdef FT_DEBUG_m13
+	G_push_function_m13();
+#endif
+
+	// REC_write_CSig_m13() for many targets at one custody event (e.g. conversion, transfer, or archive of a session):
+	// the digests are computed together by batch read (DGST_files_m13()), then one record is appended per target
+	// level_paths[i]: target i's CHANNEL directory (see REC_write_CSig_m13()); target_file_UIDs[i]: its file UID
+	// written (may be NULL) gets each target's outcome; returns FALSE_m13 if any target was not attested
+
+	if (level_paths == NULL || target_file_paths == NULL || target_file_UIDs == NULL) {
+		G_set_error_m13(E_REC_m13, "NULL argument");
+		return_m13(FALSE_m13);
+	}
+	if (n_files < 1)
+		return_m13(TRUE_m13);
+
+	dgsts = (DGST_RESULT_m13 *) malloc_m13((size_t) n_files * sizeof(DGST_RESULT_m13));
+	dgst_ok = (tern *) malloc_m13((size_t) n_files * sizeof(tern));
+	DGST_files_m13(target_file_paths, n_files, dgsts, dgst_ok);
+
+	r_val = TRUE_m13;
+	for (i = 0; i < n_files; ++i) {
+		if (dgst_ok[i] == TRUE_m13)
+			if (REC_write_CSig_m13(level_paths[i], record_time, target_file_paths[i], target_file_UIDs[i], occasion, dgsts + i) == FALSE_m13)
+				dgst_ok[i] = FALSE_m13;
+		if (dgst_ok[i] != TRUE_m13)
+			r_val = FALSE_m13;
+		if (written)
+			written[i] = dgst_ok[i];
+	}
+
+	free_m13(dgsts);
+	free_m13(dgst_ok);
+
+	return_m13(r_val);
+}
+
+
 //*************************************************************************************//
 //**************************   CSti: Cognitive Stimulation   **************************//
 //*************************************************************************************//
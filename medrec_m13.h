@@ -610,6 +610,7 @@ typedef struct {
 tern	REC_show_CSig_type_m13(REC_HDR_m13 *record_header);
 si8	REC_build_CSig_body_m13(const si1 *target_file_path, ui8 target_file_UID, ui1 occasion, const DGST_RESULT_m13 *dgst, ui1 *body); // fills a v1.0 CSig record body (digest-only); dgst == NULL => compute by streamed read (DGST_file_m13()); returns body bytes (pre-pad) or FALSE_m13
 tern	REC_write_CSig_m13(const si1 *level_path, si8 record_time, const si1 *target_file_path, ui8 target_file_UID, ui1 occasion, const DGST_RESULT_m13 *dgst); // appends a CSig record + index entry to the passed level's records files - CONVENTION: the target's CHANNEL directory (channel subsets carry their attestations); see REC_build_CSig_body_m13() for dgst semantics; record_time is oUTC
+tern	REC_write_CSigs_m13(si1 **level_paths, si8 record_time, si1 **target_file_paths, ui8 *target_file_UIDs, si4 n_files, ui1 occasion, tern *written); // REC_write_CSig_m13() for many targets at once (custody events over whole sessions): digests by batch read (DGST_files_m13()); written (may be NULL) gets each target's outcome
 
 
 